@@ -36,6 +36,7 @@ extern "C" void AppMain(void)
   InputDrv::GetInstance().InitTask(nullptr, &hadc2);
   // Init Sound Driver Task
   SoundDrv::GetInstance().InitTask(&htim4);
+  // Asset Driver Task created when pack file opened
 
   // Init Messages Test Task
   ExampleMsgTask::GetInstance().InitTask();
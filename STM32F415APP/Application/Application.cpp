@@ -26,6 +26,7 @@
 #include "Calc.h"
 #include "GraphDemo.h"
 #include "InputTest.h"
+#include "DisplayTest.h"
 
 #include "fatfs.h"
 #include "usbd_cdc.h"
@@ -79,7 +80,11 @@ Result Application::Loop()
    {"USB test",        nullptr, &Application::GetMenuStr, this, 8},
    {"Servo test",      nullptr, &Application::GetMenuStr, this, 9},
    {"Touch calibrate", nullptr, &Application::GetMenuStr, this, 10},
-   {"I2C Ping",        nullptr, &Application::GetMenuStr, this, 11}};
+   {"I2C Ping",        nullptr, &Application::GetMenuStr, this, 11},
+   {"Display test",    nullptr, &Application::GetMenuStr, this, 12},
+   {"Blit benchmark",  nullptr, &Application::GetMenuStr, this, 13},
+   {"Sprite demo",     nullptr, &Application::GetMenuStr, this, 14},
+   {"Text demo",       nullptr, &Application::GetMenuStr, this, 15}};
 
   // Create menu object
   UiMenu menu("Main Menu", main_menu_items, NumberOf(main_menu_items));
@@ -214,6 +219,26 @@ Result Application::Loop()
         case 10:
           IicPing(iic);
           break;
+
+        // DisplayTest Application
+        case 11:
+          DisplayTest::GetInstance().Loop();
+          break;
+
+        // Blitter benchmark
+        case 12:
+          DisplayTest::GetInstance().Benchmark();
+          break;
+
+        // SpriteBatch demo
+        case 13:
+          DisplayTest::GetInstance().SpriteDemo();
+          break;
+
+        // PropString demo
+        case 14:
+          DisplayTest::GetInstance().TextDemo();
+          break;
          
         default:
           break;
@@ -311,6 +336,10 @@ Result Application::IicPing(IIic& iic)
     // Generate string
     sprintf(str_buf[8U], "T=%ld.%02ldC P=%ldPa H=%ld.%02ld%% %s", temp/100, abs(temp%100), press, humid/100, abs(humid%100), result.IsGood() ? "" : "ERROR"); // Received an ACK at that address
 
+    // Strings content changed - update it
+    for(uint32_t i = 0U; i < 8U; i++) str_arr[i].SetString(str_buf[i]);
+    str_arr[10U].SetString(str_buf[8U]);
+
     // Update display
     display_drv.UpdateDisplay();
     // Wait
@@ -466,11 +495,11 @@ void SoundControlBox::Action(VisObject::ActionType action, int32_t tx, int32_t t
       // Update image
       if(mute == true)
       {
-        SetImage(mute_img[0], true); // Don't take semaphore - already taken
+        SetImage(mute_img[0]);
       }
       else
       {
-        SetImage(mute_img[1], true); // Don't take semaphore - already taken
+        SetImage(mute_img[1]);
       }
       // Mute control
       sound_drv.Mute(mute);
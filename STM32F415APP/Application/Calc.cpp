@@ -118,6 +118,8 @@ void Calc::GenerateStr()
 	{
 		snprintf(str, sizeof(str), "%li %c %li", a, op, b);
 	}
+	// Result string changed - button should be redrawn
+	result.Invalidate();
 }
 
 // *****************************************************************************
@@ -0,0 +1,447 @@
+//******************************************************************************
+//  @file DisplayTest.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Display Test Application Class
+//
+//  @copyright Copyright (c) 2017, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DisplayTest.h"
+
+// Proportional font from FontSans16.cpp
+extern const uint8_t font_sans16[];
+
+// *****************************************************************************
+// ***   Sprite demo images   **************************************************
+// *****************************************************************************
+// Ball: 0 - transparent, 1 - rim, 2 - body, 3 - highlight
+static const uint8_t ball_data[] = {
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,
+0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01,
+0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01,
+0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00};
+
+static const uint16_t ball_palettes[][4] = {
+{COLOR_MAGENTA, COLOR_DARKRED,    COLOR_RED,    COLOR_WHITE},
+{COLOR_MAGENTA, COLOR_DARKGREEN,  COLOR_GREEN,  COLOR_WHITE},
+{COLOR_MAGENTA, COLOR_DARKBLUE,   COLOR_BLUE,   COLOR_WHITE},
+{COLOR_MAGENTA, COLOR_DARKYELLOW, COLOR_YELLOW, COLOR_WHITE}};
+
+static const ImageDesc balls[] = {
+{8, 8, 8, {.img8 = ball_data}, ball_palettes[0], COLOR_MAGENTA},
+{8, 8, 8, {.img8 = ball_data}, ball_palettes[1], COLOR_MAGENTA},
+{8, 8, 8, {.img8 = ball_data}, ball_palettes[2], COLOR_MAGENTA},
+{8, 8, 8, {.img8 = ball_data}, ball_palettes[3], COLOR_MAGENTA}};
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void ProbeBox::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Frame counter changed after frame drawn
+  uint32_t frame = DisplayDrv::GetInstance().GetFrameCnt();
+  if(frame != last_frame)
+  {
+    last_frame = frame;
+    frame_x = x_start;
+    frame_y = y_start;
+  }
+  else if((x_start != frame_x) || (y_start != frame_y))
+  {
+    torn_lines++;
+  }
+  // Start and end coordinates must be changed together
+  if((x_end - x_start + 1 != width) || (y_end - y_start + 1 != height))
+  {
+    torn_lines++;
+  }
+  Box::DrawInBufW(buf, n, line, start_x);
+}
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+DisplayTest& DisplayTest::GetInstance(void)
+{
+   static DisplayTest display_test;
+   return display_test;
+}
+
+// *****************************************************************************
+// ***   Timer callback   ******************************************************
+// *****************************************************************************
+void DisplayTest::TimerCallback(void* ptr)
+{
+  DisplayTest& dt = *(DisplayTest*)ptr;
+  // Move probes by delta and bounce from screen edges
+  for(uint32_t i = 0U; i < PROBES_CNT; i++)
+  {
+    if((dt.timer_x[i] + dt.timer_dx[i] < 0) || (dt.timer_x[i] + dt.timer_dx[i] + PROBE_SIZE > dt.display_drv.GetScreenW()))
+    {
+      dt.timer_dx[i] = -dt.timer_dx[i];
+    }
+    dt.timer_x[i] += dt.timer_dx[i];
+    dt.timer_probes[i].Move(dt.timer_dx[i], 0, true);
+  }
+  dt.timer_moves++;
+  dt.display_drv.UpdateDisplay();
+}
+
+// *****************************************************************************
+// ***   Application Loop   ****************************************************
+// *****************************************************************************
+Result DisplayTest::Loop()
+{
+  const int32_t w = display_drv.GetScreenW();
+  const int32_t h = display_drv.GetScreenH();
+  // Result string
+  char str_buf[64] = {"Running..."};
+  String str(str_buf, 0, h - 12, COLOR_WHITE, String::FONT_8x12);
+  str.Show(10000);
+
+  // Probes in upper half moved by timer, in lower half by this task
+  for(uint32_t i = 0U; i < PROBES_CNT; i++)
+  {
+    timer_x[i] = (i * 37) % (w - PROBE_SIZE);
+    timer_dx[i] = 1 + (int32_t)(i % 3U);
+    timer_probes[i].SetParams(timer_x[i], 10 + i * PROBE_SIZE, PROBE_SIZE, PROBE_SIZE, COLOR_GREEN, true);
+    timer_probes[i].Show(100 + i);
+    task_probes[i].SetParams(0, h / 2 + i * PROBE_SIZE, PROBE_SIZE, PROBE_SIZE, COLOR_YELLOW, true);
+    task_probes[i].Show(100 + i);
+  }
+  timer_moves = 0U;
+
+  // Timer task has higher priority than display driver task
+  RtosTimer timer(1U, RtosTimer::REPEATING, TimerCallback, this);
+  timer.Create();
+  timer.Start();
+
+  // Move probes by absolute coordinates
+  uint32_t start_frame = display_drv.GetFrameCnt();
+  uint32_t start_ms = HAL_GetTick();
+  int32_t task_x[PROBES_CNT] = {0};
+  for(uint32_t step = 0U; HAL_GetTick() - start_ms < TEST_TIME_MS; step++)
+  {
+    for(uint32_t i = 0U; i < PROBES_CNT; i++)
+    {
+      task_x[i] = (step * (i + 1U)) % (w - PROBE_SIZE);
+      task_probes[i].Move(task_x[i], h / 2 + i * PROBE_SIZE);
+    }
+    display_drv.UpdateDisplay();
+    // Let display driver task draw frame sometimes
+    if((step & 7U) == 0U) RtosTick::DelayTicks(1U);
+  }
+  timer.Stop();
+  // Wait for frame with last changes
+  display_drv.UpdateDisplay();
+  RtosTick::DelayMs(100U);
+
+  // Check results
+  uint32_t torn = 0U;
+  uint32_t lost = 0U;
+  for(uint32_t i = 0U; i < PROBES_CNT; i++)
+  {
+    torn += timer_probes[i].GetTornLines() + task_probes[i].GetTornLines();
+    if(timer_probes[i].GetStartX() != timer_x[i]) lost++;
+    if(task_probes[i].GetStartX() != task_x[i]) lost++;
+  }
+  snprintf(str_buf, sizeof(str_buf), "frm: %lu mv: %lu torn: %lu lost: %lu",
+           display_drv.GetFrameCnt() - start_frame, timer_moves, torn, lost);
+  str.SetString(str_buf);
+  display_drv.UpdateDisplay();
+
+  // Exit by touch
+  while(display_drv.IsTouch() == false)
+  {
+    RtosTick::DelayTicks(50U);
+  }
+  for(uint32_t i = 0U; i < PROBES_CNT; i++)
+  {
+    timer_probes[i].Hide();
+    task_probes[i].Hide();
+  }
+
+  // Always run
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Blitter Benchmark   ***************************************************
+// *****************************************************************************
+Result DisplayTest::Benchmark(void)
+{
+  // Widths of measured lines
+  static const int32_t widths[] = {8, 16, 32, 64, BENCH_MAX_W};
+  // Strings for results
+  char str_buf[NumberOf(widths) + 1U][64];
+  String str[NumberOf(widths) + 1U];
+
+  // Enable CPU cycles counter
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  // Every fourth pixel is transparent
+  for(uint32_t i = 0U; i < NumberOf(bench_palette); i++)
+  {
+    bench_palette[i] = (uint16_t)(i * 0x0101U);
+  }
+  for(int32_t i = 0; i < BENCH_MAX_W; i++)
+  {
+    bench_img8[i] = ((i & 3) == 3) ? 0U : (uint8_t)(i + 1);
+    bench_img16[i] = bench_palette[bench_img8[i]];
+  }
+
+  snprintf(str_buf[0], sizeof(str_buf[0]), "  W 16 old/new  16K old/new  8 old/new   8K old/new");
+  str[0].SetParams(str_buf[0], 0, 0, COLOR_WHITE, String::FONT_4x6);
+  str[0].Show(10000);
+  for(uint32_t i = 0U; i < NumberOf(widths); i++)
+  {
+    uint32_t cycles[8];
+    for(uint32_t j = 0U; j < 4U; j++)
+    {
+      const uint32_t bpp = (j < 2U) ? 16U : 8U;
+      const bool keyed = (j & 1U) != 0U;
+      cycles[j * 2U] = MeasureLine(nullptr, bpp, keyed, widths[i]);
+      cycles[j * 2U + 1U] = MeasureLine(Blitter::GetBlitter(bpp, false, keyed), bpp, keyed, widths[i]);
+    }
+    snprintf(str_buf[i + 1U], sizeof(str_buf[i + 1U]), "%3ld %5lu/%-5lu %5lu/%-5lu %5lu/%-5lu %5lu/%-5lu",
+             widths[i], cycles[0], cycles[1], cycles[2], cycles[3], cycles[4], cycles[5], cycles[6], cycles[7]);
+    str[i + 1U].SetParams(str_buf[i + 1U], 0, (i + 1U) * 8, COLOR_WHITE, String::FONT_4x6);
+    str[i + 1U].Show(10000);
+  }
+  display_drv.UpdateDisplay();
+
+  // Exit by touch
+  while(display_drv.IsTouch() == false)
+  {
+    RtosTick::DelayTicks(50U);
+  }
+  for(uint32_t i = 0U; i < NumberOf(str); i++)
+  {
+    str[i].Hide();
+  }
+
+  // Always run
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Sprite Demo   *********************************************************
+// *****************************************************************************
+Result DisplayTest::SpriteDemo(void)
+{
+  const int32_t w = display_drv.GetScreenW();
+  const int32_t h = display_drv.GetScreenH();
+  // Result string
+  char str_buf[64] = {"Running..."};
+  String str(str_buf, 0, h - 12, COLOR_WHITE, String::FONT_8x12);
+  str.Show(10000);
+
+  // Sprites added before batch shown, so all of them drawn in first frame
+  SpriteBatch batch(0, 0, w, h, sprites, SPRITES_CNT);
+  for(uint32_t i = 0U; i < SPRITES_CNT; i++)
+  {
+    sprite_x[i] = rand() % (w - balls[0].width);
+    sprite_y[i] = rand() % (h - balls[0].height);
+    // Speeds from 1 to 3 pixels per frame in random directions
+    const int8_t dx = 1 + (int32_t)(i % 3U);
+    const int8_t dy = 1 + (int32_t)(i % 2U);
+    sprite_dx[i] = (rand() % 2) ? dx : -dx;
+    sprite_dy[i] = (rand() % 2) ? dy : -dy;
+    batch.AddSprite(balls[i % NumberOf(balls)], sprite_x[i], sprite_y[i], i % 4U);
+  }
+  batch.Show(100);
+
+  uint32_t start_frame = display_drv.GetFrameCnt();
+  uint32_t start_ms = HAL_GetTick();
+  // Exit by touch
+  while(display_drv.IsTouch() == false)
+  {
+    // Move sprites and bounce from screen edges
+    for(uint32_t i = 0U; i < SPRITES_CNT; i++)
+    {
+      if((sprite_x[i] + sprite_dx[i] < 0) || (sprite_x[i] + sprite_dx[i] + balls[0].width > w))
+      {
+        sprite_dx[i] = -sprite_dx[i];
+      }
+      if((sprite_y[i] + sprite_dy[i] < 0) || (sprite_y[i] + sprite_dy[i] + balls[0].height > h))
+      {
+        sprite_dy[i] = -sprite_dy[i];
+      }
+      sprite_x[i] += sprite_dx[i];
+      sprite_y[i] += sprite_dy[i];
+      batch.MoveSprite(i, sprite_x[i], sprite_y[i]);
+    }
+    // Show frame rate every second
+    uint32_t ms = HAL_GetTick() - start_ms;
+    if(ms >= 1000U)
+    {
+      uint32_t frames = display_drv.GetFrameCnt() - start_frame;
+      snprintf(str_buf, sizeof(str_buf), "%lu sprites, fps: %lu, px: %lu", SPRITES_CNT,
+               frames * 1000U / ms, display_drv.GetPixelsPerFrame());
+      str.SetString(str_buf);
+      start_frame = display_drv.GetFrameCnt();
+      start_ms = HAL_GetTick();
+    }
+    // Update Display
+    display_drv.UpdateDisplay();
+    // Wait until frame drawn for run in lockstep with Display Task
+    display_drv.WaitForFrameDone();
+  }
+  batch.Hide();
+  str.Hide();
+
+  // Always run
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Text Demo   ***********************************************************
+// *****************************************************************************
+Result DisplayTest::TextDemo(void)
+{
+  static const uint16_t colors[STRIPES_CNT] = {COLOR_DARKBLUE, COLOR_DARKGREEN, COLOR_DARKRED, COLOR_DARKYELLOW};
+  static const char* const lines[] = {"The quick brown fox jumps",
+                                      "over the lazy dog.",
+                                      "0123456789 +-*/=<>()[]{}",
+                                      "Proportional anti-aliased text"};
+  const int32_t w = display_drv.GetScreenW();
+  const int32_t h = display_drv.GetScreenH();
+
+  // LZ compressed font in flash: glyphs decoded to glyph cache
+  PropFont font;
+  Result result = font.Init(font_sans16);
+  if(result.IsBad()) return result;
+  const int32_t line_h = font.GetHeight();
+
+  // Stripes under text show blending of glyph edges with background
+  Box stripes[STRIPES_CNT];
+  for(uint32_t i = 0U; i < STRIPES_CNT; i++)
+  {
+    stripes[i].SetParams(0, i * h / STRIPES_CNT, w, h / STRIPES_CNT, colors[i], true);
+    stripes[i].Show(10);
+  }
+  PropString text[NumberOf(lines)];
+  for(uint32_t i = 0U; i < NumberOf(lines); i++)
+  {
+    text[i].SetParams(lines[i], 8, 8 + i * line_h, COLOR_WHITE, font);
+    text[i].Show(100);
+  }
+  // Two buffers: string is laid out by display driver task before next frame,
+  // so buffer of string set before can't be changed until frame is done
+  char str_buf[2][PROP_STRING_MAX_CHARS];
+  snprintf(str_buf[0], sizeof(str_buf[0]), "Frame 0");
+  PropString counter(str_buf[0], 0, h - line_h * 2, COLOR_YELLOW, font);
+  counter.Show(100);
+
+  int32_t x = 0;
+  int32_t dx = 2;
+  uint32_t frame = 0U;
+  uint32_t fps = 0U;
+  uint32_t start_frame = display_drv.GetFrameCnt();
+  uint32_t start_ms = HAL_GetTick();
+  // Exit by touch
+  while(display_drv.IsTouch() == false)
+  {
+    // Frame rate updated every second
+    uint32_t ms = HAL_GetTick() - start_ms;
+    if(ms >= 1000U)
+    {
+      fps = (display_drv.GetFrameCnt() - start_frame) * 1000U / ms;
+      start_frame = display_drv.GetFrameCnt();
+      start_ms = HAL_GetTick();
+    }
+    frame++;
+    char* buf = str_buf[frame & 1U];
+    snprintf(buf, PROP_STRING_MAX_CHARS, "Frame %lu, fps: %lu", frame, fps);
+    counter.SetString(buf);
+    // Move string and bounce from screen edges
+    if((x + dx < 0) || (x + dx + counter.GetWidth() > w)) dx = -dx;
+    x += dx;
+    counter.Move(x, h - line_h * 2);
+    // Update Display
+    display_drv.UpdateDisplay();
+    // Wait until frame drawn for run in lockstep with Display Task
+    display_drv.WaitForFrameDone();
+  }
+  counter.Hide();
+  for(uint32_t i = 0U; i < NumberOf(lines); i++)
+  {
+    text[i].Hide();
+  }
+  for(uint32_t i = 0U; i < STRIPES_CNT; i++)
+  {
+    stripes[i].Hide();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Measure cycles per line   ************************************
+// *****************************************************************************
+uint32_t DisplayTest::MeasureLine(Blitter::BlitFunction blit, uint32_t bpp, bool keyed, int32_t n)
+{
+  const void* img = (bpp == 16U) ? (const void*)bench_img16 : (const void*)bench_img8;
+  const uint16_t key = bench_palette[0];
+  uint32_t min_cycles = 0xFFFFFFFFU;
+  for(uint32_t i = 0U; i < BENCH_RUNS; i++)
+  {
+    const uint32_t start = DWT->CYCCNT;
+    if(blit != nullptr)
+    {
+      blit(bench_buf, img, 0, n, bench_palette, key);
+    }
+    else
+    {
+      OldDrawLine(bench_buf, img, bench_palette, bpp, 0, n, 1, keyed ? key : -1);
+    }
+    const uint32_t cycles = DWT->CYCCNT - start;
+    if(cycles < min_cycles) min_cycles = cycles;
+  }
+  return min_cycles;
+}
+
+// *****************************************************************************
+// ***   Private: Old per-pixel loop of Image::DrawInBufW()   ******************
+// *****************************************************************************
+void DisplayTest::OldDrawLine(uint16_t* buf, const void* img, const uint16_t* palette, uint32_t bpp, int32_t idx, int32_t n, int32_t delta, int32_t transparent_color)
+{
+  // Format checked for every line and transparent color for every pixel
+  if(bpp == 16U)
+  {
+    const uint16_t* p_img = (const uint16_t*)img;
+    for(int32_t i = 0; i < n; i++)
+    {
+      uint16_t data = p_img[idx];
+      idx += delta;
+      if(data != transparent_color) buf[i] = data;
+    }
+  }
+  else
+  {
+    const uint8_t* p_img = (const uint8_t*)img;
+    for(int32_t i = 0; i < n; i++)
+    {
+      uint16_t data = palette[p_img[idx]];
+      idx += delta;
+      if(data != transparent_color) buf[i] = data;
+    }
+  }
+}
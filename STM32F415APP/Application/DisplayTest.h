@@ -0,0 +1,174 @@
+//******************************************************************************
+//  @file DisplayTest.h
+//  @author Nicolai Shlapunov
+//
+//  @details Application: Display Test Application Class, header
+//
+//  @copyright Copyright (c) 2017, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef DisplayTest_h
+#define DisplayTest_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "AppTask.h"
+#include "DisplayDrv.h"
+#include "RtosTimer.h"
+#include "Blitters.h"
+
+// *****************************************************************************
+// ***   Probe Box Class   *****************************************************
+// *****************************************************************************
+// * Box which checks that DisplayDrv sees the same position of object on all
+// * lines of frame and that object area isn't torn.
+class ProbeBox : public Box
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    ProbeBox() {};
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x = 0);
+
+    // *************************************************************************
+    // ***   Get count of torn lines   *****************************************
+    // *************************************************************************
+    inline uint32_t GetTornLines(void) {return torn_lines;}
+
+  private:
+    // Frame of saved position
+    uint32_t last_frame = 0xFFFFFFFFU;
+    // Position of object in first drawn line of frame
+    int32_t frame_x = 0;
+    int32_t frame_y = 0;
+    // Count of lines drawn with other position or torn area
+    uint32_t torn_lines = 0U;
+};
+
+// *****************************************************************************
+// ***   Display Test Application Class   **************************************
+// *****************************************************************************
+class DisplayTest : public AppTask
+{
+  public:
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    static DisplayTest& GetInstance(void);
+
+    // *************************************************************************
+    // ***   Application Loop   ************************************************
+    // *************************************************************************
+    // * Stress test of deferred object changes. Objects moved by application
+    // * task and by timer task with higher priority than display driver task,
+    // * so changes made while DisplayDrv takes and applies changes and while
+    // * it draws frame. Test checks that no line drawn with torn object and
+    // * no movement lost.
+    virtual Result Loop();
+
+    // *************************************************************************
+    // ***   Blitter Benchmark   ***********************************************
+    // *************************************************************************
+    // * Compares cycles per line of old per-pixel loop of Image::DrawInBufW()
+    // * and blitter kernels for 8-bit and 16-bit images, opaque and with
+    // * transparent color, for several widths. Cycles counted by DWT cycle
+    // * counter, minimum of several runs shown to skip interrupts.
+    Result Benchmark(void);
+
+    // *************************************************************************
+    // ***   Sprite Demo   *****************************************************
+    // *************************************************************************
+    // * SPRITES_CNT balls bounce in one SpriteBatch which covers whole screen.
+    // * Frames per second and pixels sent to display per frame shown at the
+    // * bottom of screen.
+    Result SpriteDemo(void);
+
+    // *************************************************************************
+    // ***   Text Demo   *******************************************************
+    // *************************************************************************
+    // * Strings drawn by proportional anti-aliased font over color stripes.
+    // * Bottom string with frame counter moves and changed every frame, so
+    // * its glyphs decoded to glyph cache are reused on all lines of frame.
+    Result TextDemo(void);
+
+  private:
+    // Count of probes moved by each mover
+    static const uint32_t PROBES_CNT = 8U;
+    // Size of probe
+    static const int32_t PROBE_SIZE = 12;
+    // Test duration
+    static const uint32_t TEST_TIME_MS = 10000U;
+
+    // Display driver instance
+    DisplayDrv& display_drv = DisplayDrv::GetInstance();
+
+    // Probes moved by timer and by application task
+    ProbeBox timer_probes[PROBES_CNT];
+    ProbeBox task_probes[PROBES_CNT];
+    // Position and direction of probes moved by timer
+    int32_t timer_x[PROBES_CNT];
+    int32_t timer_dx[PROBES_CNT];
+    // Count of timer moves
+    volatile uint32_t timer_moves = 0U;
+
+    // Max width of benchmark line
+    static const int32_t BENCH_MAX_W = 128;
+    // Runs of each measurement
+    static const uint32_t BENCH_RUNS = 16U;
+    // Images, palette and line buffer for benchmark
+    uint16_t bench_img16[BENCH_MAX_W];
+    uint8_t bench_img8[BENCH_MAX_W];
+    uint16_t bench_palette[256];
+    uint16_t bench_buf[BENCH_MAX_W];
+
+    // Count of sprites in sprite demo
+    static const uint32_t SPRITES_CNT = 500U;
+    // Sprite records, positions and directions of sprites
+    SpriteBatch::Sprite sprites[SPRITES_CNT];
+    int16_t sprite_x[SPRITES_CNT];
+    int16_t sprite_y[SPRITES_CNT];
+    int8_t sprite_dx[SPRITES_CNT];
+    int8_t sprite_dy[SPRITES_CNT];
+
+    // Count of color stripes in text demo
+    static const uint32_t STRIPES_CNT = 4U;
+
+    // *************************************************************************
+    // ***   Measure cycles per line   *****************************************
+    // *************************************************************************
+    // * Old loop used if blit is nullptr.
+    uint32_t MeasureLine(Blitter::BlitFunction blit, uint32_t bpp, bool keyed, int32_t n);
+
+    // *************************************************************************
+    // ***   Old per-pixel loop of Image::DrawInBufW()   ***********************
+    // *************************************************************************
+    static void OldDrawLine(uint16_t* buf, const void* img, const uint16_t* palette, uint32_t bpp, int32_t idx, int32_t n, int32_t delta, int32_t transparent_color);
+
+    // *************************************************************************
+    // ***   Timer callback   **************************************************
+    // *************************************************************************
+    static void TimerCallback(void* ptr);
+
+    // *************************************************************************
+    // ***   Private constructor   *********************************************
+    // *************************************************************************
+    DisplayTest() : AppTask(APPLICATION_TASK_STACK_SIZE, APPLICATION_TASK_PRIORITY,
+                            "DisplayTest") {};
+};
+
+#endif
@@ -0,0 +1,349 @@
+//******************************************************************************
+//  @file FontSans16.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Application: DejaVu Sans 16 px proportional font, generated by
+//           "FontConverter.py -b 4 -t 16 -z -n font_sans16 DejaVuSans.ttf"
+//           DejaVu fonts are based on Bitstream Vera fonts, see Bitstream Vera
+//           Fonts Copyright for license.
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// *****************************************************************************
+// ***   Font data   ***********************************************************
+// *****************************************************************************
+extern const uint8_t font_sans16[];
+const uint8_t font_sans16[] __attribute__((aligned(4))) = {
+0x44, 0x42, 0x46, 0x4E, 0x24, 0x13, 0x0F, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+0xFC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+0xFC, 0x05, 0x00, 0x00, 0x0C, 0x00, 0x02, 0x0C, 0x02, 0x03, 0x06, 0x00, 0x22, 0x00, 0x00, 0x00,
+0x08, 0x06, 0x00, 0x00, 0x06, 0x00, 0x05, 0x04, 0x01, 0x03, 0x07, 0x00, 0x23, 0x00, 0x00, 0x00,
+0x0E, 0x06, 0x00, 0x00, 0x42, 0x00, 0x0C, 0x0B, 0x01, 0x04, 0x0D, 0x00, 0x24, 0x00, 0x00, 0x00,
+0x50, 0x06, 0x00, 0x00, 0x32, 0x00, 0x08, 0x0E, 0x01, 0x03, 0x0A, 0x00, 0x25, 0x00, 0x00, 0x00,
+0x82, 0x06, 0x00, 0x00, 0x56, 0x00, 0x0F, 0x0C, 0x00, 0x03, 0x0F, 0x00, 0x26, 0x00, 0x00, 0x00,
+0xD8, 0x06, 0x00, 0x00, 0x47, 0x00, 0x0B, 0x0C, 0x01, 0x03, 0x0C, 0x00, 0x27, 0x00, 0x00, 0x00,
+0x1F, 0x07, 0x00, 0x00, 0x04, 0x00, 0x02, 0x04, 0x01, 0x03, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+0x23, 0x07, 0x00, 0x00, 0x1D, 0x00, 0x04, 0x0E, 0x01, 0x03, 0x06, 0x00, 0x29, 0x00, 0x00, 0x00,
+0x40, 0x07, 0x00, 0x00, 0x1D, 0x00, 0x04, 0x0E, 0x01, 0x03, 0x06, 0x00, 0x2A, 0x00, 0x00, 0x00,
+0x5D, 0x07, 0x00, 0x00, 0x16, 0x00, 0x08, 0x08, 0x00, 0x03, 0x08, 0x00, 0x2B, 0x00, 0x00, 0x00,
+0x73, 0x07, 0x00, 0x00, 0x13, 0x00, 0x0B, 0x09, 0x01, 0x06, 0x0D, 0x00, 0x2C, 0x00, 0x00, 0x00,
+0x86, 0x07, 0x00, 0x00, 0x09, 0x00, 0x03, 0x04, 0x01, 0x0D, 0x05, 0x00, 0x2D, 0x00, 0x00, 0x00,
+0x8F, 0x07, 0x00, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x0A, 0x06, 0x00, 0x2E, 0x00, 0x00, 0x00,
+0x93, 0x07, 0x00, 0x00, 0x05, 0x00, 0x03, 0x02, 0x01, 0x0D, 0x05, 0x00, 0x2F, 0x00, 0x00, 0x00,
+0x98, 0x07, 0x00, 0x00, 0x28, 0x00, 0x06, 0x0D, 0x00, 0x03, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00,
+0xC0, 0x07, 0x00, 0x00, 0x2D, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x31, 0x00, 0x00, 0x00,
+0xED, 0x07, 0x00, 0x00, 0x13, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x32, 0x00, 0x00, 0x00,
+0x00, 0x08, 0x00, 0x00, 0x31, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x33, 0x00, 0x00, 0x00,
+0x31, 0x08, 0x00, 0x00, 0x30, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x34, 0x00, 0x00, 0x00,
+0x61, 0x08, 0x00, 0x00, 0x34, 0x00, 0x0A, 0x0C, 0x00, 0x03, 0x0A, 0x00, 0x35, 0x00, 0x00, 0x00,
+0x95, 0x08, 0x00, 0x00, 0x28, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x36, 0x00, 0x00, 0x00,
+0xBD, 0x08, 0x00, 0x00, 0x3C, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x37, 0x00, 0x00, 0x00,
+0xF9, 0x08, 0x00, 0x00, 0x31, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x38, 0x00, 0x00, 0x00,
+0x2A, 0x09, 0x00, 0x00, 0x38, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x39, 0x00, 0x00, 0x00,
+0x62, 0x09, 0x00, 0x00, 0x3B, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x3A, 0x00, 0x00, 0x00,
+0x9D, 0x09, 0x00, 0x00, 0x0A, 0x00, 0x03, 0x08, 0x01, 0x07, 0x05, 0x00, 0x3B, 0x00, 0x00, 0x00,
+0xA7, 0x09, 0x00, 0x00, 0x11, 0x00, 0x03, 0x0A, 0x01, 0x07, 0x05, 0x00, 0x3C, 0x00, 0x00, 0x00,
+0xB8, 0x09, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0x09, 0x01, 0x06, 0x0D, 0x00, 0x3D, 0x00, 0x00, 0x00,
+0xE7, 0x09, 0x00, 0x00, 0x0C, 0x00, 0x0B, 0x04, 0x01, 0x08, 0x0D, 0x00, 0x3E, 0x00, 0x00, 0x00,
+0xF3, 0x09, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0x09, 0x01, 0x06, 0x0D, 0x00, 0x3F, 0x00, 0x00, 0x00,
+0x22, 0x0A, 0x00, 0x00, 0x27, 0x00, 0x07, 0x0C, 0x01, 0x03, 0x09, 0x00, 0x40, 0x00, 0x00, 0x00,
+0x49, 0x0A, 0x00, 0x00, 0x60, 0x00, 0x0E, 0x0E, 0x01, 0x04, 0x10, 0x00, 0x41, 0x00, 0x00, 0x00,
+0xA9, 0x0A, 0x00, 0x00, 0x49, 0x00, 0x0B, 0x0C, 0x00, 0x03, 0x0B, 0x00, 0x42, 0x00, 0x00, 0x00,
+0xF2, 0x0A, 0x00, 0x00, 0x38, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0B, 0x00, 0x43, 0x00, 0x00, 0x00,
+0x2A, 0x0B, 0x00, 0x00, 0x33, 0x00, 0x0B, 0x0C, 0x00, 0x03, 0x0B, 0x00, 0x44, 0x00, 0x00, 0x00,
+0x5D, 0x0B, 0x00, 0x00, 0x2E, 0x00, 0x0B, 0x0C, 0x01, 0x03, 0x0C, 0x00, 0x45, 0x00, 0x00, 0x00,
+0x8B, 0x0B, 0x00, 0x00, 0x17, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x46, 0x00, 0x00, 0x00,
+0xA2, 0x0B, 0x00, 0x00, 0x13, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x09, 0x00, 0x47, 0x00, 0x00, 0x00,
+0xB5, 0x0B, 0x00, 0x00, 0x3F, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0x0C, 0x00, 0x48, 0x00, 0x00, 0x00,
+0xF4, 0x0B, 0x00, 0x00, 0x10, 0x00, 0x0A, 0x0C, 0x01, 0x03, 0x0C, 0x00, 0x49, 0x00, 0x00, 0x00,
+0x04, 0x0C, 0x00, 0x00, 0x05, 0x00, 0x03, 0x0C, 0x01, 0x03, 0x05, 0x00, 0x4A, 0x00, 0x00, 0x00,
+0x09, 0x0C, 0x00, 0x00, 0x12, 0x00, 0x05, 0x0F, 0xFF, 0x03, 0x05, 0x00, 0x4B, 0x00, 0x00, 0x00,
+0x1B, 0x0C, 0x00, 0x00, 0x3D, 0x00, 0x0A, 0x0C, 0x01, 0x03, 0x0B, 0x00, 0x4C, 0x00, 0x00, 0x00,
+0x58, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x09, 0x00, 0x4D, 0x00, 0x00, 0x00,
+0x64, 0x0C, 0x00, 0x00, 0x40, 0x00, 0x0C, 0x0C, 0x01, 0x03, 0x0E, 0x00, 0x4E, 0x00, 0x00, 0x00,
+0xA4, 0x0C, 0x00, 0x00, 0x3B, 0x00, 0x0A, 0x0C, 0x01, 0x03, 0x0C, 0x00, 0x4F, 0x00, 0x00, 0x00,
+0xDF, 0x0C, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0x0C, 0x00, 0x03, 0x0D, 0x00, 0x50, 0x00, 0x00, 0x00,
+0x1B, 0x0D, 0x00, 0x00, 0x1F, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x51, 0x00, 0x00, 0x00,
+0x3A, 0x0D, 0x00, 0x00, 0x4A, 0x00, 0x0C, 0x0E, 0x00, 0x03, 0x0D, 0x00, 0x52, 0x00, 0x00, 0x00,
+0x84, 0x0D, 0x00, 0x00, 0x34, 0x00, 0x0A, 0x0C, 0x01, 0x03, 0x0B, 0x00, 0x53, 0x00, 0x00, 0x00,
+0xB8, 0x0D, 0x00, 0x00, 0x3D, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x54, 0x00, 0x00, 0x00,
+0xF5, 0x0D, 0x00, 0x00, 0x11, 0x00, 0x0B, 0x0C, 0xFF, 0x03, 0x0A, 0x00, 0x55, 0x00, 0x00, 0x00,
+0x06, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x0A, 0x0C, 0x01, 0x03, 0x0C, 0x00, 0x56, 0x00, 0x00, 0x00,
+0x24, 0x0E, 0x00, 0x00, 0x49, 0x00, 0x0B, 0x0C, 0x00, 0x03, 0x0B, 0x00, 0x57, 0x00, 0x00, 0x00,
+0x6D, 0x0E, 0x00, 0x00, 0x61, 0x00, 0x10, 0x0C, 0x00, 0x03, 0x10, 0x00, 0x58, 0x00, 0x00, 0x00,
+0xCE, 0x0E, 0x00, 0x00, 0x48, 0x00, 0x0B, 0x0C, 0x00, 0x03, 0x0B, 0x00, 0x59, 0x00, 0x00, 0x00,
+0x16, 0x0F, 0x00, 0x00, 0x29, 0x00, 0x0A, 0x0C, 0x00, 0x03, 0x0A, 0x00, 0x5A, 0x00, 0x00, 0x00,
+0x3F, 0x0F, 0x00, 0x00, 0x42, 0x00, 0x0B, 0x0C, 0x00, 0x03, 0x0B, 0x00, 0x5B, 0x00, 0x00, 0x00,
+0x81, 0x0F, 0x00, 0x00, 0x0A, 0x00, 0x04, 0x0E, 0x01, 0x03, 0x06, 0x00, 0x5C, 0x00, 0x00, 0x00,
+0x8B, 0x0F, 0x00, 0x00, 0x28, 0x00, 0x06, 0x0D, 0x00, 0x03, 0x05, 0x00, 0x5D, 0x00, 0x00, 0x00,
+0xB3, 0x0F, 0x00, 0x00, 0x0A, 0x00, 0x04, 0x0E, 0x01, 0x03, 0x06, 0x00, 0x5E, 0x00, 0x00, 0x00,
+0xBD, 0x0F, 0x00, 0x00, 0x19, 0x00, 0x0B, 0x04, 0x01, 0x03, 0x0D, 0x00, 0x5F, 0x00, 0x00, 0x00,
+0xD6, 0x0F, 0x00, 0x00, 0x06, 0x00, 0x0A, 0x01, 0xFF, 0x12, 0x08, 0x00, 0x60, 0x00, 0x00, 0x00,
+0xDC, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x04, 0x03, 0x01, 0x02, 0x08, 0x00, 0x61, 0x00, 0x00, 0x00,
+0xE3, 0x0F, 0x00, 0x00, 0x25, 0x00, 0x08, 0x09, 0x01, 0x06, 0x0A, 0x00, 0x62, 0x00, 0x00, 0x00,
+0x08, 0x10, 0x00, 0x00, 0x2D, 0x00, 0x09, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x63, 0x00, 0x00, 0x00,
+0x35, 0x10, 0x00, 0x00, 0x1B, 0x00, 0x08, 0x09, 0x00, 0x06, 0x09, 0x00, 0x64, 0x00, 0x00, 0x00,
+0x50, 0x10, 0x00, 0x00, 0x2D, 0x00, 0x09, 0x0C, 0x00, 0x03, 0x0A, 0x00, 0x65, 0x00, 0x00, 0x00,
+0x7D, 0x10, 0x00, 0x00, 0x2D, 0x00, 0x09, 0x09, 0x00, 0x06, 0x0A, 0x00, 0x66, 0x00, 0x00, 0x00,
+0xAA, 0x10, 0x00, 0x00, 0x11, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x06, 0x00, 0x67, 0x00, 0x00, 0x00,
+0xBB, 0x10, 0x00, 0x00, 0x36, 0x00, 0x09, 0x0C, 0x00, 0x06, 0x0A, 0x00, 0x68, 0x00, 0x00, 0x00,
+0xF1, 0x10, 0x00, 0x00, 0x1D, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x0A, 0x00, 0x69, 0x00, 0x00, 0x00,
+0x0E, 0x11, 0x00, 0x00, 0x07, 0x00, 0x02, 0x0C, 0x01, 0x03, 0x04, 0x00, 0x6A, 0x00, 0x00, 0x00,
+0x15, 0x11, 0x00, 0x00, 0x11, 0x00, 0x04, 0x0F, 0xFF, 0x03, 0x04, 0x00, 0x6B, 0x00, 0x00, 0x00,
+0x26, 0x11, 0x00, 0x00, 0x2A, 0x00, 0x08, 0x0C, 0x01, 0x03, 0x09, 0x00, 0x6C, 0x00, 0x00, 0x00,
+0x50, 0x11, 0x00, 0x00, 0x04, 0x00, 0x02, 0x0C, 0x01, 0x03, 0x04, 0x00, 0x6D, 0x00, 0x00, 0x00,
+0x54, 0x11, 0x00, 0x00, 0x2A, 0x00, 0x0E, 0x09, 0x01, 0x06, 0x10, 0x00, 0x6E, 0x00, 0x00, 0x00,
+0x7E, 0x11, 0x00, 0x00, 0x17, 0x00, 0x08, 0x09, 0x01, 0x06, 0x0A, 0x00, 0x6F, 0x00, 0x00, 0x00,
+0x95, 0x11, 0x00, 0x00, 0x29, 0x00, 0x09, 0x09, 0x00, 0x06, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x00,
+0xBE, 0x11, 0x00, 0x00, 0x2D, 0x00, 0x09, 0x0C, 0x01, 0x06, 0x0A, 0x00, 0x71, 0x00, 0x00, 0x00,
+0xEB, 0x11, 0x00, 0x00, 0x2F, 0x00, 0x09, 0x0C, 0x00, 0x06, 0x0A, 0x00, 0x72, 0x00, 0x00, 0x00,
+0x1A, 0x12, 0x00, 0x00, 0x10, 0x00, 0x06, 0x09, 0x01, 0x06, 0x07, 0x00, 0x73, 0x00, 0x00, 0x00,
+0x2A, 0x12, 0x00, 0x00, 0x25, 0x00, 0x08, 0x09, 0x00, 0x06, 0x08, 0x00, 0x74, 0x00, 0x00, 0x00,
+0x4F, 0x12, 0x00, 0x00, 0x18, 0x00, 0x06, 0x0B, 0x00, 0x04, 0x06, 0x00, 0x75, 0x00, 0x00, 0x00,
+0x67, 0x12, 0x00, 0x00, 0x18, 0x00, 0x08, 0x09, 0x01, 0x06, 0x0A, 0x00, 0x76, 0x00, 0x00, 0x00,
+0x7F, 0x12, 0x00, 0x00, 0x2E, 0x00, 0x09, 0x09, 0x00, 0x06, 0x09, 0x00, 0x77, 0x00, 0x00, 0x00,
+0xAD, 0x12, 0x00, 0x00, 0x40, 0x00, 0x0D, 0x09, 0x00, 0x06, 0x0D, 0x00, 0x78, 0x00, 0x00, 0x00,
+0xED, 0x12, 0x00, 0x00, 0x2E, 0x00, 0x09, 0x09, 0x00, 0x06, 0x09, 0x00, 0x79, 0x00, 0x00, 0x00,
+0x1B, 0x13, 0x00, 0x00, 0x3C, 0x00, 0x09, 0x0C, 0x00, 0x06, 0x09, 0x00, 0x7A, 0x00, 0x00, 0x00,
+0x57, 0x13, 0x00, 0x00, 0x24, 0x00, 0x08, 0x09, 0x00, 0x06, 0x08, 0x00, 0x7B, 0x00, 0x00, 0x00,
+0x7B, 0x13, 0x00, 0x00, 0x2A, 0x00, 0x07, 0x0F, 0x02, 0x03, 0x0A, 0x00, 0x7C, 0x00, 0x00, 0x00,
+0xA5, 0x13, 0x00, 0x00, 0x04, 0x00, 0x02, 0x10, 0x02, 0x03, 0x05, 0x00, 0x7D, 0x00, 0x00, 0x00,
+0xA9, 0x13, 0x00, 0x00, 0x2A, 0x00, 0x07, 0x0F, 0x02, 0x03, 0x0A, 0x00, 0x7E, 0x00, 0x00, 0x00,
+0xD3, 0x13, 0x00, 0x00, 0x11, 0x00, 0x0B, 0x03, 0x01, 0x09, 0x0D, 0x00, 0x00, 0x9F, 0x84, 0x00,
+0x06, 0x8F, 0x8E, 0x7D, 0x00, 0x00, 0x9F, 0x9F, 0x02, 0x7D, 0x08, 0xC0, 0x98, 0x02, 0x0A, 0x00,
+0x00, 0x6D, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xA9, 0x02, 0xF2, 0x80, 0x05, 0x05, 0xE5, 0x06, 0xD0,
+0x00, 0x0D, 0xFF, 0x80, 0x00, 0x13, 0xF3, 0x00, 0x07, 0xC0, 0x0E, 0x50, 0x00, 0x00, 0x0A, 0x90,
+0x2F, 0x20, 0x00, 0x00, 0x0E, 0x50, 0x5E, 0x00, 0x00, 0xCF, 0x84, 0x17, 0x04, 0x40, 0x00, 0x7C,
+0x00, 0xD5, 0x80, 0x28, 0x02, 0xB8, 0x03, 0xF1, 0x80, 0x05, 0x04, 0xE4, 0x06, 0xC0, 0x00, 0x00,
+0x03, 0x00, 0x06, 0x60, 0x00, 0x84, 0x03, 0x08, 0x05, 0xCE, 0xFC, 0x50, 0x4F, 0x66, 0x74, 0xA2,
+0x9C, 0x80, 0x0B, 0x0F, 0x8E, 0x26, 0x60, 0x00, 0x1D, 0xED, 0xA4, 0x00, 0x00, 0x5A, 0xEF, 0xD2,
+0x00, 0x06, 0x62, 0xDB, 0x80, 0x1F, 0x08, 0xAC, 0x87, 0x26, 0x75, 0xE7, 0x28, 0xCF, 0xEC, 0x60,
+0x94, 0x2F, 0x15, 0x02, 0xBE, 0xC3, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x0C, 0x91, 0x7D, 0x10, 0x04,
+0xE1, 0x00, 0x00, 0x1F, 0x30, 0x1F, 0x30, 0x0D, 0x50, 0x8C, 0x07, 0x01, 0x8B, 0x00, 0x84, 0x17,
+0x02, 0x7E, 0x12, 0xE2, 0x80, 0x07, 0x80, 0x27, 0x01, 0x0B, 0x80, 0x80, 0x07, 0x80, 0x00, 0x03,
+0x5D, 0x12, 0xBE, 0xC4, 0x80, 0x06, 0x11, 0x01, 0xD5, 0x0B, 0xA1, 0x7E, 0x10, 0x00, 0x00, 0x08,
+0xB0, 0x0F, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x20, 0x8C, 0x07, 0x01, 0xB7, 0x00, 0x88, 0x17,
+0x01, 0x06, 0xD0, 0x80, 0x33, 0x01, 0xC4, 0x00, 0x0E, 0x00, 0x5C, 0xEC, 0x50, 0x00, 0x00, 0x04,
+0xF7, 0x13, 0xA2, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x80, 0x00, 0x01, 0x08, 0xF1, 0x84, 0x05, 0x01,
+0x03, 0xF9, 0x84, 0x05, 0x02, 0x07, 0xFF, 0x70, 0x80, 0x05, 0x23, 0x5F, 0x69, 0xF7, 0x00, 0x2F,
+0x50, 0xCB, 0x00, 0x8F, 0x70, 0x5F, 0x10, 0xE8, 0x00, 0x08, 0xF7, 0xCA, 0x00, 0xCC, 0x00, 0x00,
+0x8F, 0xE2, 0x00, 0x4F, 0xA2, 0x13, 0xAF, 0xF7, 0x00, 0x03, 0xAE, 0xFD, 0x92, 0x7F, 0x70, 0x00,
+0x7D, 0x80, 0x00, 0x0C, 0x00, 0x9B, 0x02, 0xF3, 0x09, 0xC0, 0x1E, 0x60, 0x4F, 0x30, 0x7F, 0x00,
+0x9E, 0x80, 0x01, 0x0B, 0x7F, 0x00, 0x4F, 0x30, 0x1E, 0x70, 0x09, 0xC0, 0x02, 0xF3, 0x00, 0x9B,
+0x0D, 0x7C, 0x00, 0x1E, 0x60, 0x08, 0xD0, 0x03, 0xF4, 0x00, 0xE8, 0x00, 0xCB, 0x00, 0xAC, 0x80,
+0x01, 0x0A, 0xCB, 0x00, 0xE8, 0x03, 0xF4, 0x08, 0xD0, 0x1E, 0x60, 0x7C, 0x00, 0x03, 0x00, 0x07,
+0x70, 0x00, 0x84, 0x03, 0x07, 0x4A, 0x37, 0x73, 0xA4, 0x02, 0x9D, 0xD9, 0x20, 0x84, 0x03, 0x84,
+0x0B, 0x94, 0x17, 0x04, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x80, 0x00, 0xB4, 0x05, 0x01, 0x4F, 0xFF,
+0x80, 0x00, 0x00, 0xB0, 0xD4, 0x1D, 0x07, 0x2F, 0x80, 0x3F, 0x70, 0x6E, 0x10, 0xA7, 0x00, 0x02,
+0x3F, 0xFF, 0xF0, 0x03, 0x4F, 0x50, 0x4F, 0x50, 0x26, 0x00, 0x01, 0xF3, 0x00, 0x06, 0xE0, 0x00,
+0x0B, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x5E, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xE5, 0x00, 0x04, 0xF1,
+0x00, 0x09, 0xB0, 0x00, 0x0E, 0x60, 0x00, 0x3F, 0x20, 0x00, 0x8C, 0x00, 0x00, 0xD7, 0x00, 0x00,
+0x10, 0x01, 0xAE, 0xEB, 0x30, 0x00, 0x0C, 0xC2, 0x1A, 0xE1, 0x00, 0x6F, 0x20, 0x01, 0xE8, 0x00,
+0xAD, 0x00, 0x80, 0x02, 0x08, 0xDB, 0x00, 0x00, 0x8F, 0x10, 0xEA, 0x00, 0x00, 0x7F, 0x8C, 0x04,
+0x88, 0x0E, 0x88, 0x18, 0x88, 0x22, 0x80, 0x2C, 0x01, 0xE2, 0x00, 0x88, 0x36, 0x09, 0x04, 0x9E,
+0xF2, 0x00, 0x3B, 0x67, 0xF2, 0x00, 0x00, 0x07, 0xFC, 0x03, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFB,
+0x1D, 0x28, 0xCE, 0xD9, 0x10, 0xBD, 0x41, 0x3C, 0xD1, 0x71, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x02,
+0xF7, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x1D, 0xD1, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0A, 0x80,
+0x0A, 0x03, 0x8F, 0x60, 0x00, 0x07, 0x80, 0x15, 0x07, 0x6F, 0x80, 0x00, 0x00, 0xCF, 0xFF, 0xFF,
+0xF9, 0x0B, 0x16, 0xCE, 0xEB, 0x30, 0x68, 0x31, 0x2A, 0xF3, 0x00, 0x00, 0x01, 0xF9, 0x80, 0x03,
+0x08, 0xF8, 0x00, 0x00, 0x2A, 0xE2, 0x00, 0xCF, 0xFE, 0x30, 0x80, 0x07, 0x04, 0xE4, 0x00, 0x00,
+0x00, 0xDB, 0x80, 0x03, 0x00, 0xBD, 0x84, 0x07, 0x07, 0x95, 0x21, 0x3A, 0xF3, 0x29, 0xDF, 0xDA,
+0x20, 0x07, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x5E, 0x80, 0x04, 0x02, 0x01, 0xE6, 0xE9,
+0x80, 0x0D, 0x00, 0xC0, 0x80, 0x04, 0x0A, 0x4F, 0x30, 0xE9, 0x00, 0x01, 0xD9, 0x00, 0xE9, 0x00,
+0x09, 0xE1, 0x80, 0x04, 0x01, 0x2F, 0x50, 0x80, 0x04, 0x04, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x80,
+0x28, 0x80, 0x1D, 0x98, 0x04, 0x07, 0x4F, 0xFF, 0xFF, 0xE0, 0x4F, 0x30, 0x00, 0x00, 0x98, 0x03,
+0x0E, 0xEF, 0xE9, 0x20, 0x48, 0x21, 0x4D, 0xD1, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xDB,
+0x8C, 0x03, 0x02, 0x03, 0xF8, 0x95, 0x80, 0x13, 0x03, 0x29, 0xDF, 0xD9, 0x20, 0x0F, 0x00, 0x4B,
+0xED, 0x81, 0x00, 0x06, 0xE5, 0x11, 0x76, 0x00, 0x2F, 0x50, 0x00, 0x00, 0x00, 0x8E, 0x80, 0x03,
+0x15, 0x00, 0xBC, 0x7D, 0xFD, 0x60, 0x00, 0xDF, 0xD3, 0x17, 0xF7, 0x00, 0xDF, 0x40, 0x00, 0xBE,
+0x00, 0xCF, 0x10, 0x00, 0x7F, 0x20, 0x9F, 0x84, 0x04, 0x0E, 0x4F, 0x40, 0x00, 0xAE, 0x00, 0x0B,
+0xD3, 0x16, 0xF6, 0x00, 0x01, 0x9E, 0xFC, 0x60, 0x00, 0x2F, 0xAF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x04, 0xF8, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00,
+0xBE, 0x10, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x2F,
+0x80, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x0D, 0x04, 0xBE, 0xEC, 0x50, 0x00,
+0x3F, 0x91, 0x17, 0xF6, 0x00, 0x8F, 0x10, 0x00, 0xDB, 0x8C, 0x04, 0x0B, 0x2E, 0x91, 0x17, 0xE4,
+0x00, 0x03, 0xDF, 0xFE, 0x50, 0x00, 0x3E, 0x92, 0x80, 0x18, 0x03, 0xBD, 0x00, 0x00, 0xAE, 0x80,
+0x15, 0x80, 0x1B, 0x00, 0xCD, 0x84, 0x09, 0x04, 0x5F, 0x91, 0x17, 0xF8, 0x00, 0x80, 0x36, 0x01,
+0x60, 0x00, 0x12, 0x04, 0xBE, 0xEA, 0x20, 0x00, 0x4F, 0x91, 0x2B, 0xD1, 0x00, 0xBD, 0x00, 0x02,
+0xF7, 0x00, 0xEA, 0x00, 0x00, 0xDC, 0x84, 0x04, 0x00, 0xDE, 0x84, 0x0E, 0x01, 0xFF, 0x10, 0x80,
+0x18, 0x06, 0xFF, 0x00, 0x05, 0xCF, 0xE8, 0x9E, 0x00, 0x80, 0x00, 0x00, 0xCA, 0x80, 0x03, 0x0C,
+0x03, 0xF4, 0x00, 0x38, 0x20, 0x4D, 0x90, 0x00, 0x07, 0xDF, 0xC6, 0x00, 0x00, 0x04, 0x2F, 0x80,
+0x2F, 0x80, 0x00, 0x90, 0x00, 0x84, 0x0B, 0x04, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0x90, 0x00, 0x07,
+0x2F, 0x80, 0x3F, 0x70, 0x6E, 0x10, 0xA7, 0x00, 0x00, 0x00, 0x80, 0x00, 0x15, 0x28, 0x90, 0x00,
+0x00, 0x01, 0x6C, 0xFE, 0x70, 0x00, 0x04, 0x9E, 0xFB, 0x50, 0x00, 0x17, 0xDF, 0xC7, 0x10, 0x00,
+0x00, 0x4F, 0xE6, 0x84, 0x19, 0x02, 0x17, 0xDF, 0xC6, 0x80, 0x0B, 0x04, 0x00, 0x04, 0xAE, 0xFA,
+0x50, 0x80, 0x06, 0x88, 0x23, 0x88, 0x2F, 0x01, 0x4F, 0xFF, 0x80, 0x00, 0x01, 0xB0, 0x00, 0xA0,
+0x00, 0x8C, 0x11, 0x02, 0x4A, 0x50, 0x00, 0x80, 0x00, 0x02, 0x2C, 0xFE, 0x83, 0x84, 0x06, 0x03,
+0x38, 0xEF, 0xC6, 0x10, 0x80, 0x06, 0x03, 0x05, 0xAF, 0xFA, 0x30, 0x80, 0x06, 0x0B, 0x02, 0xCF,
+0xB0, 0x00, 0x00, 0x04, 0xAE, 0xFA, 0x40, 0x00, 0x28, 0xDF, 0x80, 0x17, 0x8C, 0x23, 0x00, 0x4B,
+0x88, 0x2F, 0x1D, 0x3A, 0xDE, 0xB3, 0x00, 0xA5, 0x12, 0xBE, 0x10, 0x00, 0x00, 0x4F, 0x50, 0x00,
+0x00, 0x8F, 0x30, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
+0xD9, 0x90, 0x03, 0x84, 0x00, 0x00, 0xEA, 0x8C, 0x03, 0x32, 0x00, 0x01, 0x7C, 0xEE, 0xD9, 0x30,
+0x00, 0x00, 0x4E, 0x94, 0x10, 0x27, 0xE7, 0x00, 0x04, 0xE4, 0x00, 0x00, 0x00, 0x2D, 0x70, 0x1E,
+0x50, 0x1A, 0xFE, 0x8C, 0x52, 0xF3, 0x7B, 0x00, 0xAC, 0x22, 0xBF, 0x50, 0x99, 0xB5, 0x01, 0xF3,
+0x00, 0x3F, 0x50, 0x6C, 0xD3, 0x03, 0xF0, 0x00, 0x0E, 0x50, 0x4D, 0xD3, 0x04, 0x84, 0x06, 0x01,
+0x6B, 0xC5, 0x80, 0x14, 0x03, 0x2F, 0x50, 0xB7, 0x7A, 0x84, 0x22, 0x0A, 0x68, 0xC0, 0x1E, 0x40,
+0x1A, 0xED, 0x8B, 0xC7, 0x00, 0x05, 0xE3, 0x80, 0x3E, 0x80, 0x00, 0x0C, 0x5E, 0x93, 0x11, 0x36,
+0xC4, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xDB, 0x61, 0x00, 0x09, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00,
+0x00, 0x01, 0xEF, 0xE0, 0x80, 0x05, 0x02, 0x05, 0xF7, 0xF4, 0x80, 0x05, 0x02, 0x0B, 0xD0, 0xEA,
+0x80, 0x05, 0x29, 0x2F, 0x80, 0x9F, 0x10, 0x00, 0x00, 0x7F, 0x30, 0x3F, 0x60, 0x00, 0x00, 0xDD,
+0x00, 0x0D, 0xC0, 0x00, 0x03, 0xF7, 0x00, 0x08, 0xF2, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+0x0E, 0xA0, 0x00, 0x00, 0xBD, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x40, 0xAE, 0x80, 0x2C, 0x01,
+0x1E, 0x90, 0x0E, 0x6F, 0xFF, 0xFD, 0xA2, 0x00, 0x6F, 0x20, 0x03, 0xCD, 0x10, 0x6F, 0x20, 0x00,
+0x5F, 0x40, 0x90, 0x04, 0x06, 0x03, 0xCD, 0x00, 0x6F, 0xFF, 0xFF, 0xD3, 0x80, 0x18, 0x02, 0x02,
+0x9E, 0x30, 0x80, 0x13, 0x01, 0x0E, 0xA0, 0x80, 0x04, 0x01, 0x0D, 0xC0, 0x84, 0x09, 0x00, 0xB0,
+0x80, 0x13, 0x06, 0x9F, 0x40, 0x6F, 0xFF, 0xFE, 0xB4, 0x00, 0x14, 0x00, 0x03, 0xAD, 0xFD, 0xB5,
+0x00, 0x00, 0x6F, 0x92, 0x02, 0x7F, 0x50, 0x03, 0xF8, 0x00, 0x00, 0x03, 0x40, 0x0A, 0xE0, 0x00,
+0x80, 0x00, 0x01, 0x0E, 0xB0, 0x84, 0x05, 0x01, 0x1F, 0x90, 0x9C, 0x05, 0x8C, 0x11, 0x8C, 0x1D,
+0x01, 0x03, 0xF7, 0x84, 0x29, 0x8C, 0x35, 0x02, 0x00, 0x03, 0xAE, 0x80, 0x41, 0x0A, 0x6F, 0xFF,
+0xED, 0xA5, 0x00, 0x00, 0x6F, 0x20, 0x02, 0x7E, 0xB0, 0x80, 0x05, 0x02, 0x00, 0x03, 0xF9, 0x84,
+0x05, 0x02, 0x00, 0xAF, 0x10, 0x84, 0x05, 0x01, 0x6F, 0x40, 0x84, 0x05, 0x01, 0x5F, 0x50, 0x9C,
+0x05, 0x8C, 0x11, 0x88, 0x1D, 0x88, 0x29, 0x88, 0x35, 0x88, 0x41, 0x08, 0x6F, 0xFF, 0xFF, 0xFE,
+0x00, 0x6F, 0x20, 0x00, 0x00, 0xB8, 0x04, 0x02, 0xFF, 0xFF, 0xFB, 0xCC, 0x18, 0x90, 0x1D, 0x01,
+0xFF, 0x10, 0x07, 0x6F, 0xFF, 0xFF, 0xF4, 0x6F, 0x20, 0x00, 0x00, 0xA8, 0x03, 0x02, 0xFF, 0xFF,
+0xC0, 0xB8, 0x13, 0x90, 0x03, 0x13, 0x00, 0x03, 0xAD, 0xFE, 0xC8, 0x20, 0x00, 0x6F, 0x93, 0x01,
+0x5D, 0xC0, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x70, 0x0A, 0xE0, 0x80, 0x05, 0x02, 0x00, 0x0E, 0xA0,
+0x84, 0x05, 0x01, 0x1F, 0x90, 0x90, 0x05, 0x02, 0x1F, 0xFF, 0xF1, 0x84, 0x11, 0x01, 0x07, 0xF1,
+0x84, 0x1D, 0x01, 0x07, 0xF1, 0x84, 0x29, 0x01, 0x07, 0xF1, 0x84, 0x35, 0x01, 0x4B, 0xF1, 0x84,
+0x41, 0x01, 0xC9, 0x30, 0x04, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0xC8, 0x04, 0x02, 0xFF, 0xFF, 0xFF,
+0xCC, 0x18, 0x98, 0x04, 0x01, 0x6F, 0x20, 0xCC, 0x01, 0x02, 0x00, 0x6F, 0x20, 0xF0, 0x02, 0x0A,
+0x7F, 0x20, 0x00, 0x8F, 0x10, 0x03, 0xEB, 0x00, 0xCD, 0x91, 0x00, 0x1B, 0x6F, 0x20, 0x00, 0x3E,
+0xC1, 0x6F, 0x20, 0x03, 0xEC, 0x10, 0x6F, 0x20, 0x4E, 0xC1, 0x00, 0x6F, 0x24, 0xEB, 0x10, 0x00,
+0x6F, 0x7F, 0xB1, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x80, 0x04, 0x01, 0xBF, 0x80, 0x80, 0x04, 0x01,
+0x29, 0xF7, 0x80, 0x04, 0x02, 0x20, 0x9F, 0x70, 0x80, 0x04, 0x01, 0x0A, 0xF6, 0x80, 0x04, 0x02,
+0x00, 0xAF, 0x60, 0x80, 0x04, 0x01, 0x0B, 0xF5, 0x03, 0x6F, 0x20, 0x00, 0x00, 0xFC, 0x03, 0x07,
+0x02, 0xFF, 0xFF, 0xFC, 0x2D, 0x6F, 0xF2, 0x00, 0x00, 0x4F, 0xF4, 0x6F, 0xE7, 0x00, 0x00, 0xAE,
+0xF4, 0x6F, 0xAC, 0x00, 0x01, 0xEA, 0xF4, 0x6F, 0x5F, 0x20, 0x05, 0xE5, 0xF4, 0x6F, 0x2D, 0x80,
+0x0B, 0xA4, 0xF4, 0x6F, 0x27, 0xD0, 0x1F, 0x44, 0xF4, 0x6F, 0x22, 0xF3, 0x6E, 0x04, 0xF4, 0x6F,
+0x20, 0xC9, 0xC9, 0x84, 0x05, 0x01, 0x6E, 0xF3, 0x84, 0x05, 0x01, 0x1F, 0xD0, 0x84, 0x05, 0x01,
+0x00, 0x00, 0x94, 0x05, 0x06, 0x6F, 0xE1, 0x00, 0x02, 0xF6, 0x6F, 0xF7, 0x84, 0x04, 0x01, 0xBE,
+0x10, 0x80, 0x04, 0x01, 0x4F, 0x80, 0x80, 0x04, 0x01, 0x29, 0xE1, 0x80, 0x04, 0x01, 0x22, 0xF8,
+0x80, 0x04, 0x02, 0x20, 0x8E, 0x12, 0x80, 0x04, 0x01, 0x1E, 0x92, 0x80, 0x04, 0x01, 0x08, 0xF4,
+0x80, 0x04, 0x01, 0x01, 0xEB, 0x80, 0x04, 0x01, 0x00, 0x7F, 0x84, 0x04, 0x01, 0x1E, 0xF6, 0x23,
+0x00, 0x04, 0xBE, 0xFD, 0x81, 0x00, 0x00, 0x7F, 0x82, 0x03, 0xCD, 0x20, 0x03, 0xF8, 0x00, 0x00,
+0x1D, 0xC0, 0x0A, 0xE1, 0x00, 0x00, 0x06, 0xF4, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0x90,
+0x00, 0x00, 0x00, 0xFA, 0x8C, 0x05, 0x8C, 0x11, 0x01, 0x0A, 0xE0, 0x84, 0x1D, 0x00, 0x04, 0x88,
+0x29, 0x84, 0x35, 0x01, 0xCE, 0x20, 0x84, 0x41, 0x01, 0x91, 0x00, 0x08, 0x6F, 0xFF, 0xEC, 0x70,
+0x00, 0x6F, 0x20, 0x17, 0xF8, 0x80, 0x04, 0x01, 0x00, 0xBE, 0x84, 0x04, 0x01, 0x9F, 0x10, 0x90,
+0x09, 0x84, 0x13, 0x8C, 0x1D, 0x01, 0x00, 0x00, 0xC8, 0x04, 0x23, 0x00, 0x04, 0xBE, 0xFD, 0x81,
+0x00, 0x00, 0x7F, 0x82, 0x03, 0xCD, 0x20, 0x03, 0xF8, 0x00, 0x00, 0x1D, 0xC0, 0x0A, 0xE1, 0x00,
+0x00, 0x06, 0xF4, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0x90, 0x00, 0x00, 0x00, 0xFA, 0x8C,
+0x05, 0x8C, 0x11, 0x01, 0x0A, 0xE0, 0x84, 0x1D, 0x00, 0x04, 0x84, 0x29, 0x00, 0xD0, 0x84, 0x35,
+0x01, 0xCE, 0x20, 0x80, 0x41, 0x01, 0xFF, 0xC1, 0x80, 0x20, 0x02, 0x00, 0x09, 0xF4, 0x84, 0x05,
+0x02, 0x00, 0xBE, 0x30, 0x08, 0x6F, 0xFF, 0xFD, 0x70, 0x00, 0x6F, 0x20, 0x16, 0xF8, 0x80, 0x04,
+0x01, 0x00, 0xBE, 0x84, 0x04, 0x01, 0x9F, 0x10, 0x90, 0x09, 0x84, 0x13, 0x02, 0xFF, 0xFF, 0x90,
+0x80, 0x09, 0x01, 0x19, 0xF4, 0x84, 0x18, 0x00, 0xCD, 0x84, 0x04, 0x01, 0x4F, 0x60, 0x80, 0x04,
+0x01, 0x0C, 0xD0, 0x80, 0x04, 0x01, 0x04, 0xF6, 0x10, 0x04, 0xBE, 0xEC, 0x71, 0x00, 0x6F, 0x82,
+0x15, 0xD8, 0x00, 0xCC, 0x00, 0x00, 0x16, 0x00, 0xDA, 0x00, 0x80, 0x00, 0x01, 0xAE, 0x40, 0x80,
+0x04, 0x08, 0x2C, 0xFD, 0x96, 0x10, 0x00, 0x00, 0x37, 0xAE, 0xE5, 0x80, 0x0B, 0x01, 0x01, 0xCE,
+0x80, 0x0A, 0x11, 0x00, 0x6F, 0x30, 0x80, 0x00, 0x00, 0x8F, 0x20, 0xDC, 0x41, 0x16, 0xEB, 0x00,
+0x28, 0xCE, 0xEC, 0x81, 0x00, 0x01, 0x1F, 0xFF, 0x80, 0x00, 0x05, 0xC0, 0x00, 0x00, 0x0E, 0xA0,
+0x00, 0x80, 0x00, 0xFC, 0x05, 0x18, 0x04, 0x9F, 0x00, 0x00, 0x04, 0xF5, 0xFC, 0x04, 0x01, 0x13,
+0x8F, 0x10, 0x00, 0x05, 0xF4, 0x4F, 0x50, 0x00, 0x09, 0xE1, 0x0B, 0xD4, 0x12, 0x7F, 0x70, 0x01,
+0x8D, 0xFE, 0xC5, 0x00, 0x33, 0xAE, 0x00, 0x00, 0x00, 0x1E, 0x90, 0x5F, 0x50, 0x00, 0x00, 0x6F,
+0x40, 0x0E, 0xA0, 0x00, 0x00, 0xBD, 0x00, 0x09, 0xF1, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF6, 0x00,
+0x07, 0xF2, 0x00, 0x00, 0xDC, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x7F, 0x20, 0x3F, 0x60, 0x00, 0x00,
+0x2F, 0x80, 0x9F, 0x10, 0x00, 0x00, 0x0B, 0xD0, 0xEA, 0x80, 0x32, 0x02, 0x05, 0xF8, 0xF4, 0x80,
+0x05, 0x02, 0x01, 0xEF, 0xE0, 0x80, 0x05, 0x04, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x5F, 0x5F, 0x40,
+0x00, 0x1F, 0xE0, 0x00, 0x06, 0xF3, 0x2F, 0x70, 0x00, 0x5E, 0xF2, 0x00, 0x0A, 0xE0, 0x0D, 0xB0,
+0x00, 0x9B, 0xD6, 0x00, 0x0E, 0xA0, 0x09, 0xE0, 0x00, 0xC7, 0x9A, 0x00, 0x2F, 0x70, 0x06, 0xF3,
+0x01, 0xF3, 0x6D, 0x00, 0x6F, 0x30, 0x02, 0xF7, 0x05, 0xE0, 0x2F, 0x20, 0x9E, 0x00, 0x00, 0xDA,
+0x08, 0xB0, 0x0E, 0x60, 0xDB, 0x00, 0x00, 0xAE, 0x0C, 0x80, 0x0A, 0x92, 0xF7, 0x00, 0x00, 0x6F,
+0x3F, 0x40, 0x07, 0xD5, 0xF3, 0x00, 0x00, 0x2F, 0xAF, 0x10, 0x03, 0xFA, 0xE0, 0x00, 0x00, 0x0E,
+0xFC, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0xBF, 0x70, 0x00, 0x1A, 0x0A,
+0xE2, 0x00, 0x00, 0xCD, 0x10, 0x01, 0xEA, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x6F, 0x50, 0x2F, 0x80,
+0x00, 0x00, 0x0B, 0xE1, 0xCD, 0x00, 0x00, 0x00, 0x02, 0xED, 0x80, 0x10, 0x03, 0x00, 0x00, 0x7F,
+0x90, 0x84, 0x05, 0x01, 0xCF, 0xD1, 0x80, 0x04, 0x02, 0x08, 0xF6, 0xF8, 0x80, 0x05, 0x03, 0x3F,
+0x80, 0x7F, 0x30, 0x80, 0x32, 0x08, 0x00, 0x0C, 0xC0, 0x00, 0x08, 0xF3, 0x00, 0x03, 0xF7, 0x80,
+0x10, 0x03, 0x00, 0x00, 0x8F, 0x30, 0x20, 0xBE, 0x10, 0x00, 0x03, 0xF7, 0x2E, 0xA0, 0x00, 0x0C,
+0xC0, 0x06, 0xF5, 0x00, 0x8F, 0x30, 0x00, 0xBE, 0x13, 0xF8, 0x00, 0x00, 0x2E, 0x9C, 0xC0, 0x00,
+0x00, 0x06, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xEB, 0x80, 0x03, 0x01, 0x00, 0xEA, 0xCC, 0x04, 0x01,
+0x1F, 0xFF, 0x80, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x80, 0x04, 0x02, 0x00, 0x2E,
+0xE3, 0x84, 0x05, 0x01, 0xCF, 0x60, 0x80, 0x04, 0x01, 0x08, 0xF9, 0x84, 0x0A, 0x01, 0x5F, 0xC1,
+0x80, 0x04, 0x02, 0x02, 0xEE, 0x20, 0x80, 0x05, 0x01, 0x0C, 0xF5, 0x84, 0x10, 0x01, 0x9F, 0x90,
+0x80, 0x04, 0x01, 0x05, 0xFC, 0x88, 0x2C, 0x00, 0xE2, 0x84, 0x05, 0x00, 0x4F, 0x84, 0x41, 0x00,
+0x40, 0x03, 0x9F, 0xFA, 0x9C, 0x00, 0xCC, 0x01, 0x01, 0x9F, 0xFA, 0x26, 0xD7, 0x00, 0x00, 0x8C,
+0x00, 0x00, 0x3F, 0x20, 0x00, 0x0E, 0x60, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF1, 0x00, 0x00, 0xE5,
+0x00, 0x00, 0xAA, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0x90, 0x00, 0x06, 0xE0,
+0x00, 0x02, 0xF3, 0x03, 0x7F, 0xFD, 0x00, 0x9D, 0xCC, 0x01, 0x01, 0x7F, 0xFD, 0x17, 0x00, 0x00,
+0x9F, 0xD2, 0x00, 0x00, 0x00, 0x09, 0xE6, 0xCE, 0x30, 0x00, 0x00, 0xAD, 0x30, 0x0A, 0xE3, 0x00,
+0x1B, 0xC1, 0x00, 0x00, 0x7E, 0x40, 0x04, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 0x05, 0x4F, 0x40, 0x06,
+0xD1, 0x00, 0x8B, 0x23, 0x6F, 0xFF, 0xDA, 0x20, 0x00, 0x00, 0x3B, 0xC0, 0x00, 0x00, 0x02, 0xF3,
+0x07, 0xDE, 0xFF, 0xF5, 0x9E, 0x41, 0x02, 0xF5, 0xE8, 0x00, 0x03, 0xF5, 0xE7, 0x00, 0x09, 0xF5,
+0xAD, 0x31, 0x6A, 0xF5, 0x1A, 0xEE, 0x92, 0xF5, 0x01, 0x8E, 0x00, 0x80, 0x00, 0xA0, 0x04, 0x12,
+0x2B, 0xED, 0x70, 0x00, 0x8E, 0xA4, 0x16, 0xF6, 0x00, 0x8F, 0x50, 0x00, 0x9D, 0x00, 0x8F, 0x00,
+0x00, 0x5F, 0x20, 0x80, 0x18, 0x01, 0x3F, 0x40, 0x88, 0x09, 0x80, 0x13, 0x03, 0x9E, 0x00, 0x8E,
+0xA3, 0x80, 0x1D, 0x88, 0x27, 0x11, 0x00, 0x3A, 0xEE, 0xB3, 0x03, 0xEA, 0x21, 0x49, 0x0B, 0xD0,
+0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x70, 0x8C, 0x07, 0x84, 0x0F, 0x84, 0x17, 0x84, 0x1F,
+0x04, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0xA0, 0x04, 0x14, 0x5D, 0xFC, 0x3B, 0xB0, 0x04, 0xF8, 0x13,
+0xBC, 0xB0, 0x0B, 0xC0, 0x00, 0x2F, 0xB0, 0x0F, 0x70, 0x00, 0x0D, 0xB0, 0x1F, 0x60, 0x80, 0x18,
+0x88, 0x09, 0x80, 0x1F, 0x00, 0x2F, 0x80, 0x1D, 0x01, 0x12, 0xAC, 0x8C, 0x27, 0x1F, 0x00, 0x3A,
+0xEF, 0xC4, 0x00, 0x03, 0xEA, 0x21, 0x7F, 0x30, 0x0B, 0xD0, 0x00, 0x0B, 0xA0, 0x0F, 0x80, 0x00,
+0x08, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x70, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x80, 0x04,
+0x80, 0x1D, 0x06, 0x27, 0x80, 0x00, 0x2A, 0xEF, 0xD8, 0x20, 0x0B, 0x00, 0x6D, 0xFE, 0x01, 0xF7,
+0x00, 0x04, 0xF3, 0x00, 0x9F, 0xFF, 0xF8, 0x80, 0x05, 0xC8, 0x02, 0x17, 0x00, 0x5D, 0xFC, 0x3B,
+0xB0, 0x04, 0xF8, 0x12, 0xAC, 0xB0, 0x0B, 0xB0, 0x00, 0x2F, 0xB0, 0x0F, 0x70, 0x00, 0x0D, 0xB0,
+0x1F, 0x60, 0x00, 0x0B, 0x8C, 0x09, 0x88, 0x13, 0x01, 0x04, 0xF7, 0x80, 0x1D, 0x80, 0x27, 0x10,
+0x3C, 0xA0, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x01, 0x93, 0x12, 0xAE, 0x20, 0x00, 0x6C, 0xEE, 0xB3,
+0x00, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x98, 0x03, 0x0E, 0x1A, 0xED, 0x60, 0x8E, 0xA4, 0x17, 0xF3,
+0x8F, 0x40, 0x00, 0xD9, 0x8F, 0x00, 0x00, 0xBB, 0x80, 0x13, 0x00, 0xAC, 0xB4, 0x03, 0x03, 0x7E,
+0x7E, 0x00, 0x7E, 0x94, 0x00, 0x01, 0x00, 0x7E, 0x80, 0x01, 0x00, 0x00, 0x88, 0x05, 0xAC, 0x01,
+0x04, 0x8D, 0x01, 0xCA, 0x4E, 0xB2, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x9C, 0x03, 0x0F, 0x06, 0xF7,
+0x8E, 0x00, 0x7F, 0x60, 0x8E, 0x08, 0xE5, 0x00, 0x8E, 0xAE, 0x40, 0x00, 0x8F, 0xEB, 0x80, 0x13,
+0x05, 0x4E, 0xA0, 0x00, 0x8E, 0x04, 0xEA, 0x80, 0x1B, 0x05, 0x3E, 0xA0, 0x8E, 0x00, 0x03, 0xEA,
+0x00, 0x7E, 0xA0, 0x00, 0x22, 0x8E, 0x1B, 0xED, 0x40, 0x4C, 0xFB, 0x20, 0x8E, 0xA3, 0x19, 0xE4,
+0x92, 0x2D, 0xA0, 0x8F, 0x40, 0x01, 0xFD, 0x00, 0x06, 0xF1, 0x8F, 0x00, 0x00, 0xEA, 0x00, 0x04,
+0xF3, 0x8E, 0x00, 0x00, 0xD9, 0x00, 0x03, 0xF4, 0x80, 0x06, 0x00, 0xD8, 0xD4, 0x06, 0x13, 0x8E,
+0x1A, 0xED, 0x60, 0x8E, 0xA4, 0x17, 0xF3, 0x8F, 0x40, 0x00, 0xD9, 0x8F, 0x00, 0x00, 0xBB, 0x8E,
+0x00, 0x00, 0xAC, 0xB4, 0x03, 0x18, 0x00, 0x4C, 0xEE, 0xA2, 0x00, 0x04, 0xF9, 0x12, 0xBE, 0x20,
+0x0C, 0xC0, 0x00, 0x1E, 0x90, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x1F, 0x70, 0x00, 0x0A, 0xE0, 0x88,
+0x09, 0x88, 0x13, 0x01, 0x04, 0xF8, 0x80, 0x1D, 0x04, 0x00, 0x4C, 0xFE, 0xB2, 0x00, 0x18, 0x8E,
+0x2B, 0xED, 0x70, 0x00, 0x8E, 0xA4, 0x16, 0xF6, 0x00, 0x8F, 0x50, 0x00, 0x9D, 0x00, 0x8F, 0x00,
+0x00, 0x5F, 0x20, 0x8E, 0x00, 0x00, 0x3F, 0x40, 0x88, 0x09, 0x80, 0x13, 0x03, 0x9E, 0x00, 0x8E,
+0xA3, 0x80, 0x1D, 0x8C, 0x27, 0x00, 0x00, 0x80, 0x00, 0x9C, 0x04, 0x17, 0x00, 0x5D, 0xFC, 0x3B,
+0xB0, 0x04, 0xF8, 0x13, 0xBC, 0xB0, 0x0B, 0xC0, 0x00, 0x2F, 0xB0, 0x0F, 0x70, 0x00, 0x0D, 0xB0,
+0x1F, 0x60, 0x00, 0x0B, 0x8C, 0x09, 0x01, 0x0B, 0xB0, 0x80, 0x13, 0x04, 0x04, 0xF8, 0x12, 0xAC,
+0xB0, 0x88, 0x27, 0x01, 0x00, 0x00, 0x80, 0x18, 0x9C, 0x04, 0x0C, 0x8E, 0x1A, 0xE9, 0x8E, 0xA4,
+0x00, 0x8F, 0x50, 0x00, 0x8F, 0x00, 0x00, 0x8E, 0xAC, 0x02, 0x23, 0x02, 0xAE, 0xEC, 0x50, 0x0C,
+0xB2, 0x13, 0xA1, 0x0F, 0x60, 0x00, 0x00, 0x0D, 0xD5, 0x10, 0x00, 0x02, 0xBF, 0xFC, 0x50, 0x00,
+0x01, 0x4A, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x2A, 0x41, 0x16, 0xF4, 0x04, 0xBE, 0xEC, 0x50, 0x02,
+0x08, 0xE0, 0x00, 0x80, 0x02, 0x02, 0x8F, 0xFF, 0xFD, 0x8C, 0x08, 0x98, 0x02, 0x08, 0x07, 0xE0,
+0x00, 0x05, 0xF4, 0x00, 0x00, 0x9E, 0xFD, 0x03, 0xAC, 0x00, 0x00, 0xBA, 0xB4, 0x03, 0x0F, 0x9D,
+0x00, 0x00, 0xDA, 0x7E, 0x10, 0x02, 0xFA, 0x2F, 0x91, 0x3A, 0xCA, 0x05, 0xDF, 0xB2, 0xBA, 0x2C,
+0x5F, 0x30, 0x00, 0x0B, 0xC0, 0x0E, 0x80, 0x00, 0x1F, 0x70, 0x09, 0xD0, 0x00, 0x7F, 0x10, 0x04,
+0xF4, 0x00, 0xCB, 0x00, 0x00, 0xD9, 0x02, 0xF5, 0x00, 0x00, 0x8E, 0x18, 0xE1, 0x00, 0x00, 0x2F,
+0x5D, 0x90, 0x00, 0x00, 0x0C, 0xDF, 0x40, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x3E, 0x3F, 0x40,
+0x06, 0xF8, 0x00, 0x2F, 0x40, 0x0E, 0x70, 0x0A, 0xEC, 0x00, 0x6F, 0x10, 0x0A, 0xB0, 0x0E, 0x8F,
+0x10, 0xAC, 0x00, 0x07, 0xF0, 0x3F, 0x1E, 0x40, 0xE8, 0x00, 0x03, 0xF4, 0x7C, 0x0B, 0x83, 0xF4,
+0x00, 0x00, 0xE8, 0xB8, 0x07, 0xC6, 0xF1, 0x00, 0x00, 0xAC, 0xE4, 0x03, 0xFB, 0xB0, 0x00, 0x00,
+0x6F, 0xF1, 0x00, 0xEF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xAF, 0x40, 0x00, 0x2C, 0x1D, 0xC0,
+0x00, 0x4F, 0x60, 0x03, 0xF8, 0x01, 0xEA, 0x00, 0x00, 0x7F, 0x4B, 0xD1, 0x00, 0x00, 0x0B, 0xFF,
+0x40, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0xCF, 0x70, 0x00, 0x00, 0xBD, 0x18, 0xF3,
+0x00, 0x07, 0xF4, 0x00, 0xCD, 0x10, 0x3F, 0x80, 0x00, 0x2E, 0x90, 0x2D, 0x5F, 0x30, 0x00, 0x0B,
+0xC0, 0x0E, 0x90, 0x00, 0x2F, 0x60, 0x08, 0xE0, 0x00, 0x8E, 0x10, 0x02, 0xF5, 0x00, 0xD9, 0x00,
+0x00, 0xBB, 0x04, 0xF3, 0x00, 0x00, 0x5F, 0x2A, 0xC0, 0x00, 0x00, 0x0D, 0x9F, 0x60, 0x00, 0x00,
+0x08, 0xFE, 0x10, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x84, 0x17, 0x09, 0x00, 0x1C, 0xB0,
+0x00, 0x00, 0x0B, 0xFC, 0x20, 0x00, 0x00, 0x18, 0x2F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x05, 0xF8,
+0x00, 0x00, 0x3E, 0xC0, 0x00, 0x01, 0xDD, 0x10, 0x00, 0x0B, 0xE3, 0x00, 0x00, 0x9F, 0x50, 0x00,
+0x06, 0x80, 0x11, 0x04, 0x3F, 0xB0, 0x00, 0x00, 0x5F, 0x80, 0x1F, 0x0D, 0x00, 0x19, 0xEF, 0x30,
+0x00, 0x6F, 0x40, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8D, 0x90, 0x03, 0x08, 0xAC, 0x00, 0x00,
+0x03, 0xE9, 0x00, 0x00, 0xFF, 0xC1, 0x8C, 0x07, 0x01, 0x00, 0x9C, 0xA0, 0x1B, 0x84, 0x27, 0x84,
+0x2F, 0x02, 0x1A, 0xEF, 0x30, 0x00, 0xF5, 0xB0, 0x00, 0x09, 0xFE, 0xB2, 0x00, 0x00, 0x02, 0xE9,
+0x00, 0x00, 0x00, 0xBB, 0x80, 0x03, 0x00, 0xAB, 0x90, 0x03, 0x00, 0xAC, 0x80, 0x03, 0x09, 0x6F,
+0x50, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0x6F, 0x40, 0x8C, 0x0F, 0x94, 0x1B, 0x80, 0x27, 0x84,
+0x2F, 0x84, 0x37, 0x0D, 0x07, 0xCE, 0xD9, 0x41, 0x16, 0xA0, 0x4A, 0x30, 0x37, 0xCE, 0xDA, 0x20,
+0x10, 0x00, 0x84, 0x00};
@@ -223,751 +223,475 @@ uint16_t levelW = 216;
 #define xyToLvlIdx(x, y) (((y)/8)*levelW + (x)/8)
 
 const uint8_t tiles_0_data[] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x15, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x15, 0x00, 
-0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x00, 0x7F, 0xFE, 0x5F, 0xFA, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 
+0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x5F, 0xFA, 0x7F, 0xFE, 0x00, 0x00};
+
+const uint16_t tiles_0_data_palette[] = {
+0x0000, 0x20B2};
 
 const uint8_t tiles_1_data[] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x0C, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x00, 0x6F, 0x0C, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x0C, 0x0C, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x00, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x00, 
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x11, 0x5A, 0x95, 0x44, 0x15, 0x6A, 0xA5, 0x54, 
+0x15, 0xA0, 0x28, 0x54, 0x15, 0xA1, 0x68, 0x54, 0x15, 0xA1, 0x68, 0x54, 0x15, 0x41, 0xA8, 0x54, 
+0x15, 0x56, 0xA0, 0x54, 0x15, 0x56, 0x81, 0x54, 0x15, 0x55, 0x05, 0x54, 0x15, 0x56, 0x95, 0x54, 
+0x15, 0x56, 0x85, 0x54, 0x11, 0x55, 0x05, 0x44, 0x15, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00};
+
+const uint16_t tiles_1_data_palette[] = {
+0x0000, 0x8AFD, 0x0089};
 
 const uint8_t tiles_2_data[] = {
-0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 
-0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 
-0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 
-0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 
-0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x01, 0x00, 0x01, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x55, 0x55, 0x55, 0x55, 
+0x01, 0x00, 0x01, 0x00, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0x55, 0x55, 0x55, 0x55, 
+0x00, 0x01, 0x00, 0x01, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x55, 0x55, 0x55, 0x55, 
+0x01, 0x00, 0x01, 0x00, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0x55, 0x55, 0x55, 0x55};
+
+const uint16_t tiles_2_data_palette[] = {
+0x8AFD, 0x0000, 0x20B2};
 
 const uint8_t tiles_3_data[] = {
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x6F, 0x6F, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 
-0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15};
+0x15, 0x55, 0x51, 0x54, 0x6A, 0xAA, 0xA1, 0xA8, 0x6A, 0xAA, 0x86, 0xA8, 0x6A, 0xAA, 0x86, 0xA8, 
+0x6A, 0xAA, 0x80, 0x00, 0x6A, 0xAA, 0x85, 0x54, 0x6A, 0xAA, 0x86, 0xA8, 0x42, 0xAA, 0x86, 0xA8, 
+0x54, 0x2A, 0x1A, 0xA8, 0x69, 0x40, 0x1A, 0xA8, 0x6A, 0x95, 0x1A, 0xA8, 0x6A, 0xAA, 0x1A, 0xA8, 
+0x6A, 0xA8, 0x6A, 0xA8, 0x6A, 0xA8, 0x6A, 0xA8, 0x6A, 0xA8, 0x6A, 0xA8, 0x40, 0x00, 0x00, 0x02};
+
+const uint16_t tiles_3_data_palette[] = {
+0x0000, 0x8AFD, 0x20B2};
 
 const uint8_t tiles_4_data[] = {
-0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 
-0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x0C, 
-0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x00, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x00, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0C, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x6F, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x0C, 
-0x6F, 0x6F, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 
-0x6F, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 
-0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00};
+0x15, 0x55, 0x55, 0x54, 0x45, 0x55, 0x55, 0x52, 0x51, 0x55, 0x55, 0x4A, 0x54, 0x55, 0x55, 0x2A, 
+0x55, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0xAA, 
+0x55, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0xAA, 
+0x54, 0xAA, 0xAA, 0x2A, 0x52, 0xAA, 0xAA, 0x8A, 0x4A, 0xAA, 0xAA, 0xA2, 0x2A, 0xAA, 0xAA, 0xA8};
+
+const uint16_t tiles_4_data_palette[] = {
+0x0000, 0x8AFD, 0x0089, 0x20B2};
 
 const uint8_t tiles_5_data[] = {
-0xC7, 0x00, 0x18, 0x18, 0x28, 0x28, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x30, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x28, 0x30, 0x28, 0x28, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x28, 0x28, 0x30, 0x28, 0x30, 0x18, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x28, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x28, 0x28, 0x18, 0x30, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x18, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x18, 0x28, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x18, 0x28, 0x28, 0x28, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x28, 0x18, 0x30, 0x28, 0x30, 0x28, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x18, 0x18, 0x28, 0x18, 0x30, 0x30, 0x28, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x18, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x30, 0x30, 0x30, 0x30};
+0x01, 0x22, 0x33, 0x22, 0x23, 0x32, 0x34, 0x44, 0x01, 0x22, 0x23, 0x22, 0x32, 0x22, 0x34, 0x33, 
+0x01, 0x22, 0x23, 0x22, 0x33, 0x34, 0x34, 0x24, 0x01, 0x22, 0x22, 0x33, 0x33, 0x22, 0x44, 0x44, 
+0x01, 0x23, 0x22, 0x23, 0x23, 0x33, 0x24, 0x44, 0x01, 0x22, 0x22, 0x32, 0x22, 0x32, 0x23, 0x24, 
+0x01, 0x22, 0x23, 0x22, 0x32, 0x22, 0x23, 0x44, 0x01, 0x22, 0x23, 0x22, 0x23, 0x23, 0x33, 0x34, 
+0x01, 0x22, 0x22, 0x22, 0x33, 0x23, 0x33, 0x23, 0x01, 0x22, 0x22, 0x33, 0x23, 0x23, 0x33, 0x44, 
+0x01, 0x22, 0x22, 0x32, 0x33, 0x24, 0x34, 0x34, 0x01, 0x22, 0x23, 0x32, 0x22, 0x32, 0x44, 0x34, 
+0x01, 0x22, 0x23, 0x33, 0x22, 0x33, 0x33, 0x33, 0x01, 0x22, 0x23, 0x33, 0x23, 0x33, 0x32, 0x44, 
+0x01, 0x22, 0x22, 0x23, 0x32, 0x33, 0x33, 0x34, 0x01, 0x22, 0x23, 0x22, 0x22, 0x32, 0x44, 0x44};
+
+const uint16_t tiles_5_data_palette[] = {
+0x1FF8, 0x0000, 0x4003, 0x8005, 0xA006};
 
 const uint8_t tiles_6_data[] = {
-0x30, 0x28, 0x28, 0x30, 0x28, 0x30, 0x30, 0x38, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x30, 0x28, 0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x00, 0xC7, 
-0x30, 0x30, 0x28, 0x30, 0x38, 0x28, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x28, 0x38, 0x28, 0x30, 0x30, 0x28, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x30, 0x30, 0x30, 0x38, 0x30, 0x28, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x30, 0x28, 0x38, 0x28, 0x28, 0x30, 0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x30, 0x30, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x28, 0x30, 0x28, 0x28, 0x38, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x30, 0x28, 0x38, 0x30, 0x38, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x28, 0x30, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x30, 0x28, 0x38, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x28, 0x30, 0x28, 0x30, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7};
+0x01, 0x10, 0x10, 0x02, 0x20, 0x22, 0x22, 0x34, 0x00, 0x11, 0x10, 0x02, 0x02, 0x02, 0x02, 0x34, 
+0x00, 0x10, 0x21, 0x00, 0x22, 0x22, 0x22, 0x34, 0x11, 0x00, 0x20, 0x02, 0x22, 0x22, 0x22, 0x34, 
+0x01, 0x21, 0x00, 0x10, 0x00, 0x02, 0x22, 0x34, 0x10, 0x00, 0x20, 0x12, 0x00, 0x22, 0x22, 0x34, 
+0x00, 0x02, 0x02, 0x00, 0x02, 0x22, 0x22, 0x34, 0x10, 0x00, 0x00, 0x02, 0x02, 0x22, 0x22, 0x34, 
+0x10, 0x12, 0x11, 0x02, 0x20, 0x02, 0x22, 0x34, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x22, 0x34, 
+0x01, 0x01, 0x12, 0x00, 0x02, 0x02, 0x22, 0x34, 0x00, 0x12, 0x02, 0x20, 0x20, 0x20, 0x22, 0x34, 
+0x11, 0x00, 0x02, 0x22, 0x20, 0x02, 0x22, 0x34, 0x10, 0x12, 0x00, 0x20, 0x00, 0x00, 0x22, 0x34, 
+0x01, 0x01, 0x02, 0x00, 0x20, 0x20, 0x22, 0x34, 0x11, 0x00, 0x20, 0x00, 0x20, 0x20, 0x22, 0x34};
+
+const uint16_t tiles_6_data_palette[] = {
+0xA006, 0x8005, 0xE007, 0x0000, 0x1FF8};
 
 const uint8_t tiles_7_data[] = {
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x18, 0x28, 0x28, 0x30, 
-0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x30, 0x18, 0x30, 0x28, 0x30, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x18, 0x28, 0x30, 0x28, 0x18, 0x18, 0x30, 0x28, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x28, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x18, 0x18, 0x30, 0x28, 0x30, 0x30, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x30, 0x18, 0x28, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x28, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x18, 0x28, 0x28, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x30, 0x18, 0x28, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x18, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x18, 0x30, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x18, 0x28, 0x28, 0x28, 0x28, 0x28, 0x30, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x18, 0x30, 0x30, 0x30, 0x30};
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x01, 0x12, 0x00, 0x00, 0x10, 0x00, 0x00, 0x12, 0x02, 0x12, 
+0x00, 0x00, 0x01, 0x01, 0x01, 0x21, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 
+0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x21, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x12, 0x01, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x11, 
+0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00, 0x00, 0x01, 0x00, 0x11, 0x11, 0x10, 0x11, 
+0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x12, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
+0x43, 0x00, 0x01, 0x11, 0x00, 0x11, 0x11, 0x11, 0x43, 0x00, 0x01, 0x11, 0x01, 0x11, 0x10, 0x22, 
+0x43, 0x00, 0x00, 0x01, 0x10, 0x11, 0x11, 0x12, 0x43, 0x00, 0x01, 0x00, 0x00, 0x10, 0x22, 0x22};
+
+const uint16_t tiles_7_data_palette[] = {
+0x4003, 0x8005, 0xA006, 0x0000, 0x1FF8};
 
 const uint8_t tiles_8_data[] = {
-0x28, 0x30, 0x28, 0x38, 0x30, 0x38, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x38, 
-0x30, 0x28, 0x30, 0x30, 0x28, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x28, 0x28, 0x28, 0x38, 0x30, 0x38, 0x38, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x28, 0x30, 0x28, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x30, 0x28, 0x30, 0x28, 0x30, 0x30, 0x30, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x30, 0x30, 0x28, 0x30, 0x28, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x38, 
-0x30, 0x30, 0x30, 0x38, 0x28, 0x28, 0x30, 0x30, 0x38, 0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 
-0x30, 0x28, 0x30, 0x28, 0x28, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 
-0x28, 0x28, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 
-0x30, 0x30, 0x30, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x30, 0x30, 0x30, 0x30, 0x28, 0x30, 0x30, 0x30, 0x38, 0x38, 0x30, 0x38, 0x38, 0x30, 0x38, 0x38, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x28, 0x28, 0x30, 0x30, 0x30, 0x38, 0x38, 0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x30, 0x28, 0x38, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x00, 0xC7, 
-0x30, 0x28, 0x30, 0x28, 0x30, 0x38, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7, 
-0x28, 0x28, 0x30, 0x30, 0x38, 0x30, 0x30, 0x30, 0x38, 0x30, 0x38, 0x30, 0x38, 0x38, 0x00, 0xC7};
+0x01, 0x02, 0x12, 0x01, 0x12, 0x11, 0x21, 0x22, 0x10, 0x11, 0x02, 0x11, 0x22, 0x22, 0x22, 0x22, 
+0x00, 0x02, 0x12, 0x22, 0x12, 0x12, 0x22, 0x22, 0x01, 0x01, 0x21, 0x11, 0x11, 0x12, 0x22, 0x22, 
+0x10, 0x10, 0x11, 0x12, 0x11, 0x22, 0x22, 0x22, 0x11, 0x01, 0x02, 0x12, 0x22, 0x22, 0x22, 0x12, 
+0x11, 0x12, 0x00, 0x11, 0x22, 0x21, 0x12, 0x22, 0x10, 0x10, 0x02, 0x22, 0x22, 0x22, 0x11, 0x22, 
+0x00, 0x11, 0x11, 0x22, 0x11, 0x21, 0x22, 0x22, 0x11, 0x10, 0x11, 0x21, 0x11, 0x12, 0x22, 0x22, 
+0x11, 0x11, 0x01, 0x11, 0x22, 0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
+0x00, 0x11, 0x12, 0x22, 0x21, 0x12, 0x22, 0x34, 0x01, 0x02, 0x11, 0x21, 0x11, 0x11, 0x22, 0x34, 
+0x10, 0x10, 0x12, 0x11, 0x21, 0x21, 0x22, 0x34, 0x00, 0x11, 0x21, 0x11, 0x21, 0x21, 0x22, 0x34};
+
+const uint16_t tiles_8_data_palette[] = {
+0x8005, 0xA006, 0xE007, 0x0000, 0x1FF8};
 
 const uint8_t tiles_9_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x0C, 0x6F, 0x18, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x18, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x18, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x80, 0x00, 0x00, 0x55, 0x60, 0x00, 0x01, 0x5D, 0x58, 0x00, 
+0x01, 0x76, 0x58, 0x00, 0x05, 0xD5, 0x96, 0x00, 0x05, 0xD5, 0x96, 0x00, 0x05, 0xD5, 0x96, 0x00, 
+0x05, 0xD5, 0x96, 0x00, 0x05, 0xD5, 0x96, 0x00, 0x05, 0xD5, 0x96, 0x00, 0x01, 0x76, 0x58, 0x00, 
+0x01, 0x59, 0x58, 0x00, 0x00, 0x55, 0x60, 0x00, 0x00, 0x15, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+const uint16_t tiles_9_data_palette[] = {
+0x1FF8, 0x8AFD, 0x4003, 0x0089};
 
 const uint8_t tiles_10_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18};
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x6A, 
+0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x1A, 0xAA, 0x00, 0x00, 0x6A, 0xAA, 
+0x00, 0x01, 0xAA, 0xAA, 0x00, 0x06, 0xAA, 0xAA, 0x00, 0x1A, 0xAA, 0xAA, 0x00, 0x6A, 0xAA, 0xAA, 
+0x01, 0xAA, 0xAA, 0xAA, 0x06, 0xAA, 0xAA, 0xAA, 0x1A, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA};
+
+const uint16_t tiles_10_data_palette[] = {
+0x1FF8, 0x0000, 0x4003};
 
 const uint8_t tiles_11_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 
-0xC7, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 
-0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x5A, 0xA5, 0x00, 
+0x01, 0xAA, 0xAA, 0x40, 0x06, 0xAA, 0xAA, 0x90, 0x1A, 0xAA, 0xAA, 0xA4, 0x6A, 0xAA, 0xAA, 0xA9};
+
+const uint16_t tiles_11_data_palette[] = {
+0x1FF8, 0x0000, 0x4003};
 
 const uint8_t tiles_12_data[] = {
-0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xC7, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00};
+0x15, 0x55, 0x55, 0x55, 0x85, 0x55, 0x55, 0x55, 0xA1, 0x55, 0x55, 0x55, 0xA8, 0x55, 0x55, 0x55, 
+0xAA, 0x15, 0x55, 0x55, 0xAA, 0x85, 0x55, 0x55, 0xAA, 0xA1, 0x55, 0x55, 0xAA, 0xA8, 0x55, 0x55, 
+0xAA, 0xAA, 0x15, 0x55, 0xAA, 0xAA, 0x85, 0x55, 0xAA, 0xAA, 0xA1, 0x55, 0xAA, 0xAA, 0xA8, 0x55, 
+0xAA, 0xAA, 0xAA, 0x15, 0xAA, 0xAA, 0xAA, 0x85, 0xAA, 0xAA, 0xAA, 0xA1, 0xAA, 0xAA, 0xAA, 0xA8};
+
+const uint16_t tiles_12_data_palette[] = {
+0x0000, 0x1FF8, 0x4003};
 
 const uint8_t tiles_13_data[] = {
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+const uint16_t tiles_13_data_palette[] = {
+0x4003};
 
 const uint8_t tiles_14_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0x00, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xC7, 0xC7, 0x00, 0xFF, 0xE1, 0xE1, 0xE1, 0xFF, 0xE1, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 
-0xC7, 0xC7, 0xC7, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0xFF, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0xA5, 0x00, 0x00, 0x1A, 0xAA, 
+0x00, 0x50, 0x6A, 0xAA, 0x01, 0xA5, 0xAA, 0xAA, 0x06, 0xAA, 0xAA, 0xAA, 0x06, 0xAA, 0xAA, 0xAA, 
+0x1A, 0xAA, 0xAA, 0xAA, 0x1A, 0xAA, 0xAA, 0xAA, 0x1A, 0xAA, 0xAA, 0xAA, 0x1B, 0xAB, 0xAA, 0xAA, 
+0x06, 0xFE, 0xFA, 0xAF, 0x01, 0xA9, 0xAF, 0xFA, 0x00, 0x54, 0x5A, 0xA5, 0x00, 0x00, 0x05, 0x50};
+
+const uint16_t tiles_14_data_palette[] = {
+0x1FF8, 0x0000, 0xFFFF, 0x7F24};
 
 const uint8_t tiles_15_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x00, 0xC7, 
-0xE1, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xE1, 0xFF, 0xE1, 0xE1, 0xE1, 0xFF, 0x00, 0xC7, 0xC7, 
-0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xE1, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xC7, 0xC7, 0xC7, 
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0xAA, 0xA4, 0x00, 0x00, 
+0xAA, 0xA9, 0x05, 0x00, 0xAA, 0xAA, 0x5A, 0x40, 0xAA, 0xAA, 0xAA, 0x90, 0xAA, 0xAA, 0xAA, 0x90, 
+0xAA, 0xAA, 0xAA, 0xA4, 0xAA, 0xAA, 0xAA, 0xA4, 0xAA, 0xAA, 0xAA, 0xA4, 0xAA, 0xAA, 0xEA, 0xE4, 
+0xFA, 0xAF, 0xBF, 0x90, 0xAF, 0xFA, 0x6A, 0x40, 0x5A, 0xA5, 0x15, 0x00, 0x05, 0x50, 0x00, 0x00};
+
+const uint16_t tiles_15_data_palette[] = {
+0x1FF8, 0x0000, 0xFFFF, 0x7F24};
 
 const uint8_t tiles_16_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
+0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x56, 0xAA, 
+0x00, 0x01, 0xAA, 0xAA, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x6A, 0xAA};
+
+const uint16_t tiles_16_data_palette[] = {
+0x1FF8, 0x0000, 0xE007};
 
 const uint8_t tiles_17_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0x00, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x38, 0x00, 0xC7, 0xC7, 
-0xC7, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 
-0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 
-0x38, 0x38, 0x38, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38};
+0x00, 0x15, 0x40, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x05, 0xAA, 0xA4, 0x00, 0x1A, 0xAA, 0xA4, 0x40, 
+0x1A, 0xAA, 0xA9, 0x90, 0x1A, 0xAA, 0xAA, 0xA4, 0x6A, 0xAA, 0x6A, 0xA4, 0xAA, 0x5A, 0x9A, 0xA5, 
+0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
+
+const uint16_t tiles_17_data_palette[] = {
+0x1FF8, 0x0000, 0xE007};
 
 const uint8_t tiles_18_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x00, 0xC7, 0x00, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x38, 0x00, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 0x46, 0x40, 0x00, 0x00, 0x9A, 0x40, 0x00, 0x00, 0xAA, 0x44, 0x00, 0x00, 
+0xAA, 0x99, 0x00, 0x00, 0xAA, 0xA9, 0x00, 0x00, 0xAA, 0xA9, 0x00, 0x00, 0xAA, 0xA4, 0x00, 0x00};
+
+const uint16_t tiles_18_data_palette[] = {
+0x1FF8, 0x0000, 0xE007};
 
 const uint8_t tiles_19_data[] = {
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x01, 0x00, 0x01, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x55, 0x55, 0x55, 0x55, 
+0x01, 0x00, 0x01, 0x00, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0x55, 0x55, 0x55, 0x55, 
+0x00, 0x01, 0x00, 0x01, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x55, 0x55, 0x55, 0x55, 
+0x01, 0x00, 0x01, 0x00, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0x55, 0x55, 0x55, 0x55};
+
+const uint16_t tiles_19_data_palette[] = {
+0x60D4, 0x0000, 0x208A};
 
 const uint8_t tiles_20_data[] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+const uint16_t tiles_20_data_palette[] = {
+0x0000};
+
 const uint8_t tiles_21_data[] = {
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x26, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
-0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x01, 0x40, 0x01, 0x2A, 0x95, 0x56, 0xA9, 0x29, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 
+0x15, 0x55, 0x55, 0x54, 0x95, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+
+const uint16_t tiles_21_data_palette[] = {
+0x60D4, 0x0000, 0x208A};
 
 const uint8_t tiles_22_data[] = {
-0x26, 0x26, 0x26, 0x26, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x26, 0x26, 0x26,
-0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x26, 0x14, 0x14, 0x14,
-0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x23, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 
+0x22, 0x23, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x23, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 
+0x22, 0x23, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x23, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 
+0x22, 0x23, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x02, 0x22, 0x22, 0x24, 0x02, 0x22, 0x22, 0x24, 
+0x02, 0x22, 0x22, 0x24, 0x02, 0x22, 0x22, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
+0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x22, 0x24, 0x02, 0x22, 0x22, 0x24, 0x02, 0x22, 
+0x22, 0x24, 0x02, 0x22, 0x22, 0x24, 0x02, 0x22, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44};
+
+const uint16_t tiles_22_data_palette[] = {
+0x60D4, 0x1FF8, 0x208A, 0x0069, 0x0000};
 
 const uint8_t tiles_23_data[] = {
-0x26, 0x26, 0x26, 0x26, 0x14, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x14, 0x26, 0x26, 0x26, 0x26,
-0x14, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x14, 0x00, 0x26, 0x14, 0x14, 0x0B, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x26, 0x14, 0x14, 0x0B, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x0B, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x42, 0x01, 0x00, 0x57, 0xF6, 0x17, 0x15, 0x57, 0xFE, 0x17, 0x15, 0x57, 0xAA, 0xAA, 0x15, 
+0x57, 0x55, 0x56, 0x15, 0x57, 0x7F, 0xFE, 0x15, 0x57, 0x7F, 0xFE, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x00, 0x02, 0x00, 0x02, 0x15, 0x56, 0x15, 0x56, 0x15, 0x56, 0x15, 0x56, 0xAA, 0xAA, 0xAA, 0xAA, 
+0x02, 0x00, 0x02, 0x00, 0x56, 0x15, 0x56, 0x15, 0x56, 0x15, 0x56, 0x15, 0xAA, 0xAA, 0xAA, 0xAA};
+
+const uint16_t tiles_23_data_palette[] = {
+0x60D4, 0x208A, 0x0000, 0x0069};
 
 const uint8_t tiles_24_data[] = {
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x01, 0x55, 0x55, 0x2A, 0xA9, 0x55, 0x55, 0x2A, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+0x01, 0x00, 0x55, 0x55, 0xA9, 0x2A, 0x55, 0x55, 0xA9, 0x2A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+0x00, 0x01, 0x55, 0x55, 0x2A, 0xA9, 0x55, 0x55, 0x2A, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+0x01, 0x00, 0x55, 0x55, 0xA9, 0x2A, 0x55, 0x55, 0xA9, 0x2A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+
+const uint16_t tiles_24_data_palette[] = {
+0x60D4, 0x0000, 0x208A};
 
 const uint8_t tiles_25_data[] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x00, 0x26, 0x26, 0x26, 0x26,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x26, 0x14, 0x14, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x6A, 0xA8, 0x00, 0x00, 0x6A, 0xA8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0xA8, 0x6A, 0x00, 0x00, 0xA8, 0x6A, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x6A, 0xA8, 0x00, 0x00, 0x6A, 0xA8, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0xA8, 0x6A, 0x00, 0x00, 0xA8, 0x6A, 0x00, 0x00, 0x00, 0x00};
+
+const uint16_t tiles_25_data_palette[] = {
+0x0000, 0x60D4, 0x208A};
 
 const uint8_t tiles_26_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 
+0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 
+0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 
+0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xB0, 0x00};
+
+const uint16_t tiles_26_data_palette[] = {
+0x1FF8, 0x94B5, 0xB4B6, 0xFFFF};
 
 const uint8_t tiles_27_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x30, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x30, 0xFF, 0x38, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x30, 0x38, 0x38, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x28, 0x30, 0x30, 0x30, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x28, 0x28, 0x28, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7,
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xAD, 0xB5, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x00, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x41, 0x20, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x14, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x20, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00};
+
+const uint16_t tiles_27_data_palette[] = {
+0x1FF8, 0xA006, 0x8005, 0xFFFF, 0xE007, 0x94B5, 0xB4B6};
 
 const uint8_t tiles_28_data[] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+const uint16_t tiles_28_data_palette[] = {
+0xFFFF};
 
 const ImageDesc tiles[] = {
-{16, 16, 8, {.img8 = tiles_0_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_1_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_2_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_3_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_4_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_5_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_6_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_7_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_8_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_9_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_10_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_11_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_12_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_13_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_14_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_15_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_16_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_17_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_18_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_19_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_20_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_21_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_22_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_23_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_24_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_25_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_26_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_27_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = tiles_28_data}, PALETTE_884, COLOR_MAGENTA}};
+{16, 16, 1, {.img8 = tiles_0_data}, tiles_0_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_1_data}, tiles_1_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_2_data}, tiles_2_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_3_data}, tiles_3_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_4_data}, tiles_4_data_palette, COLOR_MAGENTA},
+{16, 16, 4, {.img8 = tiles_5_data}, tiles_5_data_palette, COLOR_MAGENTA},
+{16, 16, 4, {.img8 = tiles_6_data}, tiles_6_data_palette, COLOR_MAGENTA},
+{16, 16, 4, {.img8 = tiles_7_data}, tiles_7_data_palette, COLOR_MAGENTA},
+{16, 16, 4, {.img8 = tiles_8_data}, tiles_8_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_9_data}, tiles_9_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_10_data}, tiles_10_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_11_data}, tiles_11_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_12_data}, tiles_12_data_palette, COLOR_MAGENTA},
+{16, 16, 1, {.img8 = tiles_13_data}, tiles_13_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_14_data}, tiles_14_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_15_data}, tiles_15_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_16_data}, tiles_16_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_17_data}, tiles_17_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_18_data}, tiles_18_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_19_data}, tiles_19_data_palette, COLOR_MAGENTA},
+{16, 16, 1, {.img8 = tiles_20_data}, tiles_20_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_21_data}, tiles_21_data_palette, COLOR_MAGENTA},
+{16, 16, 4, {.img8 = tiles_22_data}, tiles_22_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_23_data}, tiles_23_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_24_data}, tiles_24_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_25_data}, tiles_25_data_palette, COLOR_MAGENTA},
+{16, 16, 2, {.img8 = tiles_26_data}, tiles_26_data_palette, COLOR_MAGENTA},
+{16, 16, 4, {.img8 = tiles_27_data}, tiles_27_data_palette, COLOR_MAGENTA},
+{16, 16, 1, {.img8 = tiles_28_data}, tiles_28_data_palette, COLOR_MAGENTA}};
 
 const uint8_t gario_0_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x05, 0x80, 0x05, 0x80, 0x6F, 0x6F, 0x6F, 0xC7, 
-0x6F, 0x6F, 0x6F, 0x80, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x80, 0x80, 0x6F, 0x6F, 0xC7, 
-0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x7F, 0x05, 0xC7, 0xC7, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5C, 0x00, 0x64, 0x00, 
+0x6E, 0x00, 0x7F, 0x00, 0x91, 0x00, 0xA0, 0x00, 0xAC, 0x00, 0xB9, 0x00, 0xC7, 0x00, 0xCD, 0x00, 
+0xD1, 0x00, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x06, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x04, 0x09, 0x15, 0x6F, 0x15, 0x6F, 
+0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x04, 0x0A, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 
+0x6F, 0x04, 0x09, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x06, 0x06, 0x6F, 0x6F, 
+0x6F, 0x6F, 0x6F, 0x6F, 0x02, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x00, 0x0F, 
+0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x05, 0x80, 0x05, 0x80, 0x6F, 0x6F, 0x6F, 0x00, 
+0x04, 0x6F, 0x6F, 0x6F, 0x80, 0x01, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x80, 0x80, 0x6F, 
+0x6F, 0x00, 0x02, 0x6F, 0x6F, 0x03, 0x06, 0x05, 0x05, 0x05, 0x05, 0x7F, 0x05, 0x02, 0x01, 0x15, 
+0x04, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x03, 0x0B, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x02, 0x0C, 0x15, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x01, 0x04, 0x15, 0x15, 0x15, 0x15, 0x01, 0x02, 0x15, 
+0x15};
 
 const uint8_t gario_1_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x05, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5C, 0x00, 0x64, 0x00, 
+0x6B, 0x00, 0x74, 0x00, 0x7E, 0x00, 0x88, 0x00, 0x91, 0x00, 0x99, 0x00, 0x9F, 0x00, 0xA6, 0x00, 
+0xAE, 0x00, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x06, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x04, 0x09, 0x15, 0x6F, 0x15, 0x6F, 
+0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x04, 0x0A, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 
+0x6F, 0x04, 0x09, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x06, 0x06, 0x6F, 0x6F, 
+0x6F, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0x80, 0x80, 0x05, 0x80, 0x80, 0x04, 0x07, 0x80, 0x80, 0x80, 
+0x80, 0x05, 0x80, 0x05, 0x04, 0x08, 0x80, 0x80, 0x80, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0x04, 0x08, 
+0x80, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x06, 0x80, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0x06, 0x04, 0x6F, 0x6F, 0x05, 0x05, 0x06, 
+0x05, 0x15, 0x15, 0x15, 0x15, 0x15, 0x06, 0x06, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15};
 
 const uint8_t gario_2_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x05, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x15, 0x15, 0x05, 0x05, 0x05, 0xC7, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x22, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5C, 0x00, 
+0x64, 0x00, 0x6C, 0x00, 0x76, 0x00, 0x81, 0x00, 0x8B, 0x00, 0x95, 0x00, 0xA0, 0x00, 0xAC, 0x00, 
+0xB5, 0x00, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x06, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x04, 0x09, 0x15, 0x6F, 0x15, 0x6F, 
+0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x04, 0x0A, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 
+0x6F, 0x04, 0x09, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x06, 0x06, 0x6F, 0x6F, 
+0x6F, 0x6F, 0x6F, 0x6F, 0x06, 0x06, 0x80, 0x80, 0x80, 0x80, 0x05, 0x6F, 0x05, 0x08, 0x80, 0x80, 
+0x80, 0x80, 0x80, 0x6F, 0x6F, 0x6F, 0x03, 0x09, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6F, 
+0x6F, 0x03, 0x08, 0x6F, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x08, 0x15, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x09, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x01, 0x05, 0x15, 0x15, 0x05, 0x05, 0x05, 0x01, 0x03, 0x05, 0x05, 0x05, 0x01, 0x01, 0x15, 0x05, 
+0x04, 0x15, 0x15, 0x15, 0x15};
 
 const uint8_t gario_3_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x05, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x80, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5C, 0x00, 0x64, 0x00, 
+0x6B, 0x00, 0x74, 0x00, 0x7E, 0x00, 0x88, 0x00, 0x91, 0x00, 0x99, 0x00, 0x9F, 0x00, 0xA6, 0x00, 
+0xAE, 0x00, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x06, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x04, 0x09, 0x15, 0x6F, 0x15, 0x6F, 
+0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x04, 0x0A, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 
+0x6F, 0x04, 0x09, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x06, 0x06, 0x6F, 0x6F, 
+0x6F, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0x80, 0x80, 0x05, 0x80, 0x80, 0x04, 0x07, 0x80, 0x80, 0x80, 
+0x80, 0x05, 0x80, 0x05, 0x04, 0x08, 0x80, 0x80, 0x80, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0x04, 0x08, 
+0x80, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x06, 0x80, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0x06, 0x04, 0x6F, 0x6F, 0x05, 0x05, 0x06, 
+0x05, 0x15, 0x15, 0x15, 0x15, 0x15, 0x06, 0x06, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15};
 
 const uint8_t gario_4_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x05, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x80, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x6F, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x6F, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x2A, 0x00, 0x35, 0x00, 0x3F, 0x00, 0x4D, 0x00, 0x5C, 0x00, 0x69, 0x00, 0x74, 0x00, 
+0x7E, 0x00, 0x8A, 0x00, 0x97, 0x00, 0xA4, 0x00, 0xAF, 0x00, 0xB9, 0x00, 0xC1, 0x00, 0xC9, 0x00, 
+0xD0, 0x00, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x08, 0x15, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x02, 
+0x0C, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x02, 0x0D, 0x6F, 
+0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x03, 0x0B, 0x6F, 0x6F, 
+0x05, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x04, 0x09, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x80, 0x6F, 0x6F, 0x03, 0x08, 0x05, 0x05, 0x6F, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x03, 0x0A, 
+0x05, 0x05, 0x6F, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x0B, 0x05, 0x05, 0x05, 0x6F, 
+0x6F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x05, 0x80, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x04, 0x09, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 
+0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 
+0x05, 0x04, 0x06, 0x15, 0x15, 0x15, 0x05, 0x05, 0x05, 0x03, 0x05, 0x15, 0x15, 0x15, 0x15, 0x15};
 
 const uint8_t gario_5_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x6F, 0x6F, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x80, 0x80, 0x80, 0x80, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x80, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x05, 0x80, 0x80, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x05, 0x80, 0xC7, 0xC7, 0xC7, 0xC7, 
-0x6F, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0x15, 0xC7, 
-0x6F, 0x6F, 0x6F, 0x80, 0x80, 0x80, 0x05, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0x05, 0x15, 0x15, 0xC7, 
-0xC7, 0x6F, 0x15, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 
-0xC7, 0xC7, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 
-0xC7, 0x15, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x15, 0xC7, 0xC7, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x2D, 0x00, 0x39, 0x00, 0x45, 0x00, 0x51, 0x00, 0x5D, 0x00, 0x68, 0x00, 0x71, 0x00, 
+0x7D, 0x00, 0x8A, 0x00, 0x9B, 0x00, 0xAC, 0x00, 0xBC, 0x00, 0xCB, 0x00, 0xD6, 0x00, 0xDD, 0x00, 
+0xDD, 0x00, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x02, 0x03, 0x6F, 0x6F, 0x6F, 0x05, 0x0A, 0x05, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x6F, 0x6F, 0x05, 0x0A, 0x15, 0x15, 0x15, 0x6F, 0x15, 
+0x6F, 0x80, 0x80, 0x80, 0x80, 0x04, 0x0A, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 
+0x80, 0x04, 0x0A, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x04, 0x09, 0x15, 
+0x15, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x05, 0x07, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 
+0x6F, 0x02, 0x0A, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x05, 0x80, 0x80, 0x01, 0x0B, 0x80, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05, 0x80, 0x05, 0x80, 0x00, 0x0C, 0x6F, 0x6F, 0x6F, 0x80, 
+0x80, 0x80, 0x80, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x01, 0x15, 0x00, 0x0F, 0x6F, 0x6F, 0x6F, 
+0x80, 0x80, 0x80, 0x05, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0x05, 0x15, 0x15, 0x01, 0x0E, 0x6F, 0x15, 
+0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x02, 0x0D, 0x15, 0x15, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x01, 0x09, 0x15, 0x15, 0x15, 
+0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x15, 0x02, 0x02, 0x05, 0x05};
 
 const uint8_t gario_6_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x6F, 0xC7, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC7, 0x6F, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x6F, 0x6F, 0x6F, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0xC7, 
-0xC7, 0x6F, 0x6F, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0xC7, 
-0xC7, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x15, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x05, 0x05, 0x05, 0x6F, 0x6F, 0x6F, 0x6F, 0x05, 0x05, 0x05, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x15, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x15, 0x15, 0x15, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0x05, 0x15, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x15, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x15, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x15, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x22, 0x00, 0x28, 0x00, 0x36, 0x00, 0x46, 0x00, 0x56, 0x00, 0x66, 0x00, 0x72, 0x00, 
+0x7C, 0x00, 0x86, 0x00, 0x92, 0x00, 0xA0, 0x00, 0xAE, 0x00, 0xBC, 0x00, 0xCA, 0x00, 0xD6, 0x00, 
+0xD6, 0x00, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x03, 0x01, 0x6F, 0x01, 0x06, 0x05, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x01, 0x01, 0x6F, 0x01, 0x0E, 0x6F, 0x6F, 0x6F, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 
+0x15, 0x6F, 0x15, 0x6F, 0x6F, 0x6F, 0x01, 0x0E, 0x6F, 0x6F, 0x15, 0x15, 0x6F, 0x15, 0x6F, 0x6F, 
+0x15, 0x6F, 0x15, 0x15, 0x6F, 0x6F, 0x01, 0x0E, 0x6F, 0x6F, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0x6F, 
+0x6F, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0x03, 0x0A, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x6F, 0x15, 0x15, 
+0x15, 0x15, 0x04, 0x08, 0x15, 0x6F, 0x15, 0x15, 0x15, 0x15, 0x6F, 0x15, 0x04, 0x08, 0x15, 0x6F, 
+0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x15, 0x03, 0x0A, 0x05, 0x05, 0x05, 0x6F, 0x6F, 0x6F, 0x6F, 0x05, 
+0x05, 0x05, 0x02, 0x0C, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 
+0x02, 0x0C, 0x15, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0x05, 0x05, 0x15, 0x15, 0x15, 0x02, 0x0C, 
+0x15, 0x15, 0x15, 0x05, 0x7F, 0x05, 0x05, 0x7F, 0x05, 0x15, 0x15, 0x15, 0x02, 0x0C, 0x15, 0x15, 
+0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x15, 0x15, 0x15, 0x03, 0x0A, 0x15, 0x15, 0x05, 0x05, 
+0x05, 0x05, 0x05, 0x05, 0x15, 0x15};
 
 const ImageDesc gario[] = {
-{16, 16, 8, {.img8 = gario_0_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = gario_1_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = gario_2_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = gario_3_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = gario_4_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = gario_5_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = gario_6_data}, PALETTE_884, COLOR_MAGENTA}};
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_0_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_1_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_2_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_3_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_4_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_5_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = gario_6_data}, PALETTE_884, COLOR_MAGENTA}};
 
 const uint8_t mushroom_0_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x14, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x14, 0xC7, 0xC7, 
-0xC7, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 0xFF, 0x14, 0x14, 0x14, 0xC7, 
-0xC7, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x14, 0x14, 0x14, 0xC7, 
-0x14, 0x14, 0x14, 0x14, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0x14, 0x14, 
-0x14, 0x14, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 
-0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-0xC7, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7};
+0x22, 0x00, 0x28, 0x00, 0x30, 0x00, 0x3A, 0x00, 0x46, 0x00, 0x54, 0x00, 0x64, 0x00, 0x74, 0x00, 
+0x86, 0x00, 0x98, 0x00, 0xAA, 0x00, 0xBA, 0x00, 0xC4, 0x00, 0xD0, 0x00, 0xDE, 0x00, 0xEC, 0x00, 
+0xF9, 0x00, 0x06, 0x04, 0x14, 0x14, 0x14, 0x14, 0x05, 0x06, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x04, 0x08, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x03, 0x0A, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x02, 0x0C, 0x14, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x00, 0x00, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 
+0xFF, 0x14, 0x14, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x14, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0xFF, 
+0x00, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0x14, 
+0x14, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x14, 0x14, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x04, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+0x03, 0x0C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 
+0x00, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 const uint8_t mushroom_1_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x14, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x14, 0xC7, 0xC7, 
-0xC7, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 0xFF, 0x14, 0x14, 0x14, 0xC7, 
-0xC7, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x14, 0x14, 0x14, 0xC7, 
-0x14, 0x14, 0x14, 0x14, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0x14, 0x14, 
-0x14, 0x14, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 
-0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-0xC7, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x28, 0x00, 0x30, 0x00, 0x3A, 0x00, 0x46, 0x00, 0x54, 0x00, 0x64, 0x00, 0x74, 0x00, 
+0x86, 0x00, 0x98, 0x00, 0xAA, 0x00, 0xBA, 0x00, 0xC4, 0x00, 0xD0, 0x00, 0xDE, 0x00, 0xEC, 0x00, 
+0xF9, 0x00, 0x06, 0x04, 0x14, 0x14, 0x14, 0x14, 0x05, 0x06, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x04, 0x08, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x03, 0x0A, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x02, 0x0C, 0x14, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x00, 0x00, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 
+0xFF, 0x14, 0x14, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x14, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0x14, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0xFF, 
+0x00, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0x14, 
+0x14, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x14, 0x14, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x14, 0x14, 0x04, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x0A, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x01, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x0C, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0xFF, 0x01, 0x03, 0x00, 0x00, 0x00};
 
 const uint8_t mushroom_2_data[] = {
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xC7, 0xC7, 0xC7, 
-0xC7, 0x14, 0x14, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x14, 0x14, 0xC7, 
-0x14, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 
-0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 
-0xC7, 0xC7, 0xC7, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7};
+0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 
+0x22, 0x00, 0x22, 0x00, 0x28, 0x00, 0x34, 0x00, 0x44, 0x00, 0x56, 0x00, 0x68, 0x00, 0x74, 0x00, 
+0x7E, 0x00, 0x06, 0x04, 0x14, 0x14, 0x14, 0x14, 0x03, 0x0A, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x14, 0x14, 0x14, 0x01, 0x0E, 0x14, 0x14, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0x00, 
+0x00, 0x00, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x14, 0x00, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x03, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
 const ImageDesc mushroom[] = {
-{16, 16, 8, {.img8 = mushroom_0_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = mushroom_1_data}, PALETTE_884, COLOR_MAGENTA},
-{16, 16, 8, {.img8 = mushroom_2_data}, PALETTE_884, COLOR_MAGENTA}};
+{16, 16, 8 | IMAGE_RLE, {.img8 = mushroom_0_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = mushroom_1_data}, PALETTE_884, COLOR_MAGENTA},
+{16, 16, 8 | IMAGE_RLE, {.img8 = mushroom_2_data}, PALETTE_884, COLOR_MAGENTA}};
 
 const uint16_t SuperMarioThemeTable[] = {
 0x2932, 0x2932, 0x0002, 0x2932, 0x0002, 0x20B2, 0x2932, 0x0002, 0x30F2, 0x0002,
@@ -1116,10 +840,15 @@ Result Gario::Loop()
     }
   }
 
+  // Cache of tile rows for tile map. Static to keep it out of task stack.
+  static TiledMap::TileRow tiles_cache[64];
   // Tile map for world
   TiledMap tiledmap(0, 0, display_drv.GetScreenW(), levelH * 16,
                     level_data, levelW, levelH, 0x1F,
-                    tiles, NumberOf(tiles), COLOR_BLUE);
+                    tiles, NumberOf(tiles), COLOR_BLUE,
+                    tiles_cache, NumberOf(tiles_cache));
+  // Map covers whole screen width, so it can be scrolled by display
+  tiledmap.SetHardwareScroll(true);
   tiledmap.Show(1000);
 
   // Gario sprite
@@ -1138,6 +867,8 @@ Result Gario::Loop()
   // Movement variables
   int32_t dx = 0;
   int32_t dy = 0;
+  // Limit frame rate: game tick is shorter than frame
+  display_drv.SetTargetFps(FRAME_RATE);
   // Init ticks variable
   uint32_t last_wake_ticks = RtosTick::GetTickCount();
   //Alive flag
@@ -1197,6 +928,8 @@ Result Gario::Loop()
   
   // Stop Sound
   sound_drv.StopSound();
+  // Remove frame rate limit
+  display_drv.SetTargetFps(0U);
 
   // Always run
   return Result::RESULT_OK;
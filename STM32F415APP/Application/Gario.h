@@ -24,6 +24,10 @@
 // one pixel at a tick. Otherwise collision check system will worn improperly.
 static const int32_t TICK_MS = 5;
 
+// Display frame rate. Screen updates requested by ticks between frames are
+// coalesced, so display task doesn't spend CPU time for invisible frames.
+static const uint32_t FRAME_RATE = 50U;
+
 // Y axis acceleration constants
 static const int32_t Y_ACCEL_S = 1200;
 static const int32_t Y_ACCEL_CONST = (Y_ACCEL_S * (TICK_MS * TICK_MS)) / 2;
@@ -45,10 +45,28 @@ Result GraphDemo::Loop()
   Circle circle2(150, 120, 30, COLOR_BLUE);
   circle2.Show(50);
 
+  Ellipse ellipse1(60, 160, 40, 20, COLOR_GREEN, false, 3);
+  ellipse1.Show(45);
+  RoundRect rrect1(220, 40, 80, 50, 12, COLOR_RED, true);
+  rrect1.Show(15);
+
   Line line1(46, 34, 126, 210, COLOR_GREEN);
   line1.Show(30);
   Line line2(46, 34, 310, 126, COLOR_CYAN);
   line2.Show(30);
+  Line line3(20, 220, 180, 150, COLOR_YELLOW, 5U);
+  line3.Show(30);
+  Line line4(200, 20, 300, 200, COLOR_WHITE, 1U, true);
+  line4.Show(30);
+
+  static const Point zigzag[] = {{0, 40}, {20, 0}, {40, 40}, {60, 0}, {80, 40}};
+  Polyline polyline1(200, 160, zigzag, NumberOf(zigzag), COLOR_MAGENTA, 3U);
+  polyline1.Show(30);
+
+  // Vertices of polygon in 1/16 pixel
+  static const Point ship[] = {{0, -320}, {224, 256}, {0, 128}, {-224, 256}};
+  Polygon polygon1(60, 60, ship, NumberOf(ship), COLOR_CYAN, true, COLOR_WHITE);
+  polygon1.Show(35);
 
   String str1("Hello World!", 0, 10, COLOR_MAGENTA, String::FONT_4x6);
   str1.Show(70);
@@ -68,8 +86,14 @@ Result GraphDemo::Loop()
 
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(circle1);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(circle2);
+  pointer_list[list_item_cnt++] = new VisObjectRandomMover(ellipse1);
+  pointer_list[list_item_cnt++] = new VisObjectRandomMover(rrect1);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(line1);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(line2);
+  pointer_list[list_item_cnt++] = new VisObjectRandomMover(line3);
+  pointer_list[list_item_cnt++] = new VisObjectRandomMover(line4);
+  pointer_list[list_item_cnt++] = new VisObjectRandomMover(polyline1);
+  pointer_list[list_item_cnt++] = new VisObjectRandomMover(polygon1);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(str1);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(str2);
   pointer_list[list_item_cnt++] = new VisObjectRandomMover(str3);
@@ -90,8 +114,8 @@ Result GraphDemo::Loop()
       display_drv.UnlockDisplay();
       // Update Display
       display_drv.UpdateDisplay();
-      // Pause for switch to Display Task
-      RtosTick::DelayTicks(1U);
+      // Wait until frame drawn for run in lockstep with Display Task
+      display_drv.WaitForFrameDone();
     }
   }
   // Always run
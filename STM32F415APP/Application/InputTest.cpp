@@ -98,6 +98,9 @@ Result InputTest::Loop()
     sprintf(str_right, "BUTTONS");
     right_str.Show(30);
   }
+  // Strings content changed - update it
+  left_str.SetString(str_left);
+  right_str.SetString(str_right);
 
   int32_t x = 0;
   int32_t y = 0;
@@ -110,6 +113,7 @@ Result InputTest::Loop()
       input_drv.GetJoystickState(InputDrv::EXT_LEFT, x, y);
  		  circle_left.Move(30-2 + (x * 100) / 4095, 20-2 + (y * 100) / 4095);
  		  sprintf(str_left_data, "LEFT:  X=%4li, Y=%4li", x, y);
+ 		  left_str_data.SetString(str_left_data);
     }
 
     if(input_drv.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_JOY)
@@ -118,6 +122,7 @@ Result InputTest::Loop()
  		  input_drv.GetJoystickState(InputDrv::EXT_RIGHT, x, y);
  		  circle_right.Move(190-2 + (x * 100) / 4095, 20-2 + (y * 100) / 4095);
  		  sprintf(str_right_data, "RIGHT: X=%4li, Y=%4li", x, y);
+ 		  right_str_data.SetString(str_right_data);
     }
 
 		// Update Display
@@ -49,7 +49,7 @@ Result Pong::Loop()
      || (input_drv.GetDeviceType(InputDrv::EXT_RIGHT) == InputDrv::EXT_DEV_BTN) )
   {
     UiMsgBox msg_box("Buttons module can't be used", "Error!");
-    msg_box.Run(3000U);
+    msg_box.Run(3000U, 160U);
   }
   else
   {
@@ -85,6 +85,8 @@ Result Pong::Loop()
         
     // Clear Game Over flag before start game
     game_over = false;
+    // Display task draws frame each game tick
+    display_drv.SetTargetFps(1000U / TICK_MS);
 
     // Game cycle
     while(game_over == false)
@@ -194,13 +196,16 @@ Result Pong::Loop()
           
         // Create score string
         sprintf(scr_str, "%2u : %-2u", left_score, right_score);
+        score_str.SetString(scr_str);
         // Unlock Display
         display_drv.UnlockDisplay();
         // Update Display
         display_drv.UpdateDisplay();
-        // Pause until next tick
-        RtosTick::DelayUntilMs(last_wake_ticks, TICK_MS);
+        // Run game in lockstep with display: pause until frame drawn
+        display_drv.WaitForFrameDone();
     }
+    // Remove frame rate limit
+    display_drv.SetTargetFps(0U);
     box_left.Hide();
     box_right.Hide();
     ball.Hide();
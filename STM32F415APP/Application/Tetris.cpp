@@ -153,6 +153,7 @@ Result Tetris::Loop()
     next_shape.PopulateShapeArray(rand()%7, 1+(rand()%5));
     next_shape.shapeTopLeftX = 15;
     next_shape.shapeTopLeftY = 5;
+    next_shape.UpdateArea();
 
     if (bucket.CheckShapeCollisionIntoBucket(shape))
     {
@@ -262,6 +263,9 @@ Result Tetris::Loop()
       }
       // Create score string
       sprintf(scr_str, "Score: %lu", bucket.GetScore());
+      // Shape position can be changed
+      shape.UpdateArea();
+      score_str.SetString(scr_str);
       // Unlock Display
       display_drv.UnlockDisplay();
       // Update Display
@@ -281,6 +285,9 @@ Result Tetris::Loop()
 // *****************************************************************************
 TetrisShape::TetrisShape()
 {
+  // Shape size
+  width = 4 * CUBE_SIZE;
+  height = 4 * CUBE_SIZE;
   // Init by default
   PopulateShapeArray(0, 1);
 }
@@ -301,6 +308,8 @@ void TetrisShape::RotateShape(int8_t dir)
   {
     shapeArray[shapeRtArray[shapeRotate][n]] = shapesArray[shapeNum][n];
   }
+  // Shape should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -356,6 +365,8 @@ void TetrisShape::PopulateShapeArray(uint8_t shapeType, uint8_t color_idx)
   {
     shapeArray[n] = shapesArray[shapeNum][n];
   }
+  // Shape and position changed
+  UpdateArea();
 }
 
 // *****************************************************************************
@@ -373,6 +384,24 @@ void TetrisShape::PopulateShapeArray(TetrisShape& shape)
   {
     shapeArray[n] = shape.shapeArray[n];
   }
+  // Shape and position changed
+  UpdateArea();
+}
+
+// *****************************************************************************
+// ***   UpdateArea   **********************************************************
+// *****************************************************************************
+void TetrisShape::UpdateArea(void)
+{
+  // Old area should be redrawn
+  Invalidate();
+  // Set new area
+  x_start = shapeTopLeftX * CUBE_SIZE;
+  y_start = shapeTopLeftY * CUBE_SIZE;
+  x_end = x_start + width - 1;
+  y_end = y_start + height - 1;
+  // New area should be redrawn
+  Invalidate();
 }
 
 // ***************************************************************************
@@ -384,25 +413,20 @@ void TetrisShape::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t sta
   if((line >= shapeTopLeftY*CUBE_SIZE) && (line < (shapeTopLeftY+4)*CUBE_SIZE))
   {
     int32_t shape_line = line - shapeTopLeftY*CUBE_SIZE;
-    int32_t start = 0;
-    int32_t end = 0;
     for(int32_t i=0; i < 4; i++)
     {
       if(shapeArray[(shape_line/CUBE_SIZE)*4 + i] == true)
       {
-        if(start == 0) start = ((shapeTopLeftX+i)*CUBE_SIZE) - start_x;
-        end = ((shapeTopLeftX+i)*CUBE_SIZE) + CUBE_SIZE - 1 - start_x;
+        int32_t start = ((shapeTopLeftX+i)*CUBE_SIZE) - start_x;
+        int32_t end = start + CUBE_SIZE - 1;
+        // Prevent write in memory before buffer
+        if(start < 0) start = 0;
+        // Prevent buffer overflow
+        if(end >= n) end = n - 1;
+        // Draw cube line, loop will be skipped if cube isn't in buffer
+        for(int32_t j = start; j <= end; j++) buf[j] = colors[shapeColorIdx];
       }
     }
-    // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Prevent buffer overflow
-    if(end > n) end = n;
-    // Have sense draw only if end pointer in buffer
-    if(end > 0)
-    {
-      for(int32_t i = start; i <= end; i++) buf[i] = colors[shapeColorIdx];
-    }
   }
 }
 
@@ -411,6 +435,11 @@ void TetrisShape::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t sta
 // *****************************************************************************
 TetrisBucket::TetrisBucket()
 {
+  // Bucket area
+  width = WIDTH * CUBE_SIZE;
+  height = HEIGHT * CUBE_SIZE;
+  x_end = width - 1;
+  y_end = height - 1;
   InitBucket();
 }
 
@@ -430,6 +459,8 @@ bool TetrisBucket::CheckShapeCollisionIntoBucket(TetrisShape& ts)
 void TetrisBucket::PutShapeIntoBucket(TetrisShape& ts)
 {
   ts.DrawShapeIntoBuffer(bucket, WIDTH, HEIGHT);
+  // Bucket should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -457,6 +488,8 @@ void TetrisBucket::RemoveFullLines()
   if (cnt > 0)
   {
     score += 100 + 200 * (cnt - 1);
+    // Bucket should be redrawn
+    Invalidate();
   }
 }
 
@@ -480,6 +513,8 @@ void TetrisBucket::InitBucket()
   {
     bucket[y*WIDTH + x] = 0x07;
   }
+  // Bucket should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -499,11 +534,12 @@ void TetrisBucket::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t st
       {
         int32_t start = (i*CUBE_SIZE) - start_x;
         int32_t end = start + CUBE_SIZE - 1;
-        // Have sense draw only if end pointer in buffer
-        if(end > 0)
-        {
-          for(int32_t i = start; i <= end; i++) buf[i] = colors[color];
-        }
+        // Prevent write in memory before buffer
+        if(start < 0) start = 0;
+        // Prevent buffer overflow
+        if(end >= n) end = n - 1;
+        // Draw cube line, loop will be skipped if cube isn't in buffer
+        for(int32_t j = start; j <= end; j++) buf[j] = colors[color];
       }
     }
   }
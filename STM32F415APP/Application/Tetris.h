@@ -131,6 +131,13 @@ class TetrisShape : public VisObject
     // *************************************************************************
     void PopulateShapeArray(TetrisShape& shape);
 
+    // *************************************************************************
+    // ***   UpdateArea   ******************************************************
+    // *************************************************************************
+    // * Update object area on screen. Must be called after shape position
+    // * changed.
+    void UpdateArea(void);
+
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
@@ -120,10 +120,33 @@ const static uint8_t EXAMPLE_MSG_TASK_PRIORITY = tskIDLE_PRIORITY + 2U;
 const static uint16_t DISPLAY_DRV_TASK_STACK_SIZE = 256U;
 const static uint16_t INPUT_DRV_TASK_STACK_SIZE   = configMINIMAL_STACK_SIZE;
 const static uint16_t SOUND_DRV_TASK_STACK_SIZE   = configMINIMAL_STACK_SIZE;
+const static uint16_t ASSET_DRV_TASK_STACK_SIZE   = 256U;
 // *** System tasks priorities   ***********************************************
 const static uint8_t DISPLAY_DRV_TASK_PRIORITY = tskIDLE_PRIORITY + 1U;
 const static uint8_t INPUT_DRV_TASK_PRIORITY   = tskIDLE_PRIORITY + 2U;
 const static uint8_t SOUND_DRV_TASK_PRIORITY   = tskIDLE_PRIORITY + 3U;
+const static uint8_t ASSET_DRV_TASK_PRIORITY   = tskIDLE_PRIORITY + 2U;
+// *** Display driver band buffers   *******************************************
+// Lines in one band. Display driver draws band and sends it to the display by
+// one DMA transfer. Band size in bytes must not exceed 65535(DMA limit).
+const static uint16_t DISPLAY_BAND_LINES   = 4U;
+// Count of band buffers. Next band drawn while previous bands sent to the
+// display. RAM usage: DISPLAY_BAND_BUFFERS * DISPLAY_BAND_LINES * 640 bytes.
+const static uint16_t DISPLAY_BAND_BUFFERS = 2U;
+// *** Asset driver row cache   ************************************************
+// Count of rows in cache and max size of one row in bytes. RAM usage:
+// ASSET_CACHE_ROWS * ASSET_CACHE_ROW_SIZE bytes.
+const static uint16_t ASSET_CACHE_ROWS     = 16U;
+const static uint16_t ASSET_CACHE_ROW_SIZE = 320U;
+// Count of rows read ahead of line drawn by display driver
+const static uint16_t ASSET_PREFETCH_ROWS  = 2U;
+// *** Proportional font glyph cache   *****************************************
+// Count of glyphs in cache and max size of decoded glyph bitmap
+// in bytes. RAM usage: FONT_CACHE_GLYPHS * FONT_CACHE_GLYPH_SIZE bytes.
+const static uint16_t FONT_CACHE_GLYPHS     = 24U;
+const static uint16_t FONT_CACHE_GLYPH_SIZE = 256U;
+// Max count of characters in proportional string
+const static uint16_t PROP_STRING_MAX_CHARS = 48U;
 // *****************************************************************************
 
 // *****************************************************************************
@@ -134,7 +157,11 @@ const static uint8_t SOUND_DRV_TASK_PRIORITY   = tskIDLE_PRIORITY + 3U;
 #define NumberOf(x) (sizeof(x)/sizeof((x)[0]))
 
 // Break macro - useful for debugging
+#if defined(__arm__)
 #define Break() asm volatile("bkpt #0")
+#else
+#define Break() __builtin_trap()
+#endif
 
 // *****************************************************************************
 // ***   Overloaded operators   ************************************************
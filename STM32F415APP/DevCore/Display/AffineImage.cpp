@@ -0,0 +1,367 @@
+//******************************************************************************
+//  @file AffineImage.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Affine transformed Image Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "AffineImage.h"
+
+#include <math.h>
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+AffineImage::AffineImage(int32_t x, int32_t y, const ImageDesc& img_dsc)
+{
+  x_start = x;
+  y_start = y;
+  img_w = img_dsc.width;
+  img_h = img_dsc.height;
+  bits_per_pixel = img_dsc.bits_per_pixel;
+  img = img_dsc.img8;
+  palette = img_dsc.palette;
+  transparent_color = img_dsc.transparent_color;
+  // Pivot in image center
+  pivot_x = img_w * (FIXED_ONE / 2);
+  pivot_y = img_h * (FIXED_ONE / 2);
+  UpdateTransform();
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void AffineImage::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end) && (sample != nullptr))
+  {
+    // Center of first pixel in buffer relative to image center
+    int32_t dx = (start_x - x_start) * FIXED_ONE + FIXED_ONE / 2 - center_x;
+    int32_t dy = (line - y_start) * FIXED_ONE + FIXED_ONE / 2 - center_y;
+    // Image coordinates of first pixel in buffer counted from image corner
+    int32_t u = (int32_t)(((int64_t)du_dx * dx + (int64_t)du_dy * dy) >> 16) + img_w * (FIXED_ONE / 2);
+    int32_t v = (int32_t)(((int64_t)dv_dx * dx + (int64_t)dv_dy * dy) >> 16) + img_h * (FIXED_ONE / 2);
+    // Find span of pixels inside object area and buffer
+    int32_t start = x_start - start_x;
+    if(start < 0) start = 0;
+    int32_t end = x_end - start_x;
+    if(end >= n) end = n - 1;
+    // Narrow span to pixels inside image
+    ClipSpan(u, du_dx, img_w * FIXED_ONE, start, end);
+    ClipSpan(v, dv_dx, img_h * FIXED_ONE, start, end);
+    // Sample image
+    if(start <= end)
+    {
+      (this->*sample)(&buf[start], end - start + 1, u + du_dx * start, v + dv_dx * start);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void AffineImage::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Not implemented yet
+}
+
+// *****************************************************************************
+// ***   Set transformation matrix   *******************************************
+// *****************************************************************************
+void AffineImage::SetMatrix(int32_t a, int32_t b, int32_t c, int32_t d, int32_t tx, int32_t ty)
+{
+  // Matrix used by DisplayDrv during frame drawing, so new matrix will be
+  // applied before next frame
+  Rtos::EnterCriticalSection();
+  new_matrix[0] = a;
+  new_matrix[1] = b;
+  new_matrix[2] = tx;
+  new_matrix[3] = c;
+  new_matrix[4] = d;
+  new_matrix[5] = ty;
+  new_matrix_set = true;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Set rotation and scale   **********************************************
+// *****************************************************************************
+void AffineImage::SetRotateScale(int32_t angle, int32_t scale)
+{
+  // Y axis of screen directed down, so positive angle rotates clockwise
+  float rad = (float)angle * (3.14159265f / 180.0f);
+  int32_t c = (int32_t)(cosf(rad) * (float)scale);
+  int32_t s = (int32_t)(sinf(rad) * (float)scale);
+  SetMatrix(c, -s, s, c);
+}
+
+// *****************************************************************************
+// ***   Set Image function   **************************************************
+// *****************************************************************************
+void AffineImage::SetImage(const ImageDesc& img_dsc)
+{
+  // Image will be applied before next frame
+  Rtos::EnterCriticalSection();
+  new_img_dsc = &img_dsc;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void AffineImage::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take new image if it set
+  if(new_img_dsc != nullptr)
+  {
+    taken_img_dsc = new_img_dsc;
+    new_img_dsc = nullptr;
+  }
+  // Take new matrix if it set
+  if(new_matrix_set)
+  {
+    for(uint32_t i = 0U; i < NumberOf(matrix); i++) matrix[i] = new_matrix[i];
+    new_matrix_set = false;
+    taken_matrix_set = true;
+  }
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void AffineImage::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Image and matrix change object area
+  if((taken_img_dsc != nullptr) || taken_matrix_set)
+  {
+    // Old area should be redrawn
+    Invalidate();
+    if(taken_img_dsc != nullptr)
+    {
+      img_w = taken_img_dsc->width;
+      img_h = taken_img_dsc->height;
+      bits_per_pixel = taken_img_dsc->bits_per_pixel;
+      img = taken_img_dsc->img8;
+      palette = taken_img_dsc->palette;
+      transparent_color = taken_img_dsc->transparent_color;
+      taken_img_dsc = nullptr;
+    }
+    taken_matrix_set = false;
+    UpdateTransform();
+    // New area should be redrawn
+    Invalidate();
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Update inverse matrix and object area   **********************
+// *****************************************************************************
+void AffineImage::UpdateTransform(void)
+{
+  // Pivot and image center in screen coordinates
+  int32_t px = x_start * FIXED_ONE + pivot_x;
+  int32_t py = y_start * FIXED_ONE + pivot_y;
+  int32_t cx = px + matrix[2];
+  int32_t cy = py + matrix[5];
+  // Find bounding box of transformed image corners relative to image center
+  int32_t min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+  for(uint32_t i = 0U; i < 4U; i++)
+  {
+    int32_t u = img_w * (FIXED_ONE / 2) * (((i & 1U) != 0U) ? 1 : -1);
+    int32_t v = img_h * (FIXED_ONE / 2) * (((i & 2U) != 0U) ? 1 : -1);
+    int32_t x = (int32_t)(((int64_t)matrix[0] * u + (int64_t)matrix[1] * v) >> 16);
+    int32_t y = (int32_t)(((int64_t)matrix[3] * u + (int64_t)matrix[4] * v) >> 16);
+    if((i == 0U) || (x < min_x)) min_x = x;
+    if((i == 0U) || (x > max_x)) max_x = x;
+    if((i == 0U) || (y < min_y)) min_y = y;
+    if((i == 0U) || (y > max_y)) max_y = y;
+  }
+  // Object area contains pixels which centers are inside transformed image
+  x_start = (cx + min_x + FIXED_ONE / 2 - 1) >> 16;
+  y_start = (cy + min_y + FIXED_ONE / 2 - 1) >> 16;
+  x_end = (cx + max_x - FIXED_ONE / 2 - 1) >> 16;
+  y_end = (cy + max_y - FIXED_ONE / 2 - 1) >> 16;
+  width = x_end - x_start + 1;
+  height = y_end - y_start + 1;
+  // Pivot and image center stay on the same screen positions
+  pivot_x = px - x_start * FIXED_ONE;
+  pivot_y = py - y_start * FIXED_ONE;
+  center_x = cx - x_start * FIXED_ONE;
+  center_y = cy - y_start * FIXED_ONE;
+  // Image sampled by inverse matrix
+  SelectSampler();
+  // Determinant has 32 fractional bits, so elements of inverse matrix
+  // multiplied by one squared
+  const int64_t one_sq = (int64_t)FIXED_ONE * FIXED_ONE;
+  int64_t det = (int64_t)matrix[0] * matrix[4] - (int64_t)matrix[1] * matrix[3];
+  if(det != 0)
+  {
+    du_dx = (int32_t)( matrix[4] * one_sq / det);
+    du_dy = (int32_t)(-matrix[1] * one_sq / det);
+    dv_dx = (int32_t)(-matrix[3] * one_sq / det);
+    dv_dy = (int32_t)( matrix[0] * one_sq / det);
+  }
+  else
+  {
+    // Image collapsed to line or point
+    sample = nullptr;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Select sample function   *************************************
+// *****************************************************************************
+void AffineImage::SelectSampler(void)
+{
+  // Table of functions: [keyed]
+  static const SampleFunction sample16[2] = {&AffineImage::SampleSpan<16U, false>, &AffineImage::SampleSpan<16U, true>};
+  static const SampleFunction sample8[2]  = {&AffineImage::SampleSpan<8U, false>,  &AffineImage::SampleSpan<8U, true>};
+  static const SampleFunction sample4[2]  = {&AffineImage::SampleSpan<4U, false>,  &AffineImage::SampleSpan<4U, true>};
+  static const SampleFunction sample2[2]  = {&AffineImage::SampleSpan<2U, false>,  &AffineImage::SampleSpan<2U, true>};
+  static const SampleFunction sample1[2]  = {&AffineImage::SampleSpan<1U, false>,  &AffineImage::SampleSpan<1U, true>};
+
+  bool keyed = (transparent_color >= 0);
+  sample = nullptr;
+  switch(bits_per_pixel)
+  {
+    case 16U:
+      sample = sample16[keyed];
+      break;
+    case 8U:
+      sample = sample8[keyed];
+      break;
+    case 4U:
+      sample = sample4[keyed];
+      break;
+    case 2U:
+      sample = sample2[keyed];
+      break;
+    case 1U:
+      sample = sample1[keyed];
+      break;
+    case 8U | IMAGE_ALPHA:
+      sample = &AffineImage::SampleAlphaSpan;
+      break;
+    default:
+      // Run-length encoded images aren't supported
+      break;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Clip span by one image coordinate   **************************
+// *****************************************************************************
+void AffineImage::ClipSpan(int32_t p, int32_t dp, int32_t limit, int32_t& k1, int32_t& k2)
+{
+  if(dp == 0)
+  {
+    // Coordinate is the same for whole span
+    if((p < 0) || (p >= limit)) k2 = k1 - 1;
+  }
+  else
+  {
+    // Make step positive: coordinate p + dp * k inside 0..limit-1 is the
+    // same as coordinate limit-1 - (p + dp * k) inside this range
+    if(dp < 0)
+    {
+      p = limit - 1 - p;
+      dp = -dp;
+    }
+    // First step where coordinate >= 0: ceil(-p / dp)
+    int32_t k_min = (p >= 0) ? -(p / dp) : (-p + dp - 1) / dp;
+    // Last step where coordinate < limit: floor((limit - 1 - p) / dp)
+    int32_t q = limit - 1 - p;
+    int32_t k_max = (q >= 0) ? q / dp : -((-q + dp - 1) / dp);
+    if(k1 < k_min) k1 = k_min;
+    if(k2 > k_max) k2 = k_max;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Get pixel from line of image   *******************************
+// *****************************************************************************
+template<uint32_t BPP>
+inline uint32_t AffineImage::GetPixel(const uint8_t* p_line, uint32_t x)
+{
+  uint32_t color;
+  if(BPP == 16U)
+  {
+    color = ((const uint16_t*)p_line)[x];
+  }
+  else if(BPP == 8U)
+  {
+    color = palette[p_line[x]];
+  }
+  else
+  {
+    // Pixels of packed images stored from the most significant bits
+    const uint32_t PPB = 8U / BPP;
+    const uint32_t MASK = (1U << BPP) - 1U;
+    color = palette[(p_line[x / PPB] >> (8U - BPP * (x % PPB + 1U))) & MASK];
+  }
+  return color;
+}
+
+// *****************************************************************************
+// ***   Private: Sample span of pixels   **************************************
+// *****************************************************************************
+template<uint32_t BPP, bool KEYED>
+void AffineImage::SampleSpan(uint16_t* dst, int32_t n, int32_t u, int32_t v)
+{
+  // Lines of packed images start from byte boundary
+  const uint32_t line_size = (img_w * BPP + 7U) / 8U;
+  for(int32_t i = 0; i < n; i++)
+  {
+    uint32_t color = GetPixel<BPP>(img + (v >> 16) * line_size, u >> 16);
+    if(!KEYED || (color != (uint32_t)transparent_color)) dst[i] = color;
+    u += du_dx;
+    v += dv_dx;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Sample span of pixels of image with alpha channel   **********
+// *****************************************************************************
+void AffineImage::SampleAlphaSpan(uint16_t* dst, int32_t n, int32_t u, int32_t v)
+{
+  for(int32_t i = 0; i < n; i++)
+  {
+    uint32_t data = img[(v >> 16) * img_w + (u >> 16)];
+    uint32_t alpha = data >> 4U;
+    if(alpha == 0xFU)
+    {
+      dst[i] = palette[data & 0xFU];
+    }
+    else if(alpha != 0U)
+    {
+      // Scale alpha from 0..15 to 0..ALPHA_MAX
+      dst[i] = Blitter::Blend(palette[data & 0xFU], dst[i], (alpha << 1U) | (alpha >> 3U));
+    }
+    u += du_dx;
+    v += dv_dx;
+  }
+}
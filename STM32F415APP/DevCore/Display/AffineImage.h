@@ -0,0 +1,195 @@
+//******************************************************************************
+//  @file AffineImage.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Affine transformed Image Visual Object Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef AffineImage_h
+#define AffineImage_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "VisObject.h"
+#include "Image.h"
+
+// *****************************************************************************
+// ***   Affine transformed Image Class   **************************************
+// *****************************************************************************
+// * Draws image rotated and/or scaled by 2x3 matrix in 16.16 fixed point
+// * format. Image sampled per line: for each line found span of pixels which
+// * lie inside transformed image and image coordinates stepped incrementally
+// * along it, so pixels outside image are never visited. Image pivot is image
+// * center at creation time and moves with object. Run-length encoded images
+// * aren't supported since their pixels can't be accessed randomly.
+class AffineImage : public VisObject
+{
+  public:
+    // Fixed point one for matrix elements and scale
+    static const int32_t FIXED_ONE = 1 << 16;
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    // * Image drawn at x, y without transformation until matrix set.
+    AffineImage(int32_t x, int32_t y, const ImageDesc& img_dsc);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Set transformation matrix   ***************************************
+    // *************************************************************************
+    // * Pixel (u, v) of image counted from image center drawn at screen point
+    // * (a*u + b*v + tx, c*u + d*v + ty) counted from pivot. All values in
+    // * 16.16 fixed point format, scale should be in range 1/16..16. Image
+    // * with degenerate matrix isn't drawn. Matrix will be applied from next
+    // * frame.
+    void SetMatrix(int32_t a, int32_t b, int32_t c, int32_t d, int32_t tx = 0, int32_t ty = 0);
+
+    // *************************************************************************
+    // ***   Set rotation and scale   ******************************************
+    // *************************************************************************
+    // * Rotate image around pivot clockwise by angle in degrees and scale it.
+    // * Scale in 16.16 fixed point format.
+    void SetRotateScale(int32_t angle, int32_t scale = FIXED_ONE);
+
+    // *************************************************************************
+    // ***   Set Image function   **********************************************
+    // *************************************************************************
+    // * New image will be shown from next frame. Image description must exist
+    // * until image applied.
+    void SetImage(const ImageDesc& img_dsc);
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+  private:
+    // Function for sample span of pixels from image
+    typedef void (AffineImage::*SampleFunction)(uint16_t* dst, int32_t n, int32_t u, int32_t v);
+
+    // *************************************************************************
+    // ***   Update inverse matrix and object area   ***************************
+    // *************************************************************************
+    void UpdateTransform(void);
+
+    // *************************************************************************
+    // ***   Select sample function   ******************************************
+    // *************************************************************************
+    void SelectSampler(void);
+
+    // *************************************************************************
+    // ***   Clip span by one image coordinate   *******************************
+    // *************************************************************************
+    // * Narrows range k1..k2 to steps k where 0 <= p + dp * k < limit.
+    static void ClipSpan(int32_t p, int32_t dp, int32_t limit, int32_t& k1, int32_t& k2);
+
+    // *************************************************************************
+    // ***   Get pixel from line of image   ************************************
+    // *************************************************************************
+    template<uint32_t BPP>
+    inline uint32_t GetPixel(const uint8_t* p_line, uint32_t x);
+
+    // *************************************************************************
+    // ***   Sample span of pixels   *******************************************
+    // *************************************************************************
+    template<uint32_t BPP, bool KEYED>
+    void SampleSpan(uint16_t* dst, int32_t n, int32_t u, int32_t v);
+
+    // *************************************************************************
+    // ***   Sample span of pixels of image with alpha channel   ***************
+    // *************************************************************************
+    void SampleAlphaSpan(uint16_t* dst, int32_t n, int32_t u, int32_t v);
+
+    // Image width and height
+    int32_t img_w;
+    int32_t img_h;
+    // Bits per pixel
+    uint8_t bits_per_pixel;
+    // Pointer to the image
+    const uint8_t* img;
+    // Pointer to the palette
+    const uint16_t* palette;
+    // Transparent color (-1 no transparent colors)
+    int32_t transparent_color;
+    // Function for sample image
+    SampleFunction sample = nullptr;
+    // Transformation matrix
+    int32_t matrix[6] = {FIXED_ONE, 0, 0, 0, FIXED_ONE, 0};
+    // Inverse matrix without translation: steps of image coordinates for
+    // one pixel step on screen along X(du_dx, dv_dx) and Y(du_dy, dv_dy)
+    int32_t du_dx = FIXED_ONE, du_dy = 0, dv_dx = 0, dv_dy = FIXED_ONE;
+    // Pivot and image center positions relative to object start in 16.16
+    // fixed point format. Object start changes with transformation.
+    int32_t pivot_x, pivot_y;
+    int32_t center_x, center_y;
+    // Matrix set by SetMatrix() and not applied yet
+    int32_t new_matrix[6];
+    volatile bool new_matrix_set = false;
+    // Image description set by SetImage() and not applied yet
+    const ImageDesc* volatile new_img_dsc = nullptr;
+    // Image description and matrix flag taken by TakePending() and not
+    // applied yet. Matrix used only for calculate transformation, so it
+    // taken directly.
+    const ImageDesc* taken_img_dsc = nullptr;
+    bool taken_matrix_set = false;
+};
+
+#endif
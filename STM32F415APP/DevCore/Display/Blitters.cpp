@@ -0,0 +1,340 @@
+//******************************************************************************
+//  @file Blitters.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Span blitter kernels, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "Blitters.h"
+
+// *****************************************************************************
+// ***   Typedefs   ************************************************************
+// *****************************************************************************
+
+// Two pixels written to line buffer by one 32-bit store
+typedef uint32_t __attribute__((__may_alias__)) PixelPair;
+
+// *****************************************************************************
+// ***   Public: GetBlitter   **************************************************
+// *****************************************************************************
+Blitter::BlitFunction Blitter::GetBlitter(uint8_t bits_per_pixel, bool mirror, bool keyed)
+{
+  // Table of kernels: [mirror][keyed]
+  static const BlitFunction blit16[2][2] =
+  {
+    {&BlitOpaque<uint16_t, false>, &BlitKeyed<uint16_t, false>},
+    {&BlitOpaque<uint16_t, true>,  &BlitKeyed<uint16_t, true>}
+  };
+  static const BlitFunction blit8[2][2] =
+  {
+    {&BlitOpaque<uint8_t, false>, &BlitKeyed<uint8_t, false>},
+    {&BlitOpaque<uint8_t, true>,  &BlitKeyed<uint8_t, true>}
+  };
+  static const BlitFunction blit4[2][2] =
+  {
+    {&BlitPacked<4U, false, false>, &BlitPacked<4U, false, true>},
+    {&BlitPacked<4U, true, false>,  &BlitPacked<4U, true, true>}
+  };
+  static const BlitFunction blit2[2][2] =
+  {
+    {&BlitPacked<2U, false, false>, &BlitPacked<2U, false, true>},
+    {&BlitPacked<2U, true, false>,  &BlitPacked<2U, true, true>}
+  };
+  static const BlitFunction blit1[2][2] =
+  {
+    {&BlitPacked<1U, false, false>, &BlitPacked<1U, false, true>},
+    {&BlitPacked<1U, true, false>,  &BlitPacked<1U, true, true>}
+  };
+
+  BlitFunction blit = nullptr;
+  switch(bits_per_pixel)
+  {
+    case 16U:
+      blit = blit16[mirror][keyed];
+      break;
+    case 8U:
+      blit = blit8[mirror][keyed];
+      break;
+    case 4U:
+      blit = blit4[mirror][keyed];
+      break;
+    case 2U:
+      blit = blit2[mirror][keyed];
+      break;
+    case 1U:
+      blit = blit1[mirror][keyed];
+      break;
+    default:
+      break;
+  }
+  return blit;
+}
+
+// *****************************************************************************
+// ***   Public: GetAlphaBlitter   *********************************************
+// *****************************************************************************
+Blitter::BlitFunction Blitter::GetAlphaBlitter(bool mirror)
+{
+  return mirror ? &BlitAlpha<true> : &BlitAlpha<false>;
+}
+
+// *****************************************************************************
+// ***   Public: BlendLine   ***************************************************
+// *****************************************************************************
+void Blitter::BlendLine(uint16_t* dst, const uint16_t* src, int32_t n, uint32_t alpha)
+{
+  // Align destination to word
+  if((n > 0) && (((uintptr_t)dst & 2U) != 0U))
+  {
+    *dst = Blend(*src++, *dst, alpha);
+    dst++;
+    n--;
+  }
+  PixelPair* d32 = (PixelPair*)dst;
+  bool is_src_aligned = (((uintptr_t)src & 2U) == 0U);
+  // Weight of background: fg * alpha + bg * (ALPHA_MAX - alpha) is one
+  // multiply and one multiply-accumulate for each word
+  const uint32_t inv_alpha = ALPHA_MAX - alpha;
+  for(; n >= 2; n -= 2)
+  {
+#if defined(__ARM_FEATURE_DSP)
+    // Unaligned pair packed by one instruction
+    uint32_t fg = is_src_aligned ? *(const PixelPair*)src : __PKHBT(src[0], src[1], 16);
+#else
+    uint32_t fg = is_src_aligned ? *(const PixelPair*)src : src[0] | ((uint32_t)src[1] << 16);
+#endif
+    uint32_t bg = *d32;
+    src += 2;
+    fg = SwapBytes(fg);
+    bg = SwapBytes(bg);
+    // Split components of two pixels to two words with free bits above each
+    // component: blue and red of first pixel with green of second pixel and
+    // green of first pixel with blue and red of second pixel. Weighted sum of
+    // each component fits in its free bits.
+    uint32_t fg1 = fg & 0x07E0F81FU;
+    uint32_t bg1 = bg & 0x07E0F81FU;
+    uint32_t fg2 = (fg >> 5) & 0x07C0F83FU;
+    uint32_t bg2 = (bg >> 5) & 0x07C0F83FU;
+    fg1 = ((fg1 * alpha + bg1 * inv_alpha) >> 5) & 0x07E0F81FU;
+    fg2 = ((fg2 * alpha + bg2 * inv_alpha) >> 5) & 0x07C0F83FU;
+    *d32++ = SwapBytes(fg1 | (fg2 << 5));
+  }
+  // Last pixel
+  if(n > 0) *(uint16_t*)d32 = Blend(*src, *(uint16_t*)d32, alpha);
+}
+
+// *****************************************************************************
+// ***   Public: FillLine   ****************************************************
+// *****************************************************************************
+void Blitter::FillLine(uint16_t* dst, int32_t n, uint16_t color)
+{
+  // Align destination to word
+  if((n > 0) && (((uintptr_t)dst & 2U) != 0U))
+  {
+    *dst++ = color;
+    n--;
+  }
+  PixelPair* d32 = (PixelPair*)dst;
+  const uint32_t pair = color | ((uint32_t)color << 16);
+  for(; n >= 8; n -= 8)
+  {
+    d32[0] = pair;
+    d32[1] = pair;
+    d32[2] = pair;
+    d32[3] = pair;
+    d32 += 4;
+  }
+  for(; n >= 2; n -= 2) *d32++ = pair;
+  // Last pixel
+  if(n > 0) *(uint16_t*)d32 = color;
+}
+
+// *****************************************************************************
+// ***   Private: Read next pixel of 16-bit image   ****************************
+// *****************************************************************************
+template<bool MIRROR>
+inline uint32_t Blitter::Next(const uint16_t*& p, const uint16_t* palette)
+{
+  return MIRROR ? *p-- : *p++;
+}
+
+// *****************************************************************************
+// ***   Private: Read next pixel of 8-bit image   *****************************
+// *****************************************************************************
+template<bool MIRROR>
+inline uint32_t Blitter::Next(const uint8_t*& p, const uint16_t* palette)
+{
+  return palette[MIRROR ? *p-- : *p++];
+}
+
+// *****************************************************************************
+// ***   Private: Opaque blit kernel   *****************************************
+// *****************************************************************************
+template<typename T, bool MIRROR>
+void Blitter::BlitOpaque(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key)
+{
+  const T* p = (const T*)src + idx;
+  // Align destination to word
+  if((n > 0) && (((uintptr_t)dst & 2U) != 0U))
+  {
+    *dst++ = Next<MIRROR>(p, palette);
+    n--;
+  }
+  PixelPair* d32 = (PixelPair*)dst;
+  // If source aligned too - 16-bit image can be copied by words
+  if((sizeof(T) == 2U) && !MIRROR && (((uintptr_t)p & 2U) == 0U))
+  {
+    const PixelPair* s32 = (const PixelPair*)p;
+    for(; n >= 2; n -= 2) *d32++ = *s32++;
+    p = (const T*)s32;
+  }
+  else
+  {
+    // Pack two pixels to word, little endian: first pixel in low half
+    for(; n >= 2; n -= 2)
+    {
+      uint32_t lo = Next<MIRROR>(p, palette);
+      uint32_t hi = Next<MIRROR>(p, palette);
+      *d32++ = lo | (hi << 16);
+    }
+  }
+  // Last pixel
+  if(n > 0) *(uint16_t*)d32 = Next<MIRROR>(p, palette);
+}
+
+// *****************************************************************************
+// ***   Private: Color keyed blit kernel   ************************************
+// *****************************************************************************
+template<typename T, bool MIRROR>
+void Blitter::BlitKeyed(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key)
+{
+  const T* p = (const T*)src + idx;
+  // Align destination to word
+  if((n > 0) && (((uintptr_t)dst & 2U) != 0U))
+  {
+    uint16_t data = Next<MIRROR>(p, palette);
+    if(data != key) *dst = data;
+    dst++;
+    n--;
+  }
+  PixelPair* d32 = (PixelPair*)dst;
+#if defined(__ARM_FEATURE_SIMD32)
+  // Key in both halves of word
+  const uint32_t key2 = key | ((uint32_t)key << 16);
+#endif
+  for(; n >= 2; n -= 2)
+  {
+    uint32_t lo = Next<MIRROR>(p, palette);
+    uint32_t hi = Next<MIRROR>(p, palette);
+    uint32_t data = lo | (hi << 16);
+#if defined(__ARM_FEATURE_SIMD32)
+    // Halfword of XOR is non zero for opaque pixel: USUB16 sets GE flags for
+    // halves greater or equal 1 and SEL takes opaque pixels from data and
+    // transparent from buffer
+    (void)__USUB16(data ^ key2, 0x00010001U);
+    *d32 = __SEL(data, *d32);
+#else
+    if(lo == key) data = (data & 0xFFFF0000U) | (*d32 & 0x0000FFFFU);
+    if(hi == key) data = (data & 0x0000FFFFU) | (*d32 & 0xFFFF0000U);
+    *d32 = data;
+#endif
+    d32++;
+  }
+  // Last pixel
+  if(n > 0)
+  {
+    uint16_t data = Next<MIRROR>(p, palette);
+    if(data != key) *(uint16_t*)d32 = data;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Packed 1, 2 and 4-bit images blit kernel   *******************
+// *****************************************************************************
+template<uint32_t BPP, bool MIRROR, bool KEYED>
+void Blitter::BlitPacked(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key)
+{
+  // Pixels per byte and mask of one pixel
+  const uint32_t PPB = 8U / BPP;
+  const uint32_t MASK = (1U << BPP) - 1U;
+  // Byte with first pixel and position of pixel in byte
+  const uint8_t* p = (const uint8_t*)src + idx / PPB;
+  uint32_t sub = idx % PPB;
+
+  // Unpack pixels until byte boundary
+  if((n > 0) && (sub != (MIRROR ? PPB - 1U : 0U)))
+  {
+    uint32_t data = *p;
+    while(n > 0)
+    {
+      uint16_t color = palette[(data >> (8U - BPP * (sub + 1U))) & MASK];
+      if(!KEYED || (color != key)) *dst = color;
+      dst++;
+      n--;
+      if(MIRROR ? (sub-- == 0U) : (++sub == PPB)) break;
+    }
+    if(MIRROR) p--;
+    else       p++;
+  }
+  // Unpack whole bytes, compiler unrolls inner cycle
+  for(; n >= (int32_t)PPB; n -= PPB)
+  {
+    uint32_t data = MIRROR ? *p-- : *p++;
+    for(uint32_t i = 0U; i < PPB; i++)
+    {
+      // Mirrored kernel takes pixels from the least significant bits
+      uint32_t shift = MIRROR ? (BPP * i) : (8U - BPP * (i + 1U));
+      uint16_t color = palette[(data >> shift) & MASK];
+      if(!KEYED || (color != key)) dst[i] = color;
+    }
+    dst += PPB;
+  }
+  // Last pixels
+  if(n > 0)
+  {
+    uint32_t data = *p;
+    for(int32_t i = 0; i < n; i++)
+    {
+      uint32_t shift = MIRROR ? (BPP * i) : (8U - BPP * (i + 1U));
+      uint16_t color = palette[(data >> shift) & MASK];
+      if(!KEYED || (color != key)) dst[i] = color;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Alpha blended blit kernel   **********************************
+// *****************************************************************************
+template<bool MIRROR>
+void Blitter::BlitAlpha(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key)
+{
+  const uint8_t* p = (const uint8_t*)src + idx;
+  for(int32_t i = 0; i < n; i++)
+  {
+    uint32_t data = MIRROR ? *p-- : *p++;
+    uint32_t alpha = data >> 4U;
+    // Most pixels are fully opaque or fully transparent, blend only edges
+    if(alpha == 0xFU)
+    {
+      dst[i] = palette[data & 0xFU];
+    }
+    else if(alpha != 0U)
+    {
+      // Scale alpha from 0..15 to 0..ALPHA_MAX
+      dst[i] = Blend(palette[data & 0xFU], dst[i], (alpha << 1U) | (alpha >> 3U));
+    }
+  }
+}
@@ -0,0 +1,171 @@
+//******************************************************************************
+//  @file Blitters.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Span blitter kernels, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef Blitters_h
+#define Blitters_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// *****************************************************************************
+// ***   Blitter Class   *******************************************************
+// *****************************************************************************
+// * Set of specialized kernels for copy span of image pixels to line buffer.
+// * Kernel selected once when image parameters changed, so kernels have no
+// * per-pixel checks of image format, flip or transparency.
+class Blitter
+{
+  public:
+    // *************************************************************************
+    // ***   Blit function type   **********************************************
+    // *************************************************************************
+    // * Copy n pixels starting from pixel idx of src to dst. For mirrored
+    // * kernels idx is the rightmost pixel of span and kernel reads image
+    // * backward. Pixels of packed 1, 2 and 4-bit images stored from the most
+    // * significant bits of byte. Palette isn't used by 16-bit kernels, key
+    // * used only by color keyed kernels.
+    typedef void (*BlitFunction)(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key);
+
+    // *************************************************************************
+    // ***   Get blit function   ***********************************************
+    // *************************************************************************
+    // * Returns kernel for image format or nullptr if format isn't supported.
+    static BlitFunction GetBlitter(uint8_t bits_per_pixel, bool mirror, bool keyed);
+
+    // *************************************************************************
+    // ***   Get blit function for images with alpha channel   *****************
+    // *************************************************************************
+    // * Kernel for 8-bit images with 4-bit alpha in high nibble and index of
+    // * color in 16 color palette in low nibble of each byte.
+    static BlitFunction GetAlphaBlitter(bool mirror);
+
+    // *************************************************************************
+    // ***   Blend one pixel   *************************************************
+    // *************************************************************************
+    // * Blend color fg over color bg. Alpha from 0(bg) to ALPHA_MAX(fg). Colors
+    // * stored with swapped bytes as in line buffer.
+    static inline uint16_t Blend(uint32_t fg, uint32_t bg, uint32_t alpha)
+    {
+      fg = SwapBytes(fg);
+      bg = SwapBytes(bg);
+      // Move green to upper half of word, so each component has free bits
+      // above it for multiplication by alpha
+      fg = (fg | (fg << 16)) & 0x07E0F81FU;
+      bg = (bg | (bg << 16)) & 0x07E0F81FU;
+      uint32_t result = ((((fg - bg) * alpha) >> 5) + bg) & 0x07E0F81FU;
+      return SwapBytes(result | (result >> 16));
+    }
+
+    // *************************************************************************
+    // ***   Blend line   ******************************************************
+    // *************************************************************************
+    // * Blend n pixels of src over dst with the same alpha. Two pixels blended
+    // * by each 32-bit operation, result is the same as Blend() of each pixel.
+    static void BlendLine(uint16_t* dst, const uint16_t* src, int32_t n, uint32_t alpha);
+
+    // *************************************************************************
+    // ***   Fill line   *******************************************************
+    // *************************************************************************
+    // * Fill n pixels of dst by color. Two pixels stored by each 32-bit write.
+    static void FillLine(uint16_t* dst, int32_t n, uint16_t color);
+
+    // Alpha of fully opaque pixel for blend functions
+    static const uint32_t ALPHA_MAX = 32U;
+
+  private:
+    // *************************************************************************
+    // ***   Swap bytes in each half of word   *********************************
+    // *************************************************************************
+    static inline uint32_t SwapBytes(uint32_t x)
+    {
+#if defined(__ARM_FEATURE_SIMD32)
+      return __REV16(x);
+#else
+      return ((x >> 8) & 0x00FF00FFU) | ((x << 8) & 0xFF00FF00U);
+#endif
+    }
+
+    // *************************************************************************
+    // ***   Read next pixel of 16-bit image   *********************************
+    // *************************************************************************
+    template<bool MIRROR>
+    static inline uint32_t Next(const uint16_t*& p, const uint16_t* palette);
+
+    // *************************************************************************
+    // ***   Read next pixel of 8-bit image   **********************************
+    // *************************************************************************
+    template<bool MIRROR>
+    static inline uint32_t Next(const uint8_t*& p, const uint16_t* palette);
+
+    // *************************************************************************
+    // ***   Opaque blit kernel   **********************************************
+    // *************************************************************************
+    template<typename T, bool MIRROR>
+    static void BlitOpaque(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key);
+
+    // *************************************************************************
+    // ***   Color keyed blit kernel   *****************************************
+    // *************************************************************************
+    template<typename T, bool MIRROR>
+    static void BlitKeyed(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key);
+
+    // *************************************************************************
+    // ***   Packed 1, 2 and 4-bit images blit kernel   ************************
+    // *************************************************************************
+    template<uint32_t BPP, bool MIRROR, bool KEYED>
+    static void BlitPacked(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key);
+
+    // *************************************************************************
+    // ***   Alpha blended blit kernel   ***************************************
+    // *************************************************************************
+    template<bool MIRROR>
+    static void BlitAlpha(uint16_t* dst, const void* src, int32_t idx, int32_t n, const uint16_t* palette, uint16_t key);
+};
+
+#endif
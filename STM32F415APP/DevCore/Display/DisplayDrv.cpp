@@ -19,6 +19,23 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "DisplayDrv.h"
+#include "AssetDrv.h"
+
+// *****************************************************************************
+// ***   HAL SPI transfer complete callback   **********************************
+// *****************************************************************************
+extern "C" void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi)
+{
+  DisplayDrv::GetInstance().TransferCompleteCallback(hspi);
+}
+
+// *****************************************************************************
+// ***   HAL SPI error callback   **********************************************
+// *****************************************************************************
+extern "C" void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+{
+  DisplayDrv::GetInstance().TransferErrorCallback(hspi);
+}
 
 // *****************************************************************************
 // ***   Get Instance   ********************************************************
@@ -34,8 +51,11 @@ DisplayDrv& DisplayDrv::GetInstance(void)
 // *****************************************************************************
 Result DisplayDrv::Setup()
 {
+  // Set callback for band transfers
+  tft->SetCallback(BandSentCallback, this);
+  tft->SetErrorCallback(BandErrorCallback, this);
   // Init display driver
-  tft.Init();
+  tft->Init();
   // Set mode - mode can be set earlier than Display initialization
   SetUpdateMode(update_mode);
 
@@ -63,6 +83,17 @@ Result DisplayDrv::Setup()
     // Max Z
     fps_str.Show(0xFFFFFFFFU);
   }
+  // Enable CPU cycles counter and show profile string if flag is set
+  if(DISPLAY_PROFILE_INFO)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    prof_str.SetParams(prof_str_buf, 0, height - 12, COLOR_MAGENTA, String::FONT_4x6);
+    prof_str.Show(0xFFFFFFFFU);
+    asset_str.SetParams(asset_str_buf, 0, height - 18, COLOR_MAGENTA, String::FONT_4x6);
+    asset_str.Show(0xFFFFFFFFU);
+  }
 
   // Always ok
   return Result::RESULT_OK;
@@ -81,49 +112,108 @@ Result DisplayDrv::Loop()
   // updated
   if(screen_update.Take(100U) == Result::RESULT_OK)
   {
-    // Set window for all screen and pointer to first pixel
+    // Frame start time for frame time histogram and frame pacing
+    uint32_t start_ms = HAL_GetTick();
+    uint32_t start_ticks = RtosTick::GetTickCount();
+    uint32_t start_cycles = DISPLAY_PROFILE_INFO ? GetCycleCnt() : 0U;
+    // Update requests made after this point will start next frame
+    frame_in_progress = true;
+    // Lock display for draw frame
     LockDisplay();
-    // Set address window for all screen
-    tft.SetAddrWindow(0, 0, width-1, height-1);
-    // For each line/row
-    for(int32_t i=0; i < height; i++)
-    {
-      // Clear half of buffer
-      memset(scr_buf[i%2], 0x00, sizeof(scr_buf[0]));
-      // Take semaphore before draw line
-      line_mutex.Lock();
-      // Set pointer to first element
-      VisObject* p_obj = object_list;
-      // Do for all objects
-      while(p_obj != nullptr)
-      {
-        // Draw object to buf
-        if(update_mode) p_obj->DrawInBufH(scr_buf[i%2], width, i);
-        else            p_obj->DrawInBufW(scr_buf[i%2], width, i);
-        // Set pointer to next object in list
-        p_obj = p_obj->p_next;
-      }
-      // Give semaphore after changes
-      line_mutex.Release();
-      // Wait until previous transfer complete
-      while(tft.IsTransferComplete() == false) taskYIELD();
-      // Write stream to LCD
-      tft.SpiWriteStream((uint8_t*)scr_buf[i%2], width*tft.GetBytesPerPixel());
-      // DO NOT TRY "OPTIMIZE" CODE !!!
-      // Two "while" cycles used for generate next line when previous line
-      // transfer via SPI to display.
-    }
-    // Wait until last transfer complete
-    while(tft.IsTransferComplete() == false) taskYIELD();
-    // Pull up CS
-    tft.StopTransfer();
+    // Apply objects changes, sort objects by Y and update objects order.
+    // Changes invalidate objects areas, so it should be done before copy
+    // list of changed areas.
+    line_mutex.Lock();
+    ApplyChanges();
+    ApplyScroll();
+    PrepareLists();
+    line_mutex.Release();
+    // Copy list of changed areas and clear it
+    Area areas[MAX_DIRTY_AREAS];
+    uint32_t areas_cnt = 0U;
+    Rtos::EnterCriticalSection();
+    // In vertical mode objects drawn by rows, so redraw whole screen
+    if(update_mode && (dirty_areas_cnt != 0U))
+    {
+      areas[0].x1 = 0;
+      areas[0].y1 = 0;
+      areas[0].x2 = width - 1;
+      areas[0].y2 = height - 1;
+      areas_cnt = 1U;
+    }
+    else
+    {
+      for(; areas_cnt < dirty_areas_cnt; areas_cnt++) areas[areas_cnt] = dirty_areas[areas_cnt];
+    }
+    dirty_areas_cnt = 0U;
+    Rtos::ExitCriticalSection();
+    // Pixels counter
+    uint32_t pixels = 0U;
+    // Draw all changed areas
+    for(uint32_t a = 0U; a < areas_cnt; a++)
+    {
+      // Draw area
+      DrawArea(areas[a]);
+      // Count pixels
+      pixels += GetAreaSize(areas[a]);
+    }
     // Give semaphore after draw frame
     UnlockDisplay();
+    // Bands dropped by transfer error - redraw whole screen in next frame
+    if(is_band_lost)
+    {
+      is_band_lost = false;
+      InvalidateDisplay();
+      UpdateDisplay();
+    }
+    // Save pixels count
+    pixels_per_frame = pixels;
+    // Save render profile of frame
+    if(DISPLAY_PROFILE_INFO)
+    {
+      FinishProfile(GetCycleCnt() - start_cycles);
+    }
+    // Notify driver which collects statistic of frame
+    Rtos::EnterCriticalSection();
+    void (*callback)(void* ptr) = frame_done_callback;
+    void* callback_ptr = frame_done_callback_ptr;
+    Rtos::ExitCriticalSection();
+    if(callback != nullptr)
+    {
+      callback(callback_ptr);
+    }
+    // Update frame counter and wake up tasks waiting for frame done
+    Rtos::EnterCriticalSection();
+    frame_cnt++;
+    frame_in_progress = false;
+    for(uint32_t i = 0U; i < MAX_FRAME_WAITERS; i++)
+    {
+      // Counter can overflow, so check difference
+      if(   (frame_waiters[i].task != nullptr)
+         && ((int32_t)(frame_cnt - frame_waiters[i].frame) >= 0) )
+      {
+        Rtos::TaskNotifyGive(frame_waiters[i].task);
+        frame_waiters[i].task = nullptr;
+      }
+    }
+    Rtos::ExitCriticalSection();
+    // Update frame time histogram
+    uint32_t bin = (HAL_GetTick() - start_ms) / FRAME_HIST_BIN_MS;
+    if(bin >= FRAME_HIST_BINS) bin = FRAME_HIST_BINS - 1U;
+    frame_time_hist[bin]++;
     // Calculate FPS if debug info is ON
     if(DISPLAY_DEBUG_INFO)
     {
-      // FPS in format XX.X
-      fps_x10 = (1000 * 10) / (HAL_GetTick() - time_ms);
+      // Frame time
+      uint32_t frame_ms = HAL_GetTick() - time_ms;
+      // FPS in format XX.X, frame can take less than 1 ms if changes are small
+      fps_x10 = (1000 * 10) / ((frame_ms != 0U) ? frame_ms : 1U);
+    }
+    // Don't start next frame before frame period expired. Update requests
+    // made during this delay will be coalesced.
+    if(frame_period_ms != 0U)
+    {
+      RtosTick::DelayUntilMs(start_ticks, frame_period_ms);
     }
   }
 
@@ -246,14 +336,38 @@ Result DisplayDrv::Loop()
   if(DISPLAY_DEBUG_INFO)
   {
     if(is_touch) sprintf(str, "X: %4ld, Y: %4ld", tx, ty);
-    else sprintf(str, "FPS: %2lu.%1lu, time: %lu", fps_x10/10, fps_x10%10, RtosTick::GetTimeMs()/1000UL);
+    else sprintf(str, "FPS: %2lu.%1lu, time: %lu, px: %lu", fps_x10/10, fps_x10%10, RtosTick::GetTimeMs()/1000UL, pixels_per_frame);
     fps_str.SetString(str);
   }
+  // Print profile of last frame in thousands of cycles
+  if(DISPLAY_PROFILE_INFO)
+  {
+    snprintf(prof_str_buf, sizeof(prof_str_buf), "cmp: %lu max: %lu dma: %lu mtx: %lu top(%d,%d): %lu",
+             last_profile.compose_cycles/1000UL, last_profile.max_line_cycles/1000UL,
+             last_profile.dma_wait_cycles/1000UL, last_profile.mutex_wait_cycles/1000UL,
+             last_profile.top_obj_x, last_profile.top_obj_y,
+             last_profile.top_obj_cycles/1000UL);
+    prof_str.SetString(prof_str_buf);
+    // Asset cache statistic of last frame
+    AssetDrv::Stats stats;
+    AssetDrv::GetInstance().GetFrameStats(stats);
+    snprintf(asset_str_buf, sizeof(asset_str_buf), "asset hit: %lu miss: %lu read: %lu",
+             stats.hits, stats.misses, stats.bytes_read);
+    asset_str.SetString(asset_str_buf);
+  }
 
   // Always run
   return Result::RESULT_OK;
 }
 
+// *****************************************************************************
+// ***   Check if Visual Object in object list   *******************************
+// *****************************************************************************
+bool DisplayDrv::IsVisObjectInList(VisObject* obj)
+{
+  return (obj != nullptr) && ((obj->p_prev != nullptr) || (obj->p_next != nullptr) || (obj == object_list));
+}
+
 // *****************************************************************************
 // ***   Add Visual Object to object list   ************************************
 // *****************************************************************************
@@ -265,6 +379,8 @@ Result DisplayDrv::AddVisObjectToList(VisObject* obj, uint32_t z)
   {
     // Take semaphore before add to list
     line_mutex.Lock();
+    // Object isn't drawn yet, so apply changes made while it was hidden
+    ApplyObjectChanges(obj);
     // Set object Z
     obj->z = z;
     // Set prev pointer to nullptr
@@ -312,8 +428,27 @@ Result DisplayDrv::AddVisObjectToList(VisObject* obj, uint32_t z)
       // Set prev pointer to new object in list
       obj->p_prev = p_last;
     }
+    // Find position in the list sorted by Y
+    VisObject* p_y = y_list;
+    VisObject* p_yprev = nullptr;
+    while((p_y != nullptr) && (GetTopY(p_y) <= GetTopY(obj)))
+    {
+      p_yprev = p_y;
+      p_y = p_y->p_ynext;
+    }
+    // Insert object to the list sorted by Y
+    obj->p_yprev = p_yprev;
+    obj->p_ynext = p_y;
+    if(p_yprev != nullptr) p_yprev->p_ynext = obj;
+    else                   y_list = obj;
+    if(p_y != nullptr) p_y->p_yprev = obj;
+    // Real rank will be set before next frame, use rank of previous object
+    // for case if object added during frame drawing
+    obj->rank = (obj->p_prev != nullptr) ? obj->p_prev->rank : 0U;
     // Give semaphore after changes
     line_mutex.Release();
+    // Object area should be redrawn
+    InvalidateVisObject(obj);
     // Set return status
     result = Result::RESULT_OK;
   }
@@ -328,41 +463,30 @@ Result DisplayDrv::DelVisObjectFromList(VisObject* obj)
 {
   Result result = Result::ERR_NULL_PTR;
 
-  if((obj != nullptr) && ((obj->p_prev != nullptr) || (obj->p_next != nullptr) || (obj == object_list)) )
+  if(IsVisObjectInList(obj))
   {
+    // Object area should be redrawn
+    InvalidateVisObject(obj);
     // Take semaphore before delete from list
     line_mutex.Lock();
-    // Remove element from head
-    if(obj == object_list)
-    {
-      // Set pointer to next object or clear pointer if no more elements
-      object_list = obj->p_next;
-      // Clear previous element in first object
-      object_list->p_prev = nullptr;
-    }
-    else if(obj == object_list_last)
-    {
-      // Set next pointer in previous object to nullptr
-      obj->p_prev->p_next = nullptr;
-      // Set pointer to previous object
-      object_list_last = obj->p_prev;
-    }
-    else
-    {
-      // Remove element from head
-      if(obj->p_prev == nullptr) object_list = obj->p_next;
-      // Remove element from middle
-      else if(obj->p_next != nullptr)
-      {
-        obj->p_prev->p_next = obj->p_next;
-        obj->p_next->p_prev = obj->p_prev;
-      }
-      // remove element from tail
-      else obj->p_prev->p_next = nullptr;
-    }
+    // Remove element from list
+    if(obj->p_prev != nullptr) obj->p_prev->p_next = obj->p_next;
+    else                       object_list = obj->p_next;
+    if(obj->p_next != nullptr) obj->p_next->p_prev = obj->p_prev;
+    else                       object_list_last = obj->p_prev;
+    // Object can be deleted during frame drawing, so it should be removed
+    // from list of objects on current line and cursor should be moved
+    DelFromActiveList(obj);
+    if(y_list_cursor == obj) y_list_cursor = obj->p_ynext;
+    // Remove element from list sorted by Y
+    if(obj->p_yprev != nullptr) obj->p_yprev->p_ynext = obj->p_ynext;
+    else                        y_list = obj->p_ynext;
+    if(obj->p_ynext != nullptr) obj->p_ynext->p_yprev = obj->p_yprev;
     // Clear pointers in object
     obj->p_prev = nullptr;
     obj->p_next = nullptr;
+    obj->p_yprev = nullptr;
+    obj->p_ynext = nullptr;
     // Give semaphore after changes
     line_mutex.Release();
     // Set return status
@@ -423,10 +547,274 @@ Result DisplayDrv::UpdateDisplay(void)
 {
   // Give semaphore for update screen
   Result result = screen_update.Give();
+  // If semaphore already given - frame already requested
+  if(result == Result::ERR_SEMAPHORE_GIVE)
+  {
+    // Many tasks can request update at the same time
+    Rtos::EnterCriticalSection();
+    coalesced_updates_cnt++;
+    Rtos::ExitCriticalSection();
+    result = Result::RESULT_OK;
+  }
+  // Return result
+  return result;
+}
+
+// *****************************************************************************
+// ***   Wait for frame done   *************************************************
+// *****************************************************************************
+Result DisplayDrv::WaitForFrameDone(uint32_t wait_ms)
+{
+  Result result = Result::ERR_BUSY;
+  TaskHandle_t task = Rtos::GetCurrentTask();
+  // Deadline is absolute, so wake up before target frame doesn't restart
+  // timeout
+  TickType_t start_ticks = RtosTick::GetTickCount();
+  TickType_t wait_ticks = (wait_ms == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms);
+  // Clear notification given after previous call timed out
+  (void) Rtos::TaskNotifyTake(0U);
+  // If frame drawing in progress, changes made before call can be missed in
+  // it, so wait for next frame
+  uint32_t target_frame = 0U;
+  uint32_t idx = MAX_FRAME_WAITERS;
+  Rtos::EnterCriticalSection();
+  target_frame = frame_cnt + (frame_in_progress ? 2U : 1U);
+  for(uint32_t i = 0U; i < MAX_FRAME_WAITERS; i++)
+  {
+    if(frame_waiters[i].task == nullptr)
+    {
+      frame_waiters[i].task = task;
+      frame_waiters[i].frame = target_frame;
+      idx = i;
+      break;
+    }
+  }
+  Rtos::ExitCriticalSection();
+  // Wait only if task registered
+  if(idx < MAX_FRAME_WAITERS)
+  {
+    result = Result::RESULT_OK;
+    // Counter can overflow, so check difference
+    while((result.IsGood()) && ((int32_t)(frame_cnt - target_frame) < 0))
+    {
+      TickType_t ticks = portMAX_DELAY;
+      if(wait_ticks != portMAX_DELAY)
+      {
+        TickType_t elapsed = RtosTick::GetTickCount() - start_ticks;
+        ticks = (elapsed < wait_ticks) ? (wait_ticks - elapsed) : 0U;
+      }
+      result = Rtos::TaskNotifyTake(ticks);
+    }
+    // Remove task from waiters if display task didn't do it
+    Rtos::EnterCriticalSection();
+    if(frame_waiters[idx].task == task)
+    {
+      frame_waiters[idx].task = nullptr;
+    }
+    Rtos::ExitCriticalSection();
+  }
   // Return result
   return result;
 }
 
+// *****************************************************************************
+// ***   Scroll screen   *******************************************************
+// *****************************************************************************
+bool DisplayDrv::ScrollScreen(VisObject* obj, int32_t dx)
+{
+  bool result = false;
+  // Hardware scroll moves display along X only in horizontal mode. Only one
+  // object per frame can be scrolled and it must be in the list and cover
+  // whole screen width.
+  if(   (update_mode == false) && (obj != nullptr)
+     && ((scroll_obj == nullptr) || (scroll_obj == obj))
+     && ((obj->p_prev != nullptr) || (obj->p_next != nullptr) || (obj == object_list))
+     && (obj->x_start <= 0) && (obj->x_end >= width - 1) )
+  {
+    scroll_obj = obj;
+    scroll_dx += dx;
+    result = true;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get render profile of last frame   ************************************
+// *****************************************************************************
+void DisplayDrv::GetProfile(Profile& prof)
+{
+  Rtos::EnterCriticalSection();
+  prof = last_profile;
+  Rtos::ExitCriticalSection();
+}
+
+// *****************************************************************************
+// ***   Set target FPS   ******************************************************
+// *****************************************************************************
+void DisplayDrv::SetTargetFps(uint32_t fps)
+{
+  frame_period_ms = (fps != 0U) ? (1000U / fps) : 0U;
+}
+
+// *****************************************************************************
+// ***   Set frame done callback   *********************************************
+// *****************************************************************************
+void DisplayDrv::SetFrameDoneCallback(void (*clbk)(void* ptr), void* clbk_ptr)
+{
+  Rtos::EnterCriticalSection();
+  frame_done_callback = clbk;
+  frame_done_callback_ptr = clbk_ptr;
+  Rtos::ExitCriticalSection();
+}
+
+// *****************************************************************************
+// ***   Get frame time histogram   ********************************************
+// *****************************************************************************
+void DisplayDrv::GetFrameTimeHistogram(uint32_t* hist, uint32_t n)
+{
+  if(hist != nullptr)
+  {
+    if(n > FRAME_HIST_BINS) n = FRAME_HIST_BINS;
+    for(uint32_t i = 0U; i < n; i++) hist[i] = frame_time_hist[i];
+  }
+}
+
+// *****************************************************************************
+// ***   Reset frame statistics   **********************************************
+// *****************************************************************************
+void DisplayDrv::ResetFrameStats(void)
+{
+  coalesced_updates_cnt = 0U;
+  for(uint32_t i = 0U; i < FRAME_HIST_BINS; i++) frame_time_hist[i] = 0U;
+}
+
+// *****************************************************************************
+// ***   Invalidate area   *****************************************************
+// *****************************************************************************
+void DisplayDrv::InvalidateArea(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+  // Sort coordinates
+  if(x1 > x2) {int32_t tmp = x1; x1 = x2; x2 = tmp;}
+  if(y1 > y2) {int32_t tmp = y1; y1 = y2; y2 = tmp;}
+  // Clip area to the screen
+  if(x1 < 0) x1 = 0;
+  if(y1 < 0) y1 = 0;
+  if(x2 > width - 1)  x2 = width - 1;
+  if(y2 > height - 1) y2 = height - 1;
+  // Check if area on the screen
+  if((x1 <= x2) && (y1 <= y2))
+  {
+    // New area
+    Area area = {(int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2};
+    // Function can be called from any task, so list protected by critical
+    // section - line mutex can be already taken by caller
+    Rtos::EnterCriticalSection();
+    // Each iteration either adds area to the list or merge it with one of
+    // areas from the list, so cycle is finite
+    while(true)
+    {
+      uint32_t i = 0U;
+      // Find area which overlaps new area
+      while((i < dirty_areas_cnt) && !IsAreasAdjacent(area, dirty_areas[i])) i++;
+      // If nothing found and we have free space - add area to the list
+      if((i == dirty_areas_cnt) && (dirty_areas_cnt < MAX_DIRTY_AREAS))
+      {
+        dirty_areas[dirty_areas_cnt++] = area;
+        break;
+      }
+      // If nothing found - find area that gives smallest merged area
+      if(i == dirty_areas_cnt)
+      {
+        uint32_t min_size = 0xFFFFFFFFU;
+        for(uint32_t j = 0U; j < dirty_areas_cnt; j++)
+        {
+          uint32_t size = GetAreaSize(MergeAreas(area, dirty_areas[j])) - GetAreaSize(dirty_areas[j]);
+          if(size < min_size)
+          {
+            min_size = size;
+            i = j;
+          }
+        }
+      }
+      // Merge areas and remove old one from the list. Merged area can
+      // overlap other areas, so it will be checked again.
+      area = MergeAreas(area, dirty_areas[i]);
+      dirty_areas[i] = dirty_areas[--dirty_areas_cnt];
+    }
+    // Exit critical section
+    Rtos::ExitCriticalSection();
+  }
+}
+
+// *****************************************************************************
+// ***   Invalidate Visual Object area   ***************************************
+// *****************************************************************************
+void DisplayDrv::InvalidateVisObject(VisObject* obj)
+{
+  // Only objects in the list are visible on the screen
+  if(IsVisObjectInList(obj))
+  {
+    InvalidateArea(obj->x_start, obj->y_start, obj->x_end, obj->y_end);
+  }
+}
+
+// *****************************************************************************
+// ***   Invalidate display   **************************************************
+// *****************************************************************************
+void DisplayDrv::InvalidateDisplay(void)
+{
+  InvalidateArea(0, 0, width - 1, height - 1);
+}
+
+// *****************************************************************************
+// ***   SPI transfer complete callback   **************************************
+// *****************************************************************************
+void DisplayDrv::TransferCompleteCallback(SPI_HandleTypeDef* hspi)
+{
+  // ILI9341 driver checks SPI handle and calls BandSentCallback()
+  ili9341.TransferCompleteCallback(hspi);
+}
+
+// *****************************************************************************
+// ***   SPI transfer error callback   *****************************************
+// *****************************************************************************
+void DisplayDrv::TransferErrorCallback(SPI_HandleTypeDef* hspi)
+{
+  // ILI9341 driver aborts solid fill if it in progress or calls
+  // BandErrorCallback()
+  ili9341.TransferErrorCallback(hspi);
+}
+
+// *****************************************************************************
+// ***   Set display back-end   ************************************************
+// *****************************************************************************
+void DisplayDrv::SetDisplay(IDisplay& disp)
+{
+  tft = &disp;
+}
+
+// *****************************************************************************
+// ***   Private: Band sent callback   *****************************************
+// *****************************************************************************
+void DisplayDrv::BandSentCallback(void* ptr)
+{
+  DisplayDrv& drv = *(DisplayDrv*)ptr;
+  // Check if band transfer in progress
+  if(drv.band_cnt != 0U)
+  {
+    // Band sent
+    drv.band_tail = (drv.band_tail + 1U) % DISPLAY_BAND_BUFFERS;
+    drv.band_cnt--;
+    // Start next band transfer if it ready
+    if(drv.band_cnt != 0U)
+    {
+      drv.tft->WriteDataStream((uint8_t*)drv.scr_buf[drv.band_tail], drv.band_size[drv.band_tail]);
+    }
+    // Wake up display task
+    drv.band_sent.Give();
+  }
+}
+
 // *****************************************************************************
 // ***   Set Update Mode   *****************************************************
 // *****************************************************************************
@@ -435,23 +823,28 @@ void DisplayDrv::SetUpdateMode(bool is_vertical)
   // Lock display
   LockDisplay();
   // Wait while transfer complete before change settings
-  while(tft.IsTransferComplete() == false);
+  while(tft->IsTransferComplete() == false);
   // Change Update mode
   if(is_vertical)
   {
-    tft.SetRotation(2U);
+    tft->SetRotation(2U);
   }
   else
   {
-    tft.SetRotation(3U);
+    tft->SetRotation(3U);
   }
   // Set width and height variables for selected screen update mode
-  width = tft.GetWidth();
-  height = tft.GetHeight();
+  width = tft->GetWidth();
+  height = tft->GetHeight();
+  // Reset hardware scroll
+  scroll_offset = 0;
+  tft->SetScrollOffset(0U);
   // Save Update mode
   update_mode = is_vertical;
+  // Whole screen should be redrawn
+  InvalidateDisplay();
   // Unlock display
-  UnlockDisplay();  
+  UnlockDisplay();
 }
 
 // *****************************************************************************
@@ -571,3 +964,503 @@ void DisplayDrv::TouchCalibrate()
   // Hide box
   box.Hide();
 }
+
+// *****************************************************************************
+// ***   Private: Draw area   **************************************************
+// *****************************************************************************
+void DisplayDrv::DrawArea(const Area& area)
+{
+  // Screen X coordinate stored at start of display memory
+  int32_t wrap_x = width - scroll_offset;
+  // Area which crosses end of display memory should be drawn as two areas
+  if((scroll_offset != 0) && (area.x1 < wrap_x) && (area.x2 >= wrap_x))
+  {
+    Area left = area;
+    left.x2 = wrap_x - 1;
+    DrawArea(left);
+    Area right = area;
+    right.x1 = wrap_x;
+    DrawArea(right);
+  }
+  else if(IsAreaEmpty(area))
+  {
+    // Area position in display memory
+    int32_t mem_x = (area.x1 + scroll_offset) % width;
+    // Nothing to compose - fill area by DMA
+    tft->FillRect(mem_x, area.y1, area.x2 - area.x1 + 1, area.y2 - area.y1 + 1, COLOR_BLACK);
+  }
+  else
+  {
+    DrawAreaLines(area);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Check if area doesn't contain any objects   ******************
+// *****************************************************************************
+bool DisplayDrv::IsAreaEmpty(const Area& area)
+{
+  bool result = true;
+  // Take semaphore before walk thru list
+  line_mutex.Lock();
+  for(VisObject* p_obj = object_list; (p_obj != nullptr) && result; p_obj = p_obj->p_next)
+  {
+    if((GetTopY(p_obj) <= area.y2) && (GetBottomY(p_obj) >= area.y1) && IsInAreaX(p_obj, area))
+    {
+      result = false;
+    }
+  }
+  // Give semaphore after walk thru list
+  line_mutex.Release();
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Draw area lines   ********************************************
+// *****************************************************************************
+void DisplayDrv::DrawAreaLines(const Area& area)
+{
+  // Area width
+  int32_t w = area.x2 - area.x1 + 1;
+  // Area position in display memory
+  int32_t mem_x = (area.x1 + scroll_offset) % width;
+  // Set address window for area
+  tft->SetAddrWindow(mem_x, area.y1, mem_x + w - 1, area.y2);
+  // Take semaphore before change lists
+  line_mutex.Lock();
+  // Objects on line will be collected from first object in the list sorted
+  // by Y
+  active_list = nullptr;
+  y_list_cursor = y_list;
+  // Give semaphore after changes
+  line_mutex.Release();
+  // Pointer to current line in band buffer
+  uint16_t* buf = scr_buf[band_head];
+  // Lines drawn in current band
+  uint32_t band_lines = 0U;
+  // For each line/row
+  for(int32_t i = area.y1; i <= area.y2; i++)
+  {
+    // If it is first line of band - get free buffer
+    if(band_lines == 0U)
+    {
+      uint32_t cycles = DISPLAY_PROFILE_INFO ? GetCycleCnt() : 0U;
+      // Wait until at least one buffer sent
+      WaitBands(DISPLAY_BAND_BUFFERS - 1U);
+      if(DISPLAY_PROFILE_INFO) profile.dma_wait_cycles += GetCycleCnt() - cycles;
+      // Set pointer to first line in buffer
+      buf = scr_buf[band_head];
+    }
+    uint32_t line_cycles = DISPLAY_PROFILE_INFO ? GetCycleCnt() : 0U;
+    // Take semaphore before draw line
+    line_mutex.Lock();
+    // Line compose time counted after mutex taken
+    if(DISPLAY_PROFILE_INFO)
+    {
+      uint32_t cycles = GetCycleCnt();
+      profile.mutex_wait_cycles += cycles - line_cycles;
+      line_cycles = cycles;
+    }
+    // In vertical mode objects drawn by rows, so all objects should be used
+    if(update_mode)
+    {
+      // Clear line in buffer
+      memset(buf, 0x00, w * sizeof(buf[0]));
+      // Set pointer to first element
+      VisObject* p_obj = object_list;
+      // Do for all objects
+      while(p_obj != nullptr)
+      {
+        // Draw object to buf
+        p_obj->DrawInBufH(buf, w, i, area.x1);
+        // Set pointer to next object in list
+        p_obj = p_obj->p_next;
+      }
+    }
+    else
+    {
+      // Add objects started on this line or above to the list of objects on
+      // current line
+      while((y_list_cursor != nullptr) && (GetTopY(y_list_cursor) <= i))
+      {
+        // Skip objects which ended above or outside of area
+        if((GetBottomY(y_list_cursor) >= i) && IsInAreaX(y_list_cursor, area))
+        {
+          AddToActiveList(y_list_cursor);
+        }
+        y_list_cursor = y_list_cursor->p_ynext;
+      }
+      // Find top object which covers whole line. Objects below it are
+      // invisible and shouldn't be drawn.
+      VisObject* p_opaque = nullptr;
+      for(VisObject* p_obj = active_list; p_obj != nullptr; p_obj = p_obj->p_anext)
+      {
+        if((p_obj->alpha == 255U) && p_obj->IsOpaque(i, area.x1, area.x2)) p_opaque = p_obj;
+      }
+      // Clear line in buffer only if it isn't covered
+      if(p_opaque == nullptr) memset(buf, 0x00, w * sizeof(buf[0]));
+      // Set pointer to first element
+      VisObject* p_obj = active_list;
+      VisObject* p_prev = nullptr;
+      // Draw objects only after covering object
+      bool is_draw = (p_opaque == nullptr);
+      // Do for all objects on line
+      while(p_obj != nullptr)
+      {
+        // Start drawing from covering object
+        if(p_obj == p_opaque) is_draw = true;
+        // Draw object to buf
+        if(is_draw)
+        {
+          uint32_t cycles = DISPLAY_PROFILE_INFO ? GetCycleCnt() : 0U;
+          if(p_obj->alpha == 255U) p_obj->DrawInBufW(buf, w, i, area.x1);
+          else                     DrawBlendedInBufW(p_obj, buf, w, i, area.x1);
+          if(DISPLAY_PROFILE_INFO) p_obj->draw_cycles += GetCycleCnt() - cycles;
+        }
+        // If object ends on this line - remove it from list
+        if(GetBottomY(p_obj) <= i)
+        {
+          if(p_prev != nullptr) p_prev->p_anext = p_obj->p_anext;
+          else                  active_list = p_obj->p_anext;
+          VisObject* p_next = p_obj->p_anext;
+          p_obj->p_anext = nullptr;
+          p_obj = p_next;
+        }
+        else
+        {
+          // Set pointer to next object in list
+          p_prev = p_obj;
+          p_obj = p_obj->p_anext;
+        }
+      }
+    }
+    // Save line compose time
+    if(DISPLAY_PROFILE_INFO)
+    {
+      line_cycles = GetCycleCnt() - line_cycles;
+      profile.compose_cycles += line_cycles;
+      if(line_cycles > profile.max_line_cycles) profile.max_line_cycles = line_cycles;
+      profile.lines++;
+    }
+    // Give semaphore after changes
+    line_mutex.Release();
+    // Next line in band
+    buf += w;
+    band_lines++;
+    // If band is full or it is last line of area - send band to the display
+    if((band_lines == DISPLAY_BAND_LINES) || (i == area.y2))
+    {
+      SendBand(band_lines * w * tft->GetBytesPerPixel());
+      band_lines = 0U;
+    }
+  }
+  // Take semaphore before change lists
+  line_mutex.Lock();
+  // Clear list of objects on line
+  while(active_list != nullptr)
+  {
+    VisObject* p_next = active_list->p_anext;
+    active_list->p_anext = nullptr;
+    active_list = p_next;
+  }
+  y_list_cursor = nullptr;
+  // Give semaphore after changes
+  line_mutex.Release();
+  uint32_t cycles = DISPLAY_PROFILE_INFO ? GetCycleCnt() : 0U;
+  // Wait until all bands sent
+  WaitBands(0U);
+  if(DISPLAY_PROFILE_INFO) profile.dma_wait_cycles += GetCycleCnt() - cycles;
+  // Pull up CS
+  tft->StopTransfer();
+}
+
+// *****************************************************************************
+// ***   Private: Send band to the display   ***********************************
+// *****************************************************************************
+void DisplayDrv::SendBand(uint32_t bytes)
+{
+  // Save band size for interrupt
+  band_size[band_head] = bytes;
+  // Interrupt can't change counter inside critical section
+  Rtos::EnterCriticalSection();
+  // Add band to queue
+  band_cnt++;
+  // If it is only band in queue - transfer isn't in progress and should be
+  // started here
+  if(band_cnt == 1U)
+  {
+    tft->WriteDataStream((uint8_t*)scr_buf[band_tail], band_size[band_tail]);
+  }
+  // Next buffer. Changed inside critical section, because AbortBands() uses
+  // it from interrupt.
+  band_head = (band_head + 1U) % DISPLAY_BAND_BUFFERS;
+  // Exit critical section
+  Rtos::ExitCriticalSection();
+}
+
+// *****************************************************************************
+// ***   Private: Band error callback   ****************************************
+// *****************************************************************************
+void DisplayDrv::BandErrorCallback(void* ptr)
+{
+  // Drop bands in queue and wake up display task
+  ((DisplayDrv*)ptr)->AbortBands();
+}
+
+// *****************************************************************************
+// ***   Private: Wait until bands sent   **************************************
+// *****************************************************************************
+void DisplayDrv::WaitBands(uint32_t max_cnt)
+{
+  while(band_cnt > max_cnt)
+  {
+    // Each band sent much faster than timeout, so DMA or SPI hang if band
+    // isn't sent in time
+    if(band_sent.Take(RtosTick::MsToTicks(BAND_TIMEOUT_MS)).IsBad())
+    {
+      tft->AbortTransfer();
+      Rtos::EnterCriticalSection();
+      AbortBands();
+      Rtos::ExitCriticalSection();
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Abort transfer of bands   ************************************
+// *****************************************************************************
+void DisplayDrv::AbortBands(void)
+{
+  if(band_cnt != 0U)
+  {
+    // Drop all bands in queue. Screen will be redrawn in next frame.
+    band_cnt = 0U;
+    band_tail = band_head;
+    is_band_lost = true;
+    // Wake up display task
+    band_sent.Give();
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Finish render profile of frame   *****************************
+// *****************************************************************************
+void DisplayDrv::FinishProfile(uint32_t frame_cycles)
+{
+  profile.frame_cycles = frame_cycles;
+  profile.top_obj_x = 0;
+  profile.top_obj_y = 0;
+  profile.top_obj_cycles = 0U;
+  // Take semaphore before walk thru list
+  line_mutex.Lock();
+  for(VisObject* p_obj = object_list; p_obj != nullptr; p_obj = p_obj->p_next)
+  {
+    // Find object with longest draw time
+    if(p_obj->draw_cycles > profile.top_obj_cycles)
+    {
+      // Object can be deleted after frame, so only coordinates saved
+      profile.top_obj_x = p_obj->x_start;
+      profile.top_obj_y = p_obj->y_start;
+      profile.top_obj_cycles = p_obj->draw_cycles;
+    }
+    // Save object draw time and clear it for next frame
+    p_obj->last_draw_cycles = p_obj->draw_cycles;
+    p_obj->draw_cycles = 0U;
+  }
+  // Give semaphore after changes
+  line_mutex.Release();
+  // Save profile of frame and clear it for next frame
+  Rtos::EnterCriticalSection();
+  last_profile = profile;
+  Rtos::ExitCriticalSection();
+  profile = {};
+}
+
+// *****************************************************************************
+// ***   Private: Apply objects changes before draw frame   ********************
+// *****************************************************************************
+void DisplayDrv::ApplyChanges(void)
+{
+  for(VisObject* p_obj = object_list; p_obj != nullptr; p_obj = p_obj->p_next)
+  {
+    ApplyObjectChanges(p_obj);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Apply object changes   ***************************************
+// *****************************************************************************
+void DisplayDrv::ApplyObjectChanges(VisObject* obj)
+{
+  // Check flag first to avoid enter critical section for unchanged objects
+  if(obj->changes_pending)
+  {
+    // Tasks change pending values inside critical section too, so only
+    // pending values taken inside it
+    Rtos::EnterCriticalSection();
+    obj->TakePending();
+    obj->changes_pending = false;
+    Rtos::ExitCriticalSection();
+    // Invalidation and recalculation of object done with interrupts enabled
+    obj->ApplyChanges();
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Apply hardware scroll   **************************************
+// *****************************************************************************
+void DisplayDrv::ApplyScroll(void)
+{
+  int32_t dx = scroll_dx;
+  if(dx != 0)
+  {
+    // If scroll is bigger than screen - all content is new
+    if((dx >= width) || (dx <= -width))
+    {
+      InvalidateDisplay();
+    }
+    else
+    {
+      // Areas which aren't drawn yet are moved by scroll too
+      Area areas[MAX_DIRTY_AREAS];
+      uint32_t areas_cnt = 0U;
+      Rtos::EnterCriticalSection();
+      for(; areas_cnt < dirty_areas_cnt; areas_cnt++) areas[areas_cnt] = dirty_areas[areas_cnt];
+      Rtos::ExitCriticalSection();
+      for(uint32_t i = 0U; i < areas_cnt; i++)
+      {
+        InvalidateArea(areas[i].x1 - dx, areas[i].y1, areas[i].x2 - dx, areas[i].y2);
+      }
+      // Other objects shouldn't be moved - redraw them on old and new places
+      for(VisObject* p_obj = object_list; p_obj != nullptr; p_obj = p_obj->p_next)
+      {
+        if(p_obj != scroll_obj)
+        {
+          InvalidateArea(p_obj->x_start, p_obj->y_start, p_obj->x_end, p_obj->y_end);
+          InvalidateArea(p_obj->x_start - dx, p_obj->y_start, p_obj->x_end - dx, p_obj->y_end);
+        }
+      }
+      // New columns of scrolled content
+      if(dx > 0) InvalidateArea(width - dx, 0, width - 1, height - 1);
+      else       InvalidateArea(0, 0, -dx - 1, height - 1);
+    }
+    // Set new scroll offset
+    scroll_offset = (scroll_offset + (dx % width) + width) % width;
+    tft->SetScrollOffset(scroll_offset);
+  }
+  // Clear scroll for next frame
+  scroll_dx = 0;
+  scroll_obj = nullptr;
+}
+
+// *****************************************************************************
+// ***   Private: Prepare object lists before draw frame   *********************
+// *****************************************************************************
+void DisplayDrv::PrepareLists(void)
+{
+  // Objects order in Z list
+  uint32_t rank = 0U;
+  // Update rank for all objects
+  for(VisObject* p_obj = object_list; p_obj != nullptr; p_obj = p_obj->p_next)
+  {
+    p_obj->rank = rank++;
+  }
+  // Objects moves between frames are small, so insertion sort is fast here
+  VisObject* p_obj = (y_list != nullptr) ? y_list->p_ynext : nullptr;
+  while(p_obj != nullptr)
+  {
+    // Save next object before moving current one
+    VisObject* p_next = p_obj->p_ynext;
+    // Find new position for object
+    VisObject* p_pos = p_obj->p_yprev;
+    while((p_pos != nullptr) && (GetTopY(p_pos) > GetTopY(p_obj))) p_pos = p_pos->p_yprev;
+    // Move object if position changed
+    if(p_pos != p_obj->p_yprev)
+    {
+      // Remove object from list. It can't be first object in the list since
+      // previous object has greater Y.
+      p_obj->p_yprev->p_ynext = p_obj->p_ynext;
+      if(p_obj->p_ynext != nullptr) p_obj->p_ynext->p_yprev = p_obj->p_yprev;
+      // Insert object after found position
+      p_obj->p_yprev = p_pos;
+      if(p_pos != nullptr)
+      {
+        p_obj->p_ynext = p_pos->p_ynext;
+        p_pos->p_ynext = p_obj;
+      }
+      else
+      {
+        p_obj->p_ynext = y_list;
+        y_list = p_obj;
+      }
+      p_obj->p_ynext->p_yprev = p_obj;
+    }
+    // Next object
+    p_obj = p_next;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Add object to list of objects on current line   **************
+// *****************************************************************************
+void DisplayDrv::AddToActiveList(VisObject* obj)
+{
+  // Find position in the list: list sorted by Z, objects with the same Z
+  // sorted by rank
+  VisObject* p_obj = active_list;
+  VisObject* p_prev = nullptr;
+  while(   (p_obj != nullptr)
+        && (   (p_obj->z < obj->z)
+            || ((p_obj->z == obj->z) && (p_obj->rank <= obj->rank)) ) )
+  {
+    p_prev = p_obj;
+    p_obj = p_obj->p_anext;
+  }
+  // Insert object
+  obj->p_anext = p_obj;
+  if(p_prev != nullptr) p_prev->p_anext = obj;
+  else                  active_list = obj;
+}
+
+// *****************************************************************************
+// ***   Private: Delete object from list of objects on current line   *********
+// *****************************************************************************
+void DisplayDrv::DelFromActiveList(VisObject* obj)
+{
+  VisObject* p_obj = active_list;
+  VisObject* p_prev = nullptr;
+  // Find object in the list
+  while((p_obj != nullptr) && (p_obj != obj))
+  {
+    p_prev = p_obj;
+    p_obj = p_obj->p_anext;
+  }
+  // Remove object if found
+  if(p_obj != nullptr)
+  {
+    if(p_prev != nullptr) p_prev->p_anext = obj->p_anext;
+    else                  active_list = obj->p_anext;
+    obj->p_anext = nullptr;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Draw object blended with line by object alpha   **************
+// *****************************************************************************
+void DisplayDrv::DrawBlendedInBufW(VisObject* obj, uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Find part of line covered by object
+  int32_t start = ((obj->x_start < obj->x_end) ? obj->x_start : obj->x_end) - start_x;
+  int32_t end   = ((obj->x_start < obj->x_end) ? obj->x_end : obj->x_start) - start_x;
+  if(start < 0) start = 0;
+  if(end >= n) end = n - 1;
+  // Invisible object isn't drawn at all
+  if((obj->alpha != 0U) && (start <= end))
+  {
+    // Object can have transparent pixels, so it drawn over copy of line
+    memcpy(&alpha_buf[start], &buf[start], (end - start + 1) * sizeof(buf[0]));
+    obj->DrawInBufW(alpha_buf, n, line, start_x);
+    // Scale alpha from 0..255 to 0..ALPHA_MAX
+    Blitter::BlendLine(&buf[start], &alpha_buf[start], end - start + 1, (obj->alpha + 4U) >> 3U);
+  }
+}
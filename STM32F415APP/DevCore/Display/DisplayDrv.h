@@ -56,7 +56,13 @@
 #include "Primitives.h"
 #include "Strings.h"
 #include "Image.h"
+#include "AffineImage.h"
 #include "TiledMap.h"
+#include "ParallaxMap.h"
+#include "StreamImage.h"
+#include "SpriteBatch.h"
+#include "Polygon.h"
+#include "PropString.h"
 
 // *****************************************************************************
 // ***   Display Driver Class   ************************************************
@@ -89,6 +95,13 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     Result DelVisObjectFromList(VisObject* obj);
 
+    // *************************************************************************
+    // ***   Check if Visual Object in object list   ***************************
+    // *************************************************************************
+    // * Object is in the list if it has neighbours or it is the only object in
+    // * the list.
+    bool IsVisObjectInList(VisObject* obj);
+
     // *************************************************************************
     // ***   Lock display   ****************************************************
     // *************************************************************************
@@ -112,8 +125,135 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     // ***   Update display   **************************************************
     // *************************************************************************
+    // * Request drawing of next frame. All requests made before frame drawing
+    // * starts are coalesced into one frame.
     Result UpdateDisplay(void);
 
+    // *************************************************************************
+    // ***   Wait for frame done   *********************************************
+    // *************************************************************************
+    // * Block caller until frame which starts after this call is sent to the
+    // * display. Call after UpdateDisplay() allows run game loop in lockstep
+    // * with display driver. Up to MAX_FRAME_WAITERS tasks can wait at the
+    // * same time.
+    Result WaitForFrameDone(uint32_t wait_ms = portMAX_DELAY);
+
+    // *************************************************************************
+    // ***   Set target FPS   **************************************************
+    // *************************************************************************
+    // * Limit frame rate. Update requests made faster will be coalesced.
+    // * Zero value - no limit.
+    void SetTargetFps(uint32_t fps);
+
+    // *************************************************************************
+    // ***   Set frame done callback   *****************************************
+    // *************************************************************************
+    // * Set function which will be called by display task after each frame
+    // * drawn, for example to collect statistic of frame. Callback called
+    // * before tasks waiting for frame done are woken up.
+    void SetFrameDoneCallback(void (*clbk)(void* ptr), void* clbk_ptr);
+
+    // *************************************************************************
+    // ***   Get count of frames drawn   ***************************************
+    // *************************************************************************
+    inline uint32_t GetFrameCnt(void) {return frame_cnt;}
+
+    // *************************************************************************
+    // ***   Get count of coalesced update requests   **************************
+    // *************************************************************************
+    inline uint32_t GetCoalescedUpdatesCnt(void) {return coalesced_updates_cnt;}
+
+    // *************************************************************************
+    // ***   Get frame time histogram   ****************************************
+    // *************************************************************************
+    // * Copy up to n bins of frame drawing time histogram to hist. Each bin is
+    // * FRAME_HIST_BIN_MS wide, last bin counts all longer frames.
+    void GetFrameTimeHistogram(uint32_t* hist, uint32_t n);
+
+    // *************************************************************************
+    // ***   Reset frame statistics   ******************************************
+    // *************************************************************************
+    void ResetFrameStats(void);
+
+    // *************************************************************************
+    // ***   Render profile structure   ****************************************
+    // *************************************************************************
+    // * All times in CPU cycles. Filled only if DISPLAY_PROFILE_INFO is set.
+    struct Profile
+    {
+      uint32_t frame_cycles;      // Whole frame
+      uint32_t compose_cycles;    // Compose of all lines
+      uint32_t max_line_cycles;   // Compose of longest line
+      uint32_t lines;             // Count of composed lines
+      uint32_t dma_wait_cycles;   // Waiting for free band buffer and DMA end
+      uint32_t mutex_wait_cycles; // Waiting for line mutex
+      int16_t top_obj_x;          // Start coordinates of object with longest
+      int16_t top_obj_y;          // draw time
+      uint32_t top_obj_cycles;    // Draw time of this object
+    };
+
+    // *************************************************************************
+    // ***   Get render profile of last frame   ********************************
+    // *************************************************************************
+    void GetProfile(Profile& prof);
+
+    // *************************************************************************
+    // ***   Invalidate area   *************************************************
+    // *************************************************************************
+    // * Mark screen area as changed. Only changed areas will be redrawn and
+    // * sent to the display on next update. Coordinates can be in any order
+    // * and will be clipped to the screen.
+    void InvalidateArea(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+
+    // *************************************************************************
+    // ***   Invalidate Visual Object area   ***********************************
+    // *************************************************************************
+    // * Mark area of object as changed. Do nothing if object isn't in the list.
+    void InvalidateVisObject(VisObject* obj);
+
+    // *************************************************************************
+    // ***   Invalidate display   **********************************************
+    // *************************************************************************
+    void InvalidateDisplay(void);
+
+    // *************************************************************************
+    // ***   Scroll screen   ***************************************************
+    // *************************************************************************
+    // * Scroll whole screen content left by dx pixels by display hardware.
+    // * Object obj is scrolled content and must cover whole screen width(for
+    // * example TiledMap) - only new columns of it will be drawn. All other
+    // * objects will be redrawn. Can be called only from ApplyChanges() of
+    // * object. Returns false if hardware scroll can't be used, in this case
+    // * object should invalidate itself.
+    bool ScrollScreen(VisObject* obj, int32_t dx);
+
+    // *************************************************************************
+    // ***   Get count of pixels sent to display during last frame   ***********
+    // *************************************************************************
+    inline uint32_t GetPixelsPerFrame(void) {return pixels_per_frame;}
+
+    // *************************************************************************
+    // ***   SPI transfer complete callback   **********************************
+    // *************************************************************************
+    // * Called from interrupt when DMA transfer finished. Starts transfer of
+    // * next band if it is ready.
+    void TransferCompleteCallback(SPI_HandleTypeDef* hspi);
+
+    // *************************************************************************
+    // ***   SPI transfer error callback   *************************************
+    // *************************************************************************
+    // * Called from interrupt when SPI or DMA error occurred. Drops bands in
+    // * queue, so display task doesn't wait for them forever.
+    void TransferErrorCallback(SPI_HandleTypeDef* hspi);
+
+    // *************************************************************************
+    // ***   Set display back-end   ********************************************
+    // *************************************************************************
+    // * Replace ILI9341 by other display(for example HostDisplay in host
+    // * build). Must be called before Setup(). Display can't be bigger than
+    // * ILI9341.
+    void SetDisplay(IDisplay& disp);
+
     // *************************************************************************
     // ***   Set Update Mode   *************************************************
     // *************************************************************************
@@ -144,12 +284,35 @@ class DisplayDrv : public AppTask
     // *************************************************************************
     void TouchCalibrate();
 
+    // Count of bins in frame time histogram
+    static const uint32_t FRAME_HIST_BINS = 16U;
+    // Width of frame time histogram bin in ms
+    static const uint32_t FRAME_HIST_BIN_MS = 4U;
+
   private:
     // Display FPS/touch coordinates
     static const bool DISPLAY_DEBUG_INFO = true;
-    
+    // Collect render profile and display it
+    static const bool DISPLAY_PROFILE_INFO = false;
+    // Max count of changed areas. If more areas changed, two closest areas
+    // will be merged.
+    static const uint32_t MAX_DIRTY_AREAS = 8U;
+    // Timeout of band transfer
+    static const uint32_t BAND_TIMEOUT_MS = 100U;
+    // Max count of tasks waiting for frame done at the same time
+    static const uint32_t MAX_FRAME_WAITERS = 4U;
+
+    // Task waiting for frame done
+    typedef struct
+    {
+      TaskHandle_t task;
+      uint32_t frame;
+    } FrameWaiter;
+
     // Display driver object
-    ILI9341 tft = TFT_HSPI;
+    ILI9341 ili9341 {TFT_HSPI};
+    // Display used for output
+    IDisplay* tft = &ili9341;
     // Display SPI handle
     SPI_HandleTypeDef* tft_hspi = TFT_HSPI;
 
@@ -162,29 +325,102 @@ class DisplayDrv : public AppTask
     VisObject* object_list = nullptr;
     // Pointer to last object in list
     VisObject* object_list_last = nullptr;
+    // Pointer to first object in list sorted by Y
+    VisObject* y_list = nullptr;
+    // Pointer to next object in list sorted by Y which should be checked
+    // during drawing area
+    VisObject* y_list_cursor = nullptr;
+    // Pointer to first object in list of objects on current line. This list
+    // sorted by Z.
+    VisObject* active_list = nullptr;
 
     // Update mode: true - vertical, false = horizontal
     bool update_mode = false;
+    // Object scrolled by display hardware in current frame
+    VisObject* scroll_obj = nullptr;
+    // Hardware scroll requested in current frame
+    int32_t scroll_dx = 0;
+    // Current hardware scroll offset. Screen X coordinate x is stored in
+    // display memory at (x + scroll_offset) % width.
+    int32_t scroll_offset = 0;
     // Variables for update screen mode
     int32_t width = 0;
     int32_t height = 0;
-    // Double Screen Line buffer
-    uint16_t scr_buf[2][ILI9341::GetMaxLine()];
+    // Ring of band buffers
+    uint16_t scr_buf[DISPLAY_BAND_BUFFERS][DISPLAY_BAND_LINES * ILI9341::GetMaxLine()];
+    // Buffer for draw semi-transparent object before blend it with line
+    uint16_t alpha_buf[ILI9341::GetMaxLine()];
+    // Size in bytes of each band ready to send
+    uint32_t band_size[DISPLAY_BAND_BUFFERS];
+    // Index of buffer for draw next band
+    uint32_t band_head = 0U;
+    // Index of buffer which sending to the display
+    volatile uint32_t band_tail = 0U;
+    // Count of bands ready to send, including band which sending now
+    volatile uint32_t band_cnt = 0U;
+    // Bands dropped because of transfer error
+    volatile bool is_band_lost = false;
+
+    // Screen area structure
+    struct Area
+    {
+      int16_t x1;
+      int16_t y1;
+      int16_t x2;
+      int16_t y2;
+    };
+    // Changed areas for next frame
+    Area dirty_areas[MAX_DIRTY_AREAS];
+    // Count of changed areas
+    uint32_t dirty_areas_cnt = 0U;
+    // Pixels sent to display during last frame
+    volatile uint32_t pixels_per_frame = 0U;
 
     // Touch coordinates and state
     bool is_touch = false;
     int32_t tx = 0;
     int32_t ty = 0;
 
+    // Count of frames drawn
+    volatile uint32_t frame_cnt = 0U;
+    // Frame drawing in progress
+    volatile bool frame_in_progress = false;
+    // Minimum frame time in ms, 0 - no limit
+    uint32_t frame_period_ms = 0U;
+    // Count of update requests coalesced with previous requests
+    volatile uint32_t coalesced_updates_cnt = 0U;
+    // Histogram of frames drawing time
+    uint32_t frame_time_hist[FRAME_HIST_BINS] = {0U};
+
     // FPS multiplied to 10
     volatile uint32_t fps_x10 = 0U;
     // Buffer for print FPS string
-    char str[32] = {"       "};
+    char str[48] = {"       "};
     // FPS string
     String fps_str;
 
+    // Render profile of current frame
+    Profile profile = {};
+    // Render profile of last frame
+    Profile last_profile = {};
+    // Buffer for print profile string
+    char prof_str_buf[64] = {""};
+    // Profile string
+    String prof_str;
+    // Buffer for print asset cache statistic string
+    char asset_str_buf[48] = {""};
+    // Asset cache statistic string
+    String asset_str;
+
     // Semaphore for update screen
     RtosSemaphore screen_update;
+    // Tasks waiting for frame done, notified by display task
+    FrameWaiter frame_waiters[MAX_FRAME_WAITERS] = {};
+    // Function called after frame drawn and its parameter
+    void (*frame_done_callback)(void* ptr) = nullptr;
+    void* frame_done_callback_ptr = nullptr;
+    // Semaphore for signal from DMA transfer complete interrupt
+    RtosSemaphore band_sent;
     // Mutex to synchronize when drawing lines
     RtosMutex line_mutex;
     // Mutex to synchronize when drawing frames
@@ -192,6 +428,148 @@ class DisplayDrv : public AppTask
     // Mutex for synchronize when reads touch coordinates
     RtosMutex touchscreen_mutex;
 
+    // *************************************************************************
+    // ***   Draw area   *******************************************************
+    // *************************************************************************
+    // * Split area if it crosses end of display memory after hardware scroll.
+    void DrawArea(const Area& area);
+
+    // *************************************************************************
+    // ***   Draw area lines   *************************************************
+    // *************************************************************************
+    void DrawAreaLines(const Area& area);
+
+    // *************************************************************************
+    // ***   Check if area doesn't contain any objects   ***********************
+    // *************************************************************************
+    bool IsAreaEmpty(const Area& area);
+
+    // *************************************************************************
+    // ***   Finish render profile of frame   **********************************
+    // *************************************************************************
+    // * Find object with longest draw time and save profile of frame.
+    void FinishProfile(uint32_t frame_cycles);
+
+    // *************************************************************************
+    // ***   Get CPU cycles counter   ******************************************
+    // *************************************************************************
+    static inline uint32_t GetCycleCnt(void) {return DWT->CYCCNT;}
+
+    // *************************************************************************
+    // ***   Send band to the display   ****************************************
+    // *************************************************************************
+    // * Band will be sent immediately if no other transfer in progress.
+    // * Otherwise it will be sent from the transfer complete interrupt.
+    void SendBand(uint32_t bytes);
+
+    // *************************************************************************
+    // ***   Band sent callback   **********************************************
+    // *************************************************************************
+    // * Called by display from interrupt when band transfer complete. Starts
+    // * transfer of next band if it is ready. Parameter is pointer to driver.
+    static void BandSentCallback(void* ptr);
+
+    // *************************************************************************
+    // ***   Band error callback   *********************************************
+    // *************************************************************************
+    // * Called by display from interrupt when band transfer failed. Parameter
+    // * is pointer to driver.
+    static void BandErrorCallback(void* ptr);
+
+    // *************************************************************************
+    // ***   Wait until bands sent   *******************************************
+    // *************************************************************************
+    // * Wait until no more than max_cnt bands in queue. Bands dropped if
+    // * transfer doesn't complete within BAND_TIMEOUT_MS.
+    void WaitBands(uint32_t max_cnt);
+
+    // *************************************************************************
+    // ***   Abort transfer of bands   *****************************************
+    // *************************************************************************
+    // * Must be called from interrupt or inside critical section.
+    void AbortBands(void);
+
+    // *************************************************************************
+    // ***   Apply objects changes before draw frame   *************************
+    // *************************************************************************
+    // * Objects changes made by tasks(Move(), SetString(), etc.) saved in
+    // * objects and applied here, so objects never changed during frame
+    // * drawing and tasks never wait for line mutex. Line mutex must be taken
+    // * before call this function.
+    void ApplyChanges(void);
+
+    // *************************************************************************
+    // ***   Apply object changes   ********************************************
+    // *************************************************************************
+    void ApplyObjectChanges(VisObject* obj);
+
+    // *************************************************************************
+    // ***   Apply hardware scroll   *******************************************
+    // *************************************************************************
+    // * Set new scroll offset and invalidate areas which content moved by
+    // * scroll but shouldn't be moved. Must be called after ApplyChanges().
+    void ApplyScroll(void);
+
+    // *************************************************************************
+    // ***   Prepare object lists before draw frame   **************************
+    // *************************************************************************
+    // * Sort list by Y after objects movement and update objects rank. Line
+    // * mutex must be taken before call this function.
+    void PrepareLists(void);
+
+    // *************************************************************************
+    // ***   Add object to list of objects on current line   *******************
+    // *************************************************************************
+    void AddToActiveList(VisObject* obj);
+
+    // *************************************************************************
+    // ***   Delete object from list of objects on current line   **************
+    // *************************************************************************
+    void DelFromActiveList(VisObject* obj);
+
+    // *************************************************************************
+    // ***   Get object top/bottom Y coordinates   *****************************
+    // *************************************************************************
+    // * Objects like Line can have start coordinates greater than end.
+    static inline int32_t GetTopY(VisObject* obj) {return (obj->y_start < obj->y_end) ? obj->y_start : obj->y_end;}
+    static inline int32_t GetBottomY(VisObject* obj) {return (obj->y_start < obj->y_end) ? obj->y_end : obj->y_start;}
+
+    // *************************************************************************
+    // ***   Check if object crosses area horizontally   ***********************
+    // *************************************************************************
+    static inline bool IsInAreaX(VisObject* obj, const Area& a)
+    {
+      return ((obj->x_start >= a.x1) || (obj->x_end >= a.x1)) && ((obj->x_start <= a.x2) || (obj->x_end <= a.x2));
+    }
+
+    // *************************************************************************
+    // ***   Draw object blended with line by object alpha   *******************
+    // *************************************************************************
+    void DrawBlendedInBufW(VisObject* obj, uint16_t* buf, int32_t n, int32_t line, int32_t start_x);
+
+    // *************************************************************************
+    // ***   Get area size in pixels   *****************************************
+    // *************************************************************************
+    static inline uint32_t GetAreaSize(const Area& a) {return (a.x2 - a.x1 + 1) * (a.y2 - a.y1 + 1);}
+
+    // *************************************************************************
+    // ***   Check if areas overlaps or touches each other   *******************
+    // *************************************************************************
+    static inline bool IsAreasAdjacent(const Area& a, const Area& b)
+    {
+      return (a.x1 <= b.x2 + 1) && (b.x1 <= a.x2 + 1) && (a.y1 <= b.y2 + 1) && (b.y1 <= a.y2 + 1);
+    }
+
+    // *************************************************************************
+    // ***   Merge two areas   *************************************************
+    // *************************************************************************
+    static inline Area MergeAreas(const Area& a, const Area& b)
+    {
+      Area r = {(a.x1 < b.x1) ? a.x1 : b.x1, (a.y1 < b.y1) ? a.y1 : b.y1,
+                (a.x2 > b.x2) ? a.x2 : b.x2, (a.y2 > b.y2) ? a.y2 : b.y2};
+      return r;
+    }
+
     // *************************************************************************
     // ** Private constructor. Only GetInstance() allow to access this class. **
     // *************************************************************************
@@ -41,7 +41,7 @@
 extern const unsigned char font4x6[256][6];
 extern const unsigned char font6x8[256][8];
 extern const unsigned char font8x8[256][8];
-extern const unsigned char font8x12[256][16];
-extern const unsigned char font12x16[256][24];
+extern const unsigned char font8x12[256][12];
+extern const unsigned char font12x16[256][32];
 
 #endif
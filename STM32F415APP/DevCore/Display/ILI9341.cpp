@@ -166,6 +166,120 @@ void ILI9341::WriteDataStream(uint8_t* data, uint32_t n)
   HAL_SPI_Transmit_DMA(hspi, data, n);
 }
 
+// *****************************************************************************
+// ***   SPI transfer complete callback   **************************************
+// *****************************************************************************
+void ILI9341::TransferCompleteCallback(SPI_HandleTypeDef* in_hspi)
+{
+  // Check if transfer was for this display
+  if(in_hspi == hspi)
+  {
+    if(is_fill)
+    {
+      // Start next part of solid fill or wake up task if fill complete
+      if(fill_left != 0U)
+      {
+        uint32_t cnt = (fill_left > 0xFFFFU) ? 0xFFFFU : fill_left;
+        fill_left -= cnt;
+        HAL_SPI_Transmit_DMA(hspi, (uint8_t*)&fill_color, cnt);
+      }
+      else
+      {
+        fill_done.Give();
+      }
+    }
+    else if(callback != nullptr)
+    {
+      callback(callback_ptr);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   SPI transfer error callback   *****************************************
+// *****************************************************************************
+void ILI9341::TransferErrorCallback(SPI_HandleTypeDef* in_hspi)
+{
+  // Check if transfer was for this display
+  if(in_hspi == hspi)
+  {
+    // Stop solid fill and wake up task
+    if(is_fill)
+    {
+      fill_left = 0U;
+      fill_done.Give();
+    }
+    else if(error_callback != nullptr)
+    {
+      error_callback(error_callback_ptr);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Write commands list to SPI   ******************************************
+// *****************************************************************************
+void ILI9341::WriteCommandList(const uint8_t* list)
+{
+  // Pull down CS - all commands sent in one transfer
+  HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET);
+  // Send commands until end of list
+  while(*list != CMD_NOP)
+  {
+    // Send command
+    SendCommand(list[0]);
+    // Send data if command has it
+    if(list[1] != 0U) SendData(&list[2], list[1]);
+    // Next command
+    list += 2U + list[1];
+  }
+  // Pull up CS
+  HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET);
+}
+
+// *****************************************************************************
+// ***   Send command, CS must be pulled down   ********************************
+// *****************************************************************************
+inline void ILI9341::SendCommand(uint8_t c)
+{
+  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_RESET); // Command
+  HAL_SPI_Transmit(hspi, &c, sizeof(c), SPI_TIMEOUT_MS);
+}
+
+// *****************************************************************************
+// ***   Send data, CS must be pulled down   ***********************************
+// *****************************************************************************
+inline void ILI9341::SendData(const uint8_t* data, uint32_t n)
+{
+  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
+  HAL_SPI_Transmit(hspi, (uint8_t*)data, n, SPI_TIMEOUT_MS);
+}
+
+// *****************************************************************************
+// ***   Switch SPI and DMA to solid fill mode   *******************************
+// *****************************************************************************
+void ILI9341::SetFillMode(bool is_fill)
+{
+  // SPI must be disabled before change data frame format
+  __HAL_SPI_DISABLE(hspi);
+  if(is_fill)
+  {
+    // 16-bit SPI frames, DMA sends same half-word from memory
+    hspi->Init.DataSize = SPI_DATASIZE_16BIT;
+    SET_BIT(hspi->Instance->CR1, SPI_CR1_DFF);
+    MODIFY_REG(hspi->hdmatx->Instance->CR, DMA_SxCR_MINC | DMA_SxCR_PSIZE | DMA_SxCR_MSIZE,
+               DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0);
+  }
+  else
+  {
+    // Restore 8-bit SPI frames and DMA memory increment
+    hspi->Init.DataSize = SPI_DATASIZE_8BIT;
+    CLEAR_BIT(hspi->Instance->CR1, SPI_CR1_DFF);
+    MODIFY_REG(hspi->hdmatx->Instance->CR, DMA_SxCR_MINC | DMA_SxCR_PSIZE | DMA_SxCR_MSIZE,
+               DMA_SxCR_MINC);
+  }
+}
+
 // *****************************************************************************
 // ***   Check SPI transfer status   *******************************************
 // *****************************************************************************
@@ -185,144 +299,81 @@ void ILI9341::StopTransfer(void)
 }
 
 // *****************************************************************************
-// ***   Init screen   *********************************************************
+// ***   Abort DMA transfer   **************************************************
 // *****************************************************************************
-void ILI9341::Init(void)
+void ILI9341::AbortTransfer(void)
 {
-//  // Reset sequence. Used only if GPIO pin used as LCD reset.
-//  HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_SET);  
-//  HAL_Delay(5);
-//  HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_RESET);  
-//  HAL_Delay(20);
-//  HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_SET);  
-//  HAL_Delay(150);
-
-  // Exit Sleep
-  WriteCommand(CMD_SWRESET);
-  // Delay for execute previous command
-  HAL_Delay(100U);
+  HAL_SPI_DMAStop(hspi);
+}
 
+// *****************************************************************************
+// ***   Init commands list   **************************************************
+// *****************************************************************************
+// * Format: command, count of data bytes, data bytes. CMD_NOP ends the list.
+static const uint8_t init_cmd_list[] =
+{
   // Power control
-  WriteCommand(CMD_PWCTR1);
-  WriteData(0x23); // VRH[5:0] // 25
-
+  CMD_PWCTR1, 1, 0x23,
   // Power control
-  WriteCommand(CMD_PWCTR2);
-  WriteData(0x10); // SAP[2:0]; BT[3:0] // 11
-
+  CMD_PWCTR2, 1, 0x10,
   // VCM control 1
-  WriteCommand(CMD_VMCTR1);
-  WriteData(0x2B);
-  WriteData(0x2B);
-
-  // VCM control 2 
-  WriteCommand(CMD_VMCTR2);
-  WriteData(0xC0);
-
+  CMD_VMCTR1, 2, 0x2B, 0x2B,
+  // VCM control 2
+  CMD_VMCTR2, 1, 0xC0,
   // Pixel Format Set
-  WriteCommand(CMD_PIXFMT);
-  WriteData(0x55);
-
+  CMD_PIXFMT, 1, 0x55,
   // Frame Control (In Normal Mode)
-  WriteCommand(CMD_FRMCTR1);
-  WriteData(0x00);
-  WriteData(0x18);
-
+  CMD_FRMCTR1, 2, 0x00, 0x18,
   // Power control A
-  WriteCommand(CMD_PWCTRA);
-  WriteData(0x39);
-  WriteData(0x2C);
-  WriteData(0x00);
-  WriteData(0x34);
-  WriteData(0x02);
-
+  CMD_PWCTRA, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
   // Power control B
-  WriteCommand(CMD_PWCTRB);
-  WriteData(0x00);
-  WriteData(0XC1);
-  WriteData(0X30);
-
+  CMD_PWCTRB, 3, 0x00, 0XC1, 0X30,
   // Power on sequence control
-  WriteCommand(CMD_PWONSC);
-  WriteData(0x64);
-  WriteData(0x03);
-  WriteData(0X12);
-  WriteData(0X81);
-
+  CMD_PWONSC, 4, 0x64, 0x03, 0X12, 0X81,
   // Driver timing control A
-  WriteCommand(CMD_DRVTMCA);
-  WriteData(0x85);
-  WriteData(0x00);
-  WriteData(0x78);
-
+  CMD_DRVTMCA, 3, 0x85, 0x00, 0x78,
   // Driver timing control B
-  WriteCommand(CMD_DRVTMCB);
-  WriteData(0x00);
-  WriteData(0x00);
-
+  CMD_DRVTMCB, 2, 0x00, 0x00,
   // Pump ratio control
-  WriteCommand(CMD_PUMPRC);
-  WriteData(0x20);
-
+  CMD_PUMPRC, 1, 0x20,
   // Memory Access Control
-  WriteCommand(CMD_MADCTL);
-  WriteData(0x48);
-
-  // Display Function Control 
-  WriteCommand(CMD_DFUNCTR);
-  WriteData(0x08);
-  WriteData(0x82);
-  WriteData(0x27);
-
-  // Enable 3 gamma control - Disable 3 Gamma Function 
-  WriteCommand(CMD_EN3G);
-  WriteData(0x00);
-
+  CMD_MADCTL, 1, 0x48,
+  // Display Function Control
+  CMD_DFUNCTR, 3, 0x08, 0x82, 0x27,
+  // Enable 3 gamma control - Disable 3 Gamma Function
+  CMD_EN3G, 1, 0x00,
   // Gamma Set - Gamma curve selected
-  WriteCommand(CMD_GAMMASET);
-  WriteData(0x01);
-
+  CMD_GAMMASET, 1, 0x01,
   // Positive Gamma Correction
-  WriteCommand(CMD_GMCTRP1);
-  WriteData(0x0F);
-  WriteData(0x31);
-  WriteData(0x2B);
-  WriteData(0x0C);
-  WriteData(0x0E);
-  WriteData(0x08);
-  WriteData(0x4E);
-  WriteData(0xF1);
-  WriteData(0x37);
-  WriteData(0x07);
-  WriteData(0x10);
-  WriteData(0x03);
-  WriteData(0x0E);
-  WriteData(0x09);
-  WriteData(0x00);
-
+  CMD_GMCTRP1, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
   // Negative Gamma Correction
-  WriteCommand(CMD_GMCTRN1);
-  WriteData(0x00);
-  WriteData(0x0E);
-  WriteData(0x14);
-  WriteData(0x03);
-  WriteData(0x11);
-  WriteData(0x07);
-  WriteData(0x31);
-  WriteData(0xC1);
-  WriteData(0x48);
-  WriteData(0x08);
-  WriteData(0x0F);
-  WriteData(0x0C);
-  WriteData(0x31);
-  WriteData(0x36);
-  WriteData(0x0F);
-
+  CMD_GMCTRN1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
   // Interface Control
-  WriteCommand(CMD_INTCTRL);
-  WriteData(0x01);
-  WriteData(0x00);
-  WriteData(0x01 << 5);
+  CMD_INTCTRL, 3, 0x01, 0x00, 0x01 << 5,
+  // End of list
+  CMD_NOP
+};
+
+// *****************************************************************************
+// ***   Init screen   *********************************************************
+// *****************************************************************************
+Result ILI9341::Init(void)
+{
+//  // Reset sequence. Used only if GPIO pin used as LCD reset.
+//  HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_SET);  
+//  HAL_Delay(5);
+//  HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_RESET);  
+//  HAL_Delay(20);
+//  HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_SET);  
+//  HAL_Delay(150);
+
+  // Exit Sleep
+  WriteCommand(CMD_SWRESET);
+  // Delay for execute previous command
+  HAL_Delay(100U);
+
+  // Send init commands in one transfer
+  WriteCommandList(init_cmd_list);
 
   // Exit Sleep
   WriteCommand(CMD_SLPOUT);
@@ -330,6 +381,9 @@ void ILI9341::Init(void)
   HAL_Delay(120U);
   // Display on
   WriteCommand(CMD_DISPON);
+
+  // Always Ok
+  return Result::RESULT_OK;
 }
 
 // *****************************************************************************
@@ -337,20 +391,20 @@ void ILI9341::Init(void)
 // *****************************************************************************
 void ILI9341::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  WriteCommand(CMD_CASET); // Column address set
-  WriteData(x0 >> 8);
-  WriteData(x0 & 0xFF); // XSTART 
-  WriteData(x1 >> 8);
-  WriteData(x1 & 0xFF); // XEND
-
-  WriteCommand(CMD_PASET); // Row address set
-  WriteData(y0 >> 8);
-  WriteData(y0);        // YSTART
-  WriteData(y1 >> 8);
-  WriteData(y1);        // YEND
-
-  WriteCommand(CMD_RAMWR); // write to RAM
-  
+  uint8_t caset[] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t paset[] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
+
+  // Pull down CS - all commands sent in one transfer
+  HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET);
+  // Column address set
+  SendCommand(CMD_CASET);
+  SendData(caset, sizeof(caset));
+  // Row address set
+  SendCommand(CMD_PASET);
+  SendData(paset, sizeof(paset));
+  // Write to RAM
+  SendCommand(CMD_RAMWR);
+
   // Prepare for write data
   HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
 }
@@ -406,10 +460,11 @@ void ILI9341::SetRotation(uint8_t m)
 // *****************************************************************************
 void ILI9341::PushColor(uint16_t color)
 {
-  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
+  uint8_t data[] = {(uint8_t)(color >> 8), (uint8_t)color};
 
-  SpiWrite(color >> 8);
-  SpiWrite(color);
+  HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET); // Pull down CS
+  SendData(data, sizeof(data));
+  HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET); // Pull up CS
 }
 
 // *****************************************************************************
@@ -419,12 +474,9 @@ void ILI9341::DrawPixel(int16_t x, int16_t y, uint16_t color)
 {
   if((x < 0) ||(x >= width) || (y < 0) || (y >= height)) return;
 
-  SetAddrWindow(x,y,x+1,y+1);
-
-  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
+  SetAddrWindow(x, y, x, y);
 
-  SpiWrite(color >> 8);
-  SpiWrite(color);
+  PushColor(color);
 }
 
 // *****************************************************************************
@@ -432,22 +484,7 @@ void ILI9341::DrawPixel(int16_t x, int16_t y, uint16_t color)
 // *****************************************************************************
 void ILI9341::DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
-  // Rudimentary clipping
-  if((x >= width) || (y >= height)) return;
-
-  if((y+h-1) >= height) h = height-y;
-
-  SetAddrWindow(x, y, x, y+h-1);
-
-  uint8_t hi = color >> 8, lo = color;
-
-  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
-
-  while (h--)
-  {
-    SpiWrite(hi);
-    SpiWrite(lo);
-  }
+  FillRect(x, y, 1, h, color);
 }
 
 // *****************************************************************************
@@ -455,20 +492,7 @@ void ILI9341::DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 // *****************************************************************************
 void ILI9341::DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
-  if((x >= width) || (y >= height)) return;
-  if((x+w-1) >= width)  w = width-x;
-
-  SetAddrWindow(x, y, x+w-1, y);
-
-  uint8_t hi = color >> 8, lo = color;
-
-  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
-
-  while (w--)
-  {
-    SpiWrite(hi);
-    SpiWrite(lo);
-  }
+  FillRect(x, y, w, 1, color);
 }
 
 // *****************************************************************************
@@ -490,25 +514,51 @@ void ILI9341::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colo
 
   SetAddrWindow(x, y, x+w-1, y+h-1);
 
-  uint8_t hi = color >> 8, lo = color;
+  // DMA reads color during transfer, so it can't be on the stack
+  fill_color = color;
+  // Pixels count
+  uint32_t n = w * h;
 
-  HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET); // Data
+  // Nothing to fill
+  if(n == 0U) return;
 
   HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET); // Pull down CS
-  for(y=h; y>0; y--)
+  SetFillMode(true);
+  // DMA can send only 65535 items at once. Transfer complete callback starts
+  // next parts and gives semaphore when all pixels sent.
+  uint32_t cnt = (n > 0xFFFFU) ? 0xFFFFU : n;
+  fill_left = n - cnt;
+  is_fill = true;
+  HAL_SPI_Transmit_DMA(hspi, (uint8_t*)&fill_color, cnt);
+  // Wait until fill complete. Stop DMA if it hang.
+  if(fill_done.Take(RtosTick::MsToTicks(FILL_TIMEOUT_MS)).IsBad())
   {
-    for(x=w; x>0; x--)
-    {
-       // Wait until TXE flag is set to send data
-       while(__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXE) == RESET);
-       hspi->Instance->DR = hi;
-       while(__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXE) == RESET);
-       hspi->Instance->DR = lo;
-    }
+    HAL_SPI_DMAStop(hspi);
   }
+  is_fill = false;
+  SetFillMode(false);
   HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET); // Pull up CS
 }
 
+// *****************************************************************************
+// ***   Set hardware scroll offset   ******************************************
+// *****************************************************************************
+void ILI9341::SetScrollOffset(uint16_t offset)
+{
+  // Hardware scroll moves display rows. Row order reversed for rotation 2
+  // and 3, so scroll direction reversed too.
+  uint16_t vsp = offset % TFT_WIDTH;
+  if((rotation == 2U) || (rotation == 3U)) vsp = (TFT_WIDTH - vsp) % TFT_WIDTH;
+  // Scroll area is whole display without fixed areas
+  const uint8_t cmd_list[] =
+  {
+    CMD_VSCRDEF, 6U, 0U, 0U, TFT_WIDTH >> 8, TFT_WIDTH & 0xFF, 0U, 0U,
+    CMD_VSAADDR, 2U, (uint8_t)(vsp >> 8), (uint8_t)vsp,
+    CMD_NOP
+  };
+  WriteCommandList(cmd_list);
+}
+
 // *****************************************************************************
 // ***   Invert display   ******************************************************
 // *****************************************************************************
@@ -42,6 +42,8 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include <DevCfg.h>
+#include "IDisplay.h"
+#include "RtosSemaphore.h"
 
 // *****************************************************************************
 // ***   Enums   ***************************************************************
@@ -94,7 +96,7 @@ enum Color
   COLOR_MAGENTA         = 0x1FF8, // 255,   0, 255
 };
 
-class ILI9341
+class ILI9341 : public IDisplay
 {
   public:
     // *************************************************************************
@@ -125,27 +127,53 @@ class ILI9341
     // *************************************************************************
     // ***   Write data steram to SPI   ****************************************
     // *************************************************************************
-    void WriteDataStream(uint8_t* data, uint32_t n);
+    virtual void WriteDataStream(uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Write commands list to SPI   **************************************
+    // *************************************************************************
+    // * All commands sent with one CS assertion. List format: command, count
+    // * of data bytes, data bytes. CMD_NOP(0x00) command ends the list.
+    void WriteCommandList(const uint8_t* list);
 
     // *************************************************************************
     // ***   Check SPI transfer status  ****************************************
     // *************************************************************************
-    bool IsTransferComplete(void);
+    virtual bool IsTransferComplete(void);
 
     // *************************************************************************
     // ***   Pull up CS line for LCD  ******************************************
     // *************************************************************************
-    void StopTransfer(void);
+    virtual void StopTransfer(void);
+
+    // *************************************************************************
+    // ***   Abort DMA transfer   **********************************************
+    // *************************************************************************
+    virtual void AbortTransfer(void);
+
+    // *************************************************************************
+    // ***   SPI transfer complete callback   **********************************
+    // *************************************************************************
+    // * Must be called from HAL_SPI_TxCpltCallback(). Calls callback set by
+    // * SetCallback() if transfer was for this display.
+    void TransferCompleteCallback(SPI_HandleTypeDef* in_hspi);
+
+    // *************************************************************************
+    // ***   SPI transfer error callback   *************************************
+    // *************************************************************************
+    // * Must be called from HAL_SPI_ErrorCallback(). Aborts solid fill or
+    // * calls callback set by SetErrorCallback().
+    void TransferErrorCallback(SPI_HandleTypeDef* in_hspi);
 
     // *************************************************************************
     // ***   Init screen   *****************************************************
     // *************************************************************************
-    void Init(void);
+    virtual Result Init(void);
 
     // *************************************************************************
     // ***   Set output window   ***********************************************
     // *************************************************************************
-    void SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    virtual void SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
     // *************************************************************************
     // ***   Pass 8-bit (each) R,G,B, get back 16-bit packed color   ***********
@@ -155,7 +183,7 @@ class ILI9341
     // *************************************************************************
     // ***   Set screen orientation   ******************************************
     // *************************************************************************
-    void SetRotation(uint8_t r);
+    virtual void SetRotation(uint8_t r);
 
     // *************************************************************************
     // ***   Write color to screen   *******************************************
@@ -185,13 +213,23 @@ class ILI9341
     // *************************************************************************
     // ***   Fill rectangle on screen   ****************************************
     // *************************************************************************
-    void FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    // * Rectangle filled by DMA in 16-bit SPI mode. Function returns when
+    // * transfer completed.
+    virtual void FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 
     // *************************************************************************
     // ***   Invert display   **************************************************
     // *************************************************************************
     void InvertDisplay(bool invert);
 
+    // *************************************************************************
+    // ***   Set hardware scroll offset   **************************************
+    // *************************************************************************
+    // * Scroll display along long side(X for rotation 1 and 3, Y for rotation
+    // * 0 and 2). After call screen pixel with coordinate 0 shows display
+    // * memory with coordinate offset, memory wraps around at end of screen.
+    virtual void SetScrollOffset(uint16_t offset);
+
     // *************************************************************************
     // ***   Read data from SPI   **********************************************
     // *************************************************************************
@@ -210,17 +248,17 @@ class ILI9341
     // *************************************************************************
     // ***   Return screen width   *********************************************
     // *************************************************************************
-    inline int32_t GetWidth(void) {return width;}
+    virtual int32_t GetWidth(void) {return width;}
 
     // *************************************************************************
     // ***   Return screen height   ********************************************
     // *************************************************************************
-    inline int32_t GetHeight(void) {return height;}
+    virtual int32_t GetHeight(void) {return height;}
 
     // *************************************************************************
     // ***   Return byte(s) per pixel   ****************************************
     // *************************************************************************
-    inline int32_t GetBytesPerPixel(void) {return byte_per_pixel;}
+    virtual int32_t GetBytesPerPixel(void) {return byte_per_pixel;}
 
     // *************************************************************************
     // ***   Return max line   *************************************************
@@ -234,6 +272,11 @@ class ILI9341
 
   private:
 
+    // Timeout for blocking SPI transfers
+    static const uint32_t SPI_TIMEOUT_MS = 10U;
+    // Timeout for solid fill of full screen
+    static const uint32_t FILL_TIMEOUT_MS = 500U;
+
     // Display width
     static const int32_t TFT_WIDTH = 320;
     // Display height
@@ -253,6 +296,30 @@ class ILI9341
 
     // Rotation
     uint32_t rotation = 0U;
+
+    // Color for solid fill by DMA
+    uint16_t fill_color = 0U;
+    // Solid fill in progress
+    volatile bool is_fill = false;
+    // Pixels of solid fill which transfers not started yet
+    volatile uint32_t fill_left = 0U;
+    // Semaphore to wake up task when solid fill complete
+    RtosSemaphore fill_done;
+
+    // *************************************************************************
+    // ***   Send command, CS must be pulled down   ****************************
+    // *************************************************************************
+    inline void SendCommand(uint8_t c);
+
+    // *************************************************************************
+    // ***   Send data, CS must be pulled down   *******************************
+    // *************************************************************************
+    inline void SendData(const uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Switch SPI and DMA to solid fill mode   ***************************
+    // *************************************************************************
+    void SetFillMode(bool is_fill);
 };
 
 #endif
@@ -42,6 +42,9 @@ Image::Image(int32_t x, int32_t y, const ImageDesc& img_dsc) : img_description(i
   palette = img_dsc.palette;
   transparent_color = img_dsc.transparent_color;
   hor_mirror = false;
+  new_hor_mirror = false;
+  taken_hor_mirror = false;
+  SelectBlitter();
 }
 
 // *****************************************************************************
@@ -52,64 +55,67 @@ void Image::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
   // Draw only if needed
   if((line >= y_start) && (line <= y_end))
   {
-    // Find idx in the image buffer
-    uint32_t idx = (line - y_start) * width;
+    // Find idx of pixel in the image line
+    uint32_t idx = 0U;
     // Find start x position
     int32_t start = x_start - start_x;
     // Prevent write in memory before buffer
-    if(start < 0)
-    {
-      // Minus minus - plus
-      idx -= start;
-      start = 0;
-    }
+    if(start < 0) start = 0;
     // Find start x position
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Delta for cycle increment/decrement
-    int32_t delta = 1;
     // Flip horizontally if needed
     if(hor_mirror)
     {
-      idx += end - start;
-      // Set delta to minus one for decrement cycle
-      delta = -1;
+      // First pixel in buffer is counted from the right side of image
+      idx += x_end - start_x - start;
     }
-    // Draw image
-    if(bits_per_pixel == 16)
+    else
     {
-      // Get pointer to 16-bit image data
-      uint16_t* p_img = (uint16_t*)img;
-      // Pixels data copy cycle
-      for(int32_t i = start; i <= end; i++)
-      {
-        // Get pixel data
-        uint16_t data = p_img[idx];
-        // Change index
-        idx += delta;
-        // If not transparent - output to buffer
-        if(data != transparent_color) buf[i] = data;
-      }
+      // Skip pixels outside buffer
+      idx += start - (x_start - start_x);
     }
-    else
+    // Draw image by kernel selected for image format
+    if((start <= end) && (blit != nullptr))
     {
-      // Get pointer to 8-bit image data
-      uint8_t* p_img = (uint8_t*)img;
-      // Pixels data copy cycle
-      for(int32_t i = start; i <= end; i++)
+      // Run-length encoded image has own format of lines
+      if(bits_per_pixel & IMAGE_RLE)
+      {
+        DrawRleInBufW(buf, start, end, line - y_start, start_x);
+      }
+      else
       {
-        // Get pixel data
-        uint16_t data = palette[p_img[idx]];
-        // Change index
-        idx += delta;
-        // If not transparent - output to buffer
-        if(data != transparent_color) buf[i] = data;
+        const uint8_t* p_line;
+        if(bits_per_pixel & IMAGE_LZ)
+        {
+          p_line = DecodeLzRow(line - y_start, hor_mirror ? idx : (idx + end - start));
+        }
+        else
+        {
+          // Lines of packed images start from byte boundary
+          uint32_t line_size = (width * (bits_per_pixel & ~IMAGE_ALPHA) + 7U) / 8U;
+          p_line = (const uint8_t*)img + (line - y_start) * line_size;
+        }
+        if(p_line != nullptr)
+        {
+          blit(&buf[start], p_line, idx, end - start + 1, palette, transparent_color);
+        }
       }
     }
   }
 }
 
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool Image::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // Image is opaque if it hasn't transparent color. Run-length encoded image
+  // always has transparent pixels, image with alpha channel can have them.
+  return (transparent_color < 0) && ((bits_per_pixel & (IMAGE_RLE | IMAGE_ALPHA)) == 0U) && IsSpanInside(line, x1, x2);
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
@@ -137,18 +143,159 @@ void Image::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
 // *****************************************************************************
 // ***   Set Image function   **************************************************
 // *****************************************************************************
-void Image::SetImage(const ImageDesc& img_dsc, bool semaphore_taken)
+void Image::SetImage(const ImageDesc& img_dsc)
 {
-  if(semaphore_taken == false) LockVisObject();
-  width = img_dsc.width;
-  height = img_dsc.height;
-  x_end = x_start + width - 1;
-  y_end = y_start + height - 1;
-  bits_per_pixel = img_dsc.bits_per_pixel;
-  img = img_dsc.img;
-  palette = img_dsc.palette;
-  transparent_color = img_dsc.transparent_color;
-  if(semaphore_taken == false) UnlockVisObject();
+  // Image used by DisplayDrv during frame drawing, so new image will be
+  // applied before next frame
+  Rtos::EnterCriticalSection();
+  new_img_dsc = &img_dsc;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Set Horizontal Flip function   ****************************************
+// *****************************************************************************
+void Image::SetHorizontalFlip(bool flip)
+{
+  // Flip will be applied before next frame
+  Rtos::EnterCriticalSection();
+  new_hor_mirror = flip;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void Image::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take new image if it set
+  if(new_img_dsc != nullptr)
+  {
+    taken_img_dsc = new_img_dsc;
+    new_img_dsc = nullptr;
+  }
+  taken_hor_mirror = new_hor_mirror;
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void Image::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply new image if it set
+  if(taken_img_dsc != nullptr)
+  {
+    // Old area should be redrawn
+    Invalidate();
+    width = taken_img_dsc->width;
+    height = taken_img_dsc->height;
+    x_end = x_start + width - 1;
+    y_end = y_start + height - 1;
+    bits_per_pixel = taken_img_dsc->bits_per_pixel;
+    img = taken_img_dsc->img;
+    palette = taken_img_dsc->palette;
+    transparent_color = taken_img_dsc->transparent_color;
+    taken_img_dsc = nullptr;
+    SelectBlitter();
+    // New area should be redrawn
+    Invalidate();
+  }
+  // Apply flip if changed
+  if(hor_mirror != taken_hor_mirror)
+  {
+    hor_mirror = taken_hor_mirror;
+    SelectBlitter();
+    // Image area should be redrawn
+    Invalidate();
+  }
+}
+
+// *****************************************************************************
+// ***   Select blit kernel   **************************************************
+// *****************************************************************************
+void Image::SelectBlitter(void)
+{
+  if(bits_per_pixel & IMAGE_RLE)
+  {
+    // Runs contain only opaque pixels
+    blit = Blitter::GetBlitter(bits_per_pixel & ~IMAGE_RLE, hor_mirror, false);
+  }
+  else if(bits_per_pixel & IMAGE_ALPHA)
+  {
+    blit = Blitter::GetAlphaBlitter(hor_mirror);
+  }
+  else
+  {
+    // Decoded rows of compressed images are drawn by kernels of their format
+    blit = Blitter::GetBlitter(bits_per_pixel & ~IMAGE_LZ, hor_mirror, transparent_color >= 0);
+  }
+}
+
+// *****************************************************************************
+// ***   Decode row of LZ compressed image   ***********************************
+// *****************************************************************************
+const uint8_t* Image::DecodeLzRow(int32_t row, uint32_t last_idx)
+{
+  const uint8_t* p_line = nullptr;
+  // Bytes needed to draw pixels from start of row to last_idx
+  uint32_t size = ((last_idx + 1U) * (bits_per_pixel & ~(IMAGE_ALPHA | IMAGE_LZ)) + 7U) / 8U;
+  if(size <= LzDecoder::MAX_ROW_SIZE)
+  {
+    const uint8_t* data = (const uint8_t*)img;
+    const uint8_t* p = data + row * 4;
+    // Row offset from offsets table
+    uint32_t pos = p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24);
+    p_line = LzDecoder::DecodeRow(data + pos, size);
+  }
+  return p_line;
+}
+
+// *****************************************************************************
+// ***   Put line of run-length encoded image in buffer   **********************
+// *****************************************************************************
+void Image::DrawRleInBufW(uint16_t* buf, int32_t start, int32_t end, int32_t row, int32_t start_x)
+{
+  const uint8_t* data = (const uint8_t*)img;
+  // Row data position and end from offsets table
+  uint32_t pos = data[row * 2] | (data[row * 2 + 1] << 8);
+  uint32_t row_end = data[row * 2 + 2] | (data[row * 2 + 3] << 8);
+  // Buffer position of image column 0(or last column for mirrored image)
+  int32_t x0 = hor_mirror ? (x_end - start_x) : (x_start - start_x);
+  // Image columns visible in buffer
+  int32_t c0 = hor_mirror ? (x0 - end)   : (start - x0);
+  int32_t c1 = hor_mirror ? (x0 - start) : (end - x0);
+  // Image column of current run
+  int32_t col = 0;
+  // Process runs until all visible columns done
+  while((pos < row_end) && (col <= c1))
+  {
+    // Jump over transparent pixels
+    col += data[pos++];
+    // Pixels to copy
+    int32_t cnt = data[pos++];
+    const uint8_t* pixels = &data[pos];
+    pos += cnt;
+    // Clip run by visible columns
+    int32_t a = (col < c0) ? c0 : col;
+    int32_t b = (col + cnt - 1 > c1) ? c1 : (col + cnt - 1);
+    if(a <= b)
+    {
+      // Mirrored kernel reads pixels backward from the last one
+      if(hor_mirror) blit(&buf[x0 - b], pixels, b - col, b - a + 1, palette, 0U);
+      else           blit(&buf[x0 + a], pixels, a - col, b - a + 1, palette, 0U);
+    }
+    col += cnt;
+  }
 }
 
 // *****************************************************************************
@@ -170,6 +317,7 @@ Image8::Image8(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* p_img,
   height = h;
   img = p_img;
   palette = p_palette;
+  blit = Blitter::GetBlitter(8U, false, false);
 }
 
 // *****************************************************************************
@@ -188,18 +336,25 @@ void Image8::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Have sense draw only if end pointer in buffer
-    if(x_end > 0)
+    // Have sense draw only if object in buffer
+    if((start < n) && (end >= 0))
     {
-      int idx = (line - y_start) * width;
-      for(int32_t i = start; i <= end; i++)
-      {
-        buf[i] = palette[img[idx++]];
-      }
+      // Skip lines above and pixels outside buffer
+      int idx = (line - y_start) * width + start - (x_start - start_x);
+      blit(&buf[start], img, idx, end - start + 1, palette, 0U);
     }
   }
 }
 
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool Image8::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // Image without transparency
+  return IsSpanInside(line, x1, x2);
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
@@ -242,6 +397,7 @@ Image16::Image16(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* p_i
   width = w;
   height = h;
   img = p_img;
+  blit = Blitter::GetBlitter(16U, false, false);
 }
 
 // *****************************************************************************
@@ -260,18 +416,25 @@ void Image16::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Have sense draw only if end pointer in buffer
-    if(x_end > 0)
+    // Have sense draw only if object in buffer
+    if((start < n) && (end >= 0))
     {
-      int idx = (line - y_start) * width;
-      for(int32_t i = start; i <= end; i++)
-      {
-        buf[i] = img[idx++];
-      }
+      // Skip lines above and pixels outside buffer
+      int idx = (line - y_start) * width + start - (x_start - start_x);
+      blit(&buf[start], img, idx, end - start + 1, nullptr, 0U);
     }
   }
 }
 
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool Image16::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // Image without transparency
+  return IsSpanInside(line, x1, x2);
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
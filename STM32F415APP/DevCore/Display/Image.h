@@ -43,6 +43,8 @@
 // *****************************************************************************
 #include "DevCfg.h"
 #include "VisObject.h"
+#include "Blitters.h"
+#include "LzDecoder.h"
 
 // *****************************************************************************
 // ***   Palettes external   ***************************************************
@@ -51,6 +53,36 @@ extern const uint16_t PALETTE_884[256];
 extern const uint16_t PALETTE_775[256];
 extern const uint16_t PALETTE_676[256];
 
+// *****************************************************************************
+// ***   Run-length encoded image flag   ***************************************
+// *****************************************************************************
+// * Set in bits_per_pixel of ImageDesc for run-length encoded 8-bit images.
+// * Data of such image starts from table of (height + 1) 16-bit little endian
+// * offsets of rows from start of data. Each row is sequence of runs: count
+// * of transparent pixels to skip, count of pixels to copy and pixels data.
+// * Tools/RleConverter.py converts 8-bit images to this format.
+const uint8_t IMAGE_RLE = 0x80U;
+
+// *****************************************************************************
+// ***   Alpha channel image flag   ********************************************
+// *****************************************************************************
+// * Set in bits_per_pixel of ImageDesc for 8-bit images with alpha channel.
+// * High nibble of each byte is alpha from 0(transparent) to 15(opaque), low
+// * nibble is index of color in 16 color palette. Transparent color isn't
+// * used by such images.
+const uint8_t IMAGE_ALPHA = 0x40U;
+
+// *****************************************************************************
+// ***   LZ compressed image flag   ********************************************
+// *****************************************************************************
+// * Set in bits_per_pixel of ImageDesc together with bits per pixel of image
+// * (and IMAGE_ALPHA flag if needed). Data of such image starts from table of
+// * (height + 1) 32-bit little endian offsets of rows from start of data.
+// * Each row compressed separately in LzDecoder format, size of decoded row
+// * must not exceed LzDecoder::MAX_ROW_SIZE. Offsets are 32-bit, because
+// * compressed backgrounds can be bigger than 64K.
+const uint8_t IMAGE_LZ = 0x20U;
+
 // *****************************************************************************
 // ***   Image description structure   *****************************************
 // *****************************************************************************
@@ -60,7 +92,8 @@ typedef struct typeImageDesc
   uint16_t width;
   // Image height
   uint16_t height;
-  // Bits per pixel
+  // Bits per pixel: 16, 8 or packed 4, 2, 1. Pixels of packed images stored
+  // from the most significant bits of byte, each line starts from new byte.
   uint8_t bits_per_pixel;
   // Pointer to image data
   union
@@ -96,17 +129,53 @@ class Image : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
+
     // *************************************************************************
     // ***   Set Horizontal Flip function   ************************************
     // *************************************************************************
-    void SetHorizontalFlip(bool flip) {hor_mirror = flip;}
+    // * Flip will be applied from next frame.
+    void SetHorizontalFlip(bool flip);
     
     // *************************************************************************
     // ***   Set Image function   **********************************************
     // *************************************************************************
-    void SetImage(const ImageDesc& img_dsc, bool semaphore_taken = false);
+    // * New image will be shown from next frame. Image description must exist
+    // * until image applied.
+    void SetImage(const ImageDesc& img_dsc);
 
   protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+    // *************************************************************************
+    // ***   Select blit kernel   **********************************************
+    // *************************************************************************
+    // * Must be called after change of image format, transparency or flip.
+    void SelectBlitter(void);
+
+    // *************************************************************************
+    // ***   Put line of run-length encoded image in buffer   ******************
+    // *************************************************************************
+    // * Buffer pixels from start to end are inside image.
+    void DrawRleInBufW(uint16_t* buf, int32_t start, int32_t end, int32_t row, int32_t start_x);
+
+    // *************************************************************************
+    // ***   Decode row of LZ compressed image   *******************************
+    // *************************************************************************
+    // * Decode row up to pixel last_idx. Returns nullptr if row too big.
+    const uint8_t* DecodeLzRow(int32_t row, uint32_t last_idx);
+
     // Reference to image description structure
     const ImageDesc& img_description;
     // Bits per pixel
@@ -119,6 +188,15 @@ class Image : public VisObject
     int32_t transparent_color;
     // Horizontal mirror
     bool hor_mirror;
+    // Kernel for copy image line to buffer
+    Blitter::BlitFunction blit = nullptr;
+    // Image description set by SetImage() and not applied yet
+    const ImageDesc* volatile new_img_dsc = nullptr;
+    // Horizontal mirror set by SetHorizontalFlip() and not applied yet
+    volatile bool new_hor_mirror;
+    // Image description and mirror taken by TakePending() and not applied yet
+    const ImageDesc* taken_img_dsc = nullptr;
+    bool taken_hor_mirror;
 };
 
 // *****************************************************************************
@@ -141,12 +219,19 @@ class Image8 : public VisObject
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
     
   private:
     // Pointer to the image
     const uint8_t* img;
     // Pointer to the palette
     const uint16_t* palette;
+    // Kernel for copy image line to buffer
+    Blitter::BlitFunction blit;
 };
 
 // *****************************************************************************
@@ -169,10 +254,17 @@ class Image16 : public VisObject
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
     
   private:
     // Pointer to the image
     const uint16_t* img;
+    // Kernel for copy image line to buffer
+    Blitter::BlitFunction blit;
 };
 
 #endif
@@ -0,0 +1,77 @@
+//******************************************************************************
+//  @file LzDecoder.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Decoder of LZ compressed image rows, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "LzDecoder.h"
+
+#include <string.h>
+
+// *****************************************************************************
+// ***   Static variables   ****************************************************
+// *****************************************************************************
+uint8_t LzDecoder::row_buf[MAX_ROW_SIZE];
+
+// *****************************************************************************
+// ***   Decode row   **********************************************************
+// *****************************************************************************
+const uint8_t* LzDecoder::DecodeRow(const uint8_t* src, uint32_t size)
+{
+  uint8_t* dst = row_buf;
+  // Prevent buffer overflow
+  if(size > MAX_ROW_SIZE) size = MAX_ROW_SIZE;
+  uint8_t* end = row_buf + size;
+
+  while(dst < end)
+  {
+    uint32_t tag = *src++;
+    if(tag < 0x80U)
+    {
+      // Literals
+      uint32_t n = tag + 1U;
+      if(n > (uint32_t)(end - dst)) n = end - dst;
+      memcpy(dst, src, n);
+      dst += n;
+      src += n;
+    }
+    else
+    {
+      // Match
+      uint32_t dist = (((tag & 0x03U) << 8U) | *src++) + 1U;
+      uint32_t n = (tag >> 2U) & 0x1FU;
+      n = (n == 0x1FU) ? (34U + *src++) : (n + 3U);
+      // Broken data - stop decoding
+      if(dist > (uint32_t)(dst - row_buf)) break;
+      if(n > (uint32_t)(end - dst)) n = end - dst;
+      const uint8_t* p = dst - dist;
+      if(dist >= n)
+      {
+        // Source and destination don't overlap
+        memcpy(dst, p, n);
+        dst += n;
+      }
+      else
+      {
+        // Overlapped match repeats last dist bytes(runs of pixels)
+        for(uint8_t* match_end = dst + n; dst < match_end; dst++) *dst = *p++;
+      }
+    }
+  }
+
+  return row_buf;
+}
@@ -0,0 +1,238 @@
+//******************************************************************************
+//  @file ParallaxMap.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Multi-layer Tiled Map Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "ParallaxMap.h"
+
+#include <cstring>
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+ParallaxMap::ParallaxMap(int32_t x, int32_t y, int32_t w, int32_t h,
+                         const TileLayer* layers_in, uint32_t n, int32_t def_color,
+                         TileRowCache::Entry* cache, uint32_t cache_size)
+{
+  x_start = x;
+  y_start = y;
+  width = w;
+  height = h;
+  x_end = x_start + width - 1;
+  y_end = y_start + height - 1;
+  layers = layers_in;
+  layers_cnt = (n < MAX_LAYERS) ? n : MAX_LAYERS;
+  bg_color = def_color;
+  tile_cache.Init(cache, cache_size);
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void ParallaxMap::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    // Find start x position
+    int32_t start = x_start - start_x;
+    // Prevent write in memory before buffer
+    if(start < 0) start = 0;
+    // Find end x position
+    int32_t end = x_end - start_x;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+
+    // Find position of first pixel in buffer in each layer
+    Cursor cursor[MAX_LAYERS];
+    for(uint32_t l = 0U; l < layers_cnt; l++)
+    {
+      const TileLayer& layer = layers[l];
+      int32_t tile_w = layer.tiles->width;
+      int32_t tile_h = layer.tiles->height;
+      int32_t lx = (((x_pos * (int32_t)layer.scroll_ratio) >> 8) + start + start_x - x_start) % (tile_w * layer.map_width);
+      int32_t ly = (((y_pos * (int32_t)layer.scroll_ratio) >> 8) + line - y_start) % (tile_h * layer.map_height);
+      cursor[l].map_line = layer.map + (ly / tile_h) * layer.map_width;
+      cursor[l].col = lx / tile_w;
+      cursor[l].tile_x = lx % tile_w;
+      cursor[l].tile_y = ly % tile_h;
+    }
+
+    // Draw line by parts, each part ends on tile boundary of drawn layers
+    int32_t pix_idx = start;
+    while(pix_idx <= end)
+    {
+      int32_t cnt = end - pix_idx + 1;
+      // Find topmost layer with opaque tile, layers below it are invisible.
+      // Each set of cache has at least MAX_LAYERS entries, so rows taken for
+      // this part can't replace each other.
+      int32_t base = (int32_t)layers_cnt - 1;
+      for(; base >= 0; base--)
+      {
+        UpdateCursor(layers[base], cursor[base]);
+        int32_t tile_cnt = layers[base].tiles->width - cursor[base].tile_x;
+        if(cnt > tile_cnt) cnt = tile_cnt;
+        if(IsCursorOpaque(cursor[base])) break;
+      }
+      // Fill by background color if there is no opaque layer
+      if((base < 0) && (bg_color >= 0))
+      {
+        for(int32_t i = pix_idx; i < pix_idx + cnt; i++) buf[i] = bg_color;
+      }
+      // Draw visible layers from bottom to top
+      for(int32_t l = (base < 0) ? 0 : base; l < (int32_t)layers_cnt; l++)
+      {
+        if(cursor[l].tile != nullptr) DrawSpan(&buf[pix_idx], cnt, cursor[l]);
+      }
+      // Move cursors of all layers
+      for(uint32_t l = 0U; l < layers_cnt; l++)
+      {
+        uint32_t tile_w = layers[l].tiles->width;
+        cursor[l].tile_x += cnt;
+        while(cursor[l].tile_x >= tile_w)
+        {
+          cursor[l].tile_x -= tile_w;
+          cursor[l].col++;
+          if(cursor[l].col >= layers[l].map_width) cursor[l].col = 0U;
+        }
+      }
+      pix_idx += cnt;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool ParallaxMap::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // Map is opaque only if it filled by background color
+  return (bg_color >= 0) && IsSpanInside(line, x1, x2);
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void ParallaxMap::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+   // Not implemented yet
+}
+
+// *****************************************************************************
+// ***   Scroll view   *********************************************************
+// *****************************************************************************
+void ParallaxMap::ScrollView(int32_t dx, int32_t dy)
+{
+  // View position used by DisplayDrv during frame drawing, so scroll will be
+  // applied before next frame
+  Rtos::EnterCriticalSection();
+  int32_t x = x_pos + taken_scroll_dx + scroll_dx + dx;
+  if(x < 0) x = 0;
+  int32_t y = y_pos + taken_scroll_dy + scroll_dy + dy;
+  if(y < 0) y = 0;
+  scroll_dx = x - x_pos - taken_scroll_dx;
+  scroll_dy = y - y_pos - taken_scroll_dy;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void ParallaxMap::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take scroll
+  taken_scroll_dx += scroll_dx;
+  taken_scroll_dy += scroll_dy;
+  scroll_dx = 0;
+  scroll_dy = 0;
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void ParallaxMap::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply scroll. Layers scrolled with different speed, so whole map should
+  // be redrawn.
+  if((taken_scroll_dx != 0) || (taken_scroll_dy != 0))
+  {
+    Invalidate();
+    // Tasks calculate scroll from position with taken scroll, so both
+    // changed together
+    Rtos::EnterCriticalSection();
+    x_pos += taken_scroll_dx;
+    y_pos += taken_scroll_dy;
+    taken_scroll_dx = 0;
+    taken_scroll_dy = 0;
+    Rtos::ExitCriticalSection();
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Find tile under cursor   *************************************
+// *****************************************************************************
+void ParallaxMap::UpdateCursor(const TileLayer& layer, Cursor& c)
+{
+  uint8_t tile_val = c.map_line[c.col] & layer.bitmask;
+  c.tile = (tile_val < layer.tiles_cnt) ? &layer.tiles[tile_val] : nullptr;
+  c.row = nullptr;
+  // Take row from cache if it fits in cache entry
+  if((c.tile != nullptr) && tile_cache.IsEnabled() && (c.tile->width <= TileRowCache::TILE_WIDTH))
+  {
+    c.row = &tile_cache.GetRow(*c.tile, c.tile_y);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Draw span of tile under cursor   *****************************
+// *****************************************************************************
+void ParallaxMap::DrawSpan(uint16_t* buf, int32_t cnt, const Cursor& c)
+{
+  const ImageDesc& tile = *c.tile;
+  if(c.row != nullptr)
+  {
+    // Copy row expanded to RGB565 from cache
+    if(c.row->is_opaque)
+    {
+      memcpy(buf, &c.row->pixels[c.tile_x], cnt * sizeof(buf[0]));
+    }
+    else
+    {
+      Blitter::BlitFunction blit = Blitter::GetBlitter(16U, false, true);
+      blit(buf, c.row->pixels, c.tile_x, cnt, nullptr, tile.transparent_color);
+    }
+  }
+  else
+  {
+    // Lines of packed images start from byte boundary
+    const uint8_t* tile_ptr = tile.img8 + c.tile_y * ((tile.width * tile.bits_per_pixel + 7U) / 8U);
+    // Draw tile by kernel for tile format
+    Blitter::BlitFunction blit = Blitter::GetBlitter(tile.bits_per_pixel, false, tile.transparent_color >= 0);
+    if(blit != nullptr)
+    {
+      blit(buf, tile_ptr, c.tile_x, cnt, tile.palette, tile.transparent_color);
+    }
+  }
+}
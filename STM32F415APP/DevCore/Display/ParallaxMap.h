@@ -0,0 +1,203 @@
+//******************************************************************************
+//  @file ParallaxMap.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Multi-layer Tiled Map Visual Object Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef ParallaxMap_h
+#define ParallaxMap_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "VisObject.h"
+#include "Image.h"
+#include "TiledMap.h"
+
+// *****************************************************************************
+// ***   Tile layer description structure   ************************************
+// *****************************************************************************
+typedef struct typeTileLayer
+{
+  // Pointer to the tiles map
+  const uint8_t* map;
+  // Map width and height in tiles
+  uint32_t map_width;
+  uint32_t map_height;
+  // Bitmask for tiles
+  uint8_t bitmask;
+  // Image descriptions of tiles picture. All tiles of layer must have the
+  // same size.
+  const ImageDesc* tiles;
+  // Count of tiles. Tiles with greater values are empty.
+  uint32_t tiles_cnt;
+  // Layer scroll speed relative to view in 1/256: 256 - layer scrolled with
+  // view, 128 - layer scrolled twice slower than view.
+  uint32_t scroll_ratio;
+} TileLayer;
+
+// *****************************************************************************
+// ***   Parallax Map Class   **************************************************
+// *****************************************************************************
+// * Tiled map with several layers scrolled with different speed. Layers drawn
+// * in one pass: for each part of line only topmost layer with opaque tile
+// * row and layers above it are drawn. Layers repeated if view is bigger
+// * than layer. Cache of tile rows allows skip layers below tiles with
+// * transparent color in ImageDesc, without cache only tiles without
+// * transparent color cover lower layers.
+class ParallaxMap : public VisObject
+{
+  public:
+    // Max count of layers
+    static const uint32_t MAX_LAYERS = 4U;
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    // * First layer is the farthest one. Layers and cache must exist while map
+    // * exists.
+    ParallaxMap(int32_t x, int32_t y, int32_t w, int32_t h,
+                const TileLayer* layers, uint32_t n, int32_t def_color,
+                TileRowCache::Entry* cache = nullptr, uint32_t cache_size = 0U);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
+
+    // *************************************************************************
+    // ***   Scroll view   *****************************************************
+    // *************************************************************************
+    // * View will be scrolled before next frame.
+    void ScrollView(int32_t dx, int32_t dy = 0);
+
+    // *************************************************************************
+    // ***   GetViewPosX   *****************************************************
+    // *************************************************************************
+    int32_t GetViewPosX(void) {return x_pos + taken_scroll_dx + scroll_dx;}
+
+    // *************************************************************************
+    // ***   GetViewPosY   *****************************************************
+    // *************************************************************************
+    int32_t GetViewPosY(void) {return y_pos + taken_scroll_dy + scroll_dy;}
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+  private:
+    // *************************************************************************
+    // ***   Layer position in current line   **********************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Pointer to the line of map
+      const uint8_t* map_line;
+      // Column of tile in map and pixel in tile
+      uint32_t col;
+      uint32_t tile_x;
+      // Row in tile
+      uint32_t tile_y;
+      // Tile under cursor, nullptr for empty tile
+      const ImageDesc* tile;
+      // Cached row of tile, nullptr if row isn't cached
+      const TileRowCache::Entry* row;
+    } Cursor;
+
+    // *************************************************************************
+    // ***   Find tile under cursor   ******************************************
+    // *************************************************************************
+    void UpdateCursor(const TileLayer& layer, Cursor& c);
+
+    // *************************************************************************
+    // ***   Check if tile row under cursor is opaque   ************************
+    // *************************************************************************
+    static inline bool IsCursorOpaque(const Cursor& c)
+    {
+      return (c.tile != nullptr) && ((c.row != nullptr) ? c.row->is_opaque : (c.tile->transparent_color < 0));
+    }
+
+    // *************************************************************************
+    // ***   Draw span of tile under cursor   **********************************
+    // *************************************************************************
+    static void DrawSpan(uint16_t* buf, int32_t cnt, const Cursor& c);
+
+    // Layers
+    const TileLayer* layers;
+    // Count of layers
+    uint32_t layers_cnt;
+    // Background color (-1 - transparent)
+    int32_t bg_color;
+    // View position
+    int32_t x_pos = 0;
+    int32_t y_pos = 0;
+    // Scroll requested by task and not applied yet
+    int32_t scroll_dx = 0;
+    int32_t scroll_dy = 0;
+    // Scroll taken by TakePending() and not applied yet
+    int32_t taken_scroll_dx = 0;
+    int32_t taken_scroll_dy = 0;
+    // Cache of tile rows
+    TileRowCache tile_cache;
+};
+
+#endif
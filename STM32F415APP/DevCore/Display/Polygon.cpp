@@ -0,0 +1,363 @@
+//******************************************************************************
+//  @file Polygon.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Polygon Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "Polygon.h"
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+Polygon::Polygon(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c,
+                 bool is_fill, int32_t outline_c)
+{
+  SetParams(x, y, pts, cnt, c, is_fill, outline_c);
+}
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void Polygon::SetParams(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c,
+                        bool is_fill, int32_t outline_c)
+{
+  // Old area should be redrawn
+  Invalidate();
+  color = c;
+  fill = is_fill;
+  outline = !is_fill || (outline_c >= 0);
+  outline_color = is_fill ? outline_c : c;
+  vertices_cnt = (pts == nullptr) ? 0U : ((cnt < MAX_VERTICES) ? cnt : MAX_VERTICES);
+  // Pending changes replaced by new vertices
+  changed_mask = 0U;
+  taken_mask = 0U;
+  for(uint32_t i = 0U; i < vertices_cnt; i++)
+  {
+    vertices[i] = pts[i];
+    new_vertices[i] = pts[i];
+  }
+  for(uint32_t i = 0U; i < vertices_cnt; i++)
+  {
+    SetEdge(i);
+    order[i] = i;
+  }
+  // Object area starts at position until UpdateShape() calculates it
+  x_start = x;
+  y_start = y;
+  org_x = 0;
+  org_y = 0;
+  rotation = 0;
+  UpdateShape();
+  // New area should be redrawn
+  Invalidate();
+}
+
+// *****************************************************************************
+// ***   Set vertex   **********************************************************
+// *****************************************************************************
+void Polygon::SetVertex(uint32_t idx, int32_t x, int32_t y)
+{
+  if(idx < vertices_cnt)
+  {
+    Rtos::EnterCriticalSection();
+    new_vertices[idx].x = x;
+    new_vertices[idx].y = y;
+    changed_mask |= 1UL << idx;
+    changes_pending = true;
+    Rtos::ExitCriticalSection();
+    // Apply changes immediately if object isn't in DisplayDrv list
+    CommitChanges();
+  }
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void Polygon::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take changed vertices. Vertices used only for calculate edges and area,
+  // so they taken directly.
+  if(changed_mask != 0U)
+  {
+    for(uint32_t i = 0U; i < vertices_cnt; i++)
+    {
+      if(changed_mask & (1UL << i)) vertices[i] = new_vertices[i];
+    }
+    taken_mask |= changed_mask;
+    changed_mask = 0U;
+  }
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void Polygon::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply changes of vertices
+  if(taken_mask != 0U)
+  {
+    // Old area should be redrawn
+    Invalidate();
+    // Each vertex used by previous and own edges
+    uint32_t edges_mask = 0U;
+    for(uint32_t i = 0U; i < vertices_cnt; i++)
+    {
+      if(taken_mask & (1UL << i))
+      {
+        edges_mask |= (1UL << i) | (1UL << ((i == 0U) ? (vertices_cnt - 1U) : (i - 1U)));
+      }
+    }
+    taken_mask = 0U;
+    for(uint32_t i = 0U; i < vertices_cnt; i++)
+    {
+      if(edges_mask & (1UL << i)) SetEdge(i);
+    }
+    UpdateShape();
+    // New area should be redrawn
+    Invalidate();
+  }
+  // Position or edges could be changed
+  last_line = 0x7FFFFFFF;
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void Polygon::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    if(fill)
+    {
+      // Line relative to polygon position
+      const int32_t y = line - (y_start + org_y);
+      // Restart active list if line isn't next line of the same area. Line
+      // compared with last line this way to avoid overflow of 0x7FFFFFFF.
+      if(line - 1 != last_line)
+      {
+        active_cnt = 0U;
+        next_edge = 0U;
+      }
+      else
+      {
+        // Advance edges to this line and remove finished edges
+        uint32_t cnt = 0U;
+        for(uint32_t i = 0U; i < active_cnt; i++)
+        {
+          const Edge& e = edges[active[i]];
+          if(e.y_bottom >= y)
+          {
+            active[cnt] = active[i];
+            active_x[cnt] = active_x[i] + e.slope;
+            cnt++;
+          }
+        }
+        active_cnt = cnt;
+      }
+      last_line = line;
+      // Add edges started on this line
+      while((next_edge < vertices_cnt) && (edges[order[next_edge]].y_top <= y))
+      {
+        const Edge& e = edges[order[next_edge]];
+        // After restart edges which ended above line skipped
+        if(e.y_bottom >= y)
+        {
+          active[active_cnt] = order[next_edge];
+          active_x[active_cnt] = e.x_top + (y - e.y_top) * e.slope;
+          active_cnt++;
+        }
+        next_edge++;
+      }
+      // Position of polygon in buffer
+      const int32_t x = x_start + org_x - start_x;
+      if(is_monotone && (active_cnt == 2U))
+      {
+        // Fast path: span between two edges
+        int32_t xl = active_x[0];
+        int32_t xr = active_x[1];
+        if(xl > xr)
+        {
+          xl = active_x[1];
+          xr = active_x[0];
+        }
+        // Pixels with centers from left edge to right edge excluding it
+        LineRaster::FillSpan(buf, n, x + ((xl + 0xFFFF) >> 16), x + ((xr + 0xFFFF) >> 16) - 1, color);
+      }
+      else
+      {
+        // Sort active edges by X. Edges rarely change order between lines,
+        // so insertion sort is almost linear.
+        for(uint32_t i = 1U; i < active_cnt; i++)
+        {
+          const uint8_t idx = active[i];
+          const int32_t ax = active_x[i];
+          uint32_t j = i;
+          for(; (j > 0U) && (active_x[j - 1U] > ax); j--)
+          {
+            active[j] = active[j - 1U];
+            active_x[j] = active_x[j - 1U];
+          }
+          active[j] = idx;
+          active_x[j] = ax;
+        }
+        // Even-odd rule: fill between pairs of edges
+        for(uint32_t i = 0U; i + 1U < active_cnt; i += 2U)
+        {
+          LineRaster::FillSpan(buf, n, x + ((active_x[i] + 0xFFFF) >> 16),
+                               x + ((active_x[i + 1U] + 0xFFFF) >> 16) - 1, color);
+        }
+      }
+    }
+    if(outline)
+    {
+      DrawOutline(buf, n, line, start_x);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void Polygon::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // FIX ME: implement for Vertical Update Mode too
+}
+
+// *****************************************************************************
+// ***   Private: Calculate edge   *********************************************
+// *****************************************************************************
+void Polygon::SetEdge(uint32_t i)
+{
+  const Point* v0 = &vertices[i];
+  const Point* v1 = &vertices[(i + 1U < vertices_cnt) ? (i + 1U) : 0U];
+  // Edge directed from top to bottom
+  if(v0->y > v1->y)
+  {
+    const Point* tmp = v0;
+    v0 = v1;
+    v1 = tmp;
+  }
+  Edge& e = edges[i];
+  // Edge includes lines from top vertex to bottom vertex excluding it, so
+  // lines where edges meet crossed only once
+  e.y_top = (v0->y + (1 << FRAC_BITS) - 1) >> FRAC_BITS;
+  e.y_bottom = ((v1->y + (1 << FRAC_BITS) - 1) >> FRAC_BITS) - 1;
+  const int32_t dx = v1->x - v0->x;
+  const int32_t dy = v1->y - v0->y;
+  if(dy > 0)
+  {
+    e.slope = (int32_t)(((int64_t)dx << 16) / dy);
+    // X on first line
+    const int32_t ty = (e.y_top << FRAC_BITS) - v0->y;
+    e.x_top = (v0->x << (16 - FRAC_BITS)) + (int32_t)((((int64_t)dx * ty) << (16 - FRAC_BITS)) / dy);
+  }
+  else
+  {
+    // Horizontal edge doesn't cross any line: y_top is greater than y_bottom
+    e.slope = 0;
+    e.x_top = 0;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Update polygon after change of vertices   ********************
+// *****************************************************************************
+void Polygon::UpdateShape(void)
+{
+  // Position of polygon
+  const int32_t x = x_start + org_x;
+  const int32_t y = y_start + org_y;
+  // Bounding box of vertices in pixels
+  int32_t min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+  for(uint32_t i = 0U; i < vertices_cnt; i++)
+  {
+    if((i == 0U) || (vertices[i].x < min_x)) min_x = vertices[i].x;
+    if((i == 0U) || (vertices[i].y < min_y)) min_y = vertices[i].y;
+    if((i == 0U) || (vertices[i].x > max_x)) max_x = vertices[i].x;
+    if((i == 0U) || (vertices[i].y > max_y)) max_y = vertices[i].y;
+  }
+  // Floor of minimum and ceiling of maximum cover filled pixels and outline
+  x_start = x + (min_x >> FRAC_BITS);
+  y_start = y + (min_y >> FRAC_BITS);
+  x_end = x + ((max_x + (1 << FRAC_BITS) - 1) >> FRAC_BITS);
+  y_end = y + ((max_y + (1 << FRAC_BITS) - 1) >> FRAC_BITS);
+  width = x_end - x_start + 1;
+  height = y_end - y_start + 1;
+  org_x = x - x_start;
+  org_y = y - y_start;
+  // Sort edges by first line. Order changes a little after vertex move, so
+  // insertion sort is almost linear.
+  for(uint32_t i = 1U; i < vertices_cnt; i++)
+  {
+    const uint8_t idx = order[i];
+    uint32_t j = i;
+    for(; (j > 0U) && (edges[order[j - 1U]].y_top > edges[idx].y_top); j--)
+    {
+      order[j] = order[j - 1U];
+    }
+    order[j] = idx;
+  }
+  // Polygon crosses any line at most twice if direction of edges by Y
+  // changes at most twice
+  uint32_t turns = 0U;
+  int32_t dir = 0;
+  int32_t first_dir = 0;
+  for(uint32_t i = 0U; i < vertices_cnt; i++)
+  {
+    const int32_t dy = vertices[(i + 1U < vertices_cnt) ? (i + 1U) : 0U].y - vertices[i].y;
+    const int32_t d = (dy > 0) ? 1 : ((dy < 0) ? -1 : 0);
+    if(d != 0)
+    {
+      if(first_dir == 0) first_dir = d;
+      else if(d != dir) turns++;
+      dir = d;
+    }
+  }
+  if((dir != 0) && (dir != first_dir)) turns++;
+  is_monotone = (turns <= 2U);
+  // Active list should be restarted
+  last_line = 0x7FFFFFFF;
+}
+
+// *****************************************************************************
+// ***   Private: Draw outline   ***********************************************
+// *****************************************************************************
+void Polygon::DrawOutline(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Position of polygon
+  const int32_t x = x_start + org_x;
+  const int32_t y = y_start + org_y;
+  // Outline drawn between vertices rounded to pixels
+  const int32_t half = 1 << (FRAC_BITS - 1);
+  for(uint32_t i = 0U; i < vertices_cnt; i++)
+  {
+    const Point& v0 = vertices[i];
+    const Point& v1 = vertices[(i + 1U < vertices_cnt) ? (i + 1U) : 0U];
+    const int32_t y1 = y + ((v0.y + half) >> FRAC_BITS);
+    const int32_t y2 = y + ((v1.y + half) >> FRAC_BITS);
+    // Skip edges which don't cross the line
+    if((line < y1) && (line < y2)) continue;
+    if((line > y1) && (line > y2)) continue;
+    LineRaster::Draw(buf, n, line, start_x, x + ((v0.x + half) >> FRAC_BITS), y1,
+                     x + ((v1.x + half) >> FRAC_BITS), y2, 1U, false, outline_color);
+  }
+}
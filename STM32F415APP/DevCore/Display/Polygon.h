@@ -0,0 +1,199 @@
+//******************************************************************************
+//  @file Polygon.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Polygon Visual Object Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef Polygon_h
+#define Polygon_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "VisObject.h"
+#include "Primitives.h"
+
+// *****************************************************************************
+// ***   Polygon Class   *******************************************************
+// *****************************************************************************
+// * Filled polygon with optional outline. Vertices are in fixed point format
+// * with FRAC_BITS fractional bits relative to polygon position, pixel centers
+// * have integer coordinates. Polygon filled by even-odd rule using table of
+// * edges: edges which cross current line kept in active list and their X
+// * advanced incrementally while DisplayDrv walks lines of area. Change of
+// * vertex recalculates only two edges which use it. Triangles and other
+// * polygons which cross any line at most twice(all convex polygons) drawn
+// * without sorting of edges.
+class Polygon : public VisObject
+{
+  public:
+    // Count of fractional bits of vertex coordinates
+    static const int32_t FRAC_BITS = 4;
+    // Max count of vertices
+    static const uint32_t MAX_VERTICES = 16U;
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Polygon() {};
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Polygon(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c,
+            bool is_fill = true, int32_t outline_c = -1);
+
+    // *************************************************************************
+    // ***   SetParams   *******************************************************
+    // *************************************************************************
+    // * Vertices copied to polygon. If polygon isn't filled outline drawn by
+    // * color c, otherwise outline drawn only if outline_c isn't negative.
+    void SetParams(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c,
+                   bool is_fill = true, int32_t outline_c = -1);
+
+    // *************************************************************************
+    // ***   Set vertex   ******************************************************
+    // *************************************************************************
+    // * Coordinates in fixed point format relative to polygon position. Vertex
+    // * will be changed by DisplayDrv before next frame, so tasks can change
+    // * vertices of shown polygon without lock display.
+    void SetVertex(uint32_t idx, int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Get count of vertices   *******************************************
+    // *************************************************************************
+    inline uint32_t GetVerticesCnt(void) {return vertices_cnt;}
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+  private:
+    // *************************************************************************
+    // ***   Edge record   *****************************************************
+    // *************************************************************************
+    // * Coordinates relative to polygon position. Edge crosses lines from
+    // * y_top to y_bottom, X in 16.16 fixed point format.
+    typedef struct
+    {
+      // First and last lines crossed by edge
+      int16_t y_top, y_bottom;
+      // X of edge on first line
+      int32_t x_top;
+      // X increment for each line
+      int32_t slope;
+    } Edge;
+
+    // *************************************************************************
+    // ***   Private: Calculate edge   *****************************************
+    // *************************************************************************
+    // * Edge i connects vertex i with next vertex.
+    void SetEdge(uint32_t i);
+
+    // *************************************************************************
+    // ***   Private: Update polygon after change of vertices   ****************
+    // *************************************************************************
+    // * Recalculates area, order of edges and monotone flag.
+    void UpdateShape(void);
+
+    // *************************************************************************
+    // ***   Private: Draw outline   *******************************************
+    // *************************************************************************
+    void DrawOutline(uint16_t* buf, int32_t n, int32_t line, int32_t start_x);
+
+    // Vertices
+    Point vertices[MAX_VERTICES];
+    // Vertices set by task and not applied yet
+    Point new_vertices[MAX_VERTICES];
+    // Count of vertices
+    uint32_t vertices_cnt = 0U;
+    // Bit mask of vertices changed by task
+    volatile uint32_t changed_mask = 0U;
+    // Bit mask of vertices taken by TakePending() and not applied yet
+    uint32_t taken_mask = 0U;
+    // Edges
+    Edge edges[MAX_VERTICES];
+    // Indexes of edges sorted by first line
+    uint8_t order[MAX_VERTICES];
+    // Edges on current line and their X
+    uint8_t active[MAX_VERTICES];
+    int32_t active_x[MAX_VERTICES];
+    uint32_t active_cnt = 0U;
+    // Next edge in order which isn't added to active list yet
+    uint32_t next_edge = 0U;
+    // Last drawn line. Active list restarted when new area drawn.
+    int32_t last_line = 0x7FFFFFFF;
+    // Position of polygon relative to start of object area
+    int16_t org_x = 0, org_y = 0;
+    // Fill color
+    uint16_t color = 0U;
+    // Outline color
+    uint16_t outline_color = 0U;
+    // Is polygon fill ?
+    bool fill = true;
+    // Is outline drawn ?
+    bool outline = false;
+    // Any line crosses polygon at most twice
+    bool is_monotone = false;
+};
+
+#endif
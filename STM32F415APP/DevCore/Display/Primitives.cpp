@@ -2,7 +2,7 @@
 //  @file Primitives.cpp
 //  @author Nicolai Shlapunov
 //
-//  @details DevCore: Primitives Visual Object Classes(Box, Line, Circle), implementation
+//  @details DevCore: Primitives Visual Object Classes(Box, Line, Polyline, Circle, Ellipse, RoundRect), implementation
 //
 //  @copyright Copyright (c) 2016, Devtronic & Nicolai Shlapunov
 //             All rights reserved.
@@ -21,6 +21,7 @@
 #include "Primitives.h"
 
 #include <cstdlib> // for abs()
+#include <math.h>  // for sqrtf() and ceilf()
 
 // *****************************************************************************
 // *****************************************************************************
@@ -41,6 +42,8 @@ Box::Box(int32_t x, int32_t y, int32_t w, int32_t h, int32_t c, bool is_fill)
 // *****************************************************************************
 void Box::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, int32_t c, bool is_fill)
 {
+  // Old area should be redrawn
+  Invalidate();
   color = c;
   x_start = x;
   y_start = y;
@@ -50,6 +53,8 @@ void Box::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, int32_t c, bool
   height = h;
   rotation = 0;
   fill = is_fill;
+  // New area should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -68,13 +73,13 @@ void Box::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    // Have sense draw only if object in buffer
+    if((start < n) && (end >= 0))
     {
       // If fill or first/last line - must be solid
       if(fill || line == y_start || line == y_end)
       {
-        for(int32_t i = start; i <= end; i++) buf[i] = color;
+        Blitter::FillLine(&buf[start], end - start + 1, color);
       }
       else
       {
@@ -85,6 +90,15 @@ void Box::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
   }
 }
 
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool Box::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // Only filled box is opaque
+  return fill && IsSpanInside(line, x1, x2);
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
@@ -101,8 +115,8 @@ void Box::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
     int32_t end = y_end - start_y;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    // Have sense draw only if object in buffer
+    if((start < n) && (end >= 0))
     {
       // If fill or first/last row - must be solid
       if(fill || row == x_start || row == x_end)
@@ -125,79 +139,268 @@ void Box::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
 // *****************************************************************************
 
 // *****************************************************************************
-// ***   Constructor   *********************************************************
 // *****************************************************************************
-Line::Line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c)
+// ***   LineRaster   **********************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Draw line part on scanline   ******************************************
+// *****************************************************************************
+void LineRaster::Draw(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                      int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                      uint32_t w, bool aa, uint16_t color)
 {
-  SetParams(x1, y1, x2, y2, c);
+  if(w > 1U)
+  {
+    DrawThick(buf, n, line, start_x, x1, y1, x2, y2, w, color);
+  }
+  else if(aa)
+  {
+    DrawAa(buf, n, line, start_x, x1, y1, x2, y2, color);
+  }
+  else
+  {
+    DrawThin(buf, n, line, start_x, x1, y1, x2, y2, color);
+  }
 }
 
 // *****************************************************************************
-// ***   SetParams   ***********************************************************
+// ***   Draw 1 pixel wide line part   *****************************************
 // *****************************************************************************
-void Line::SetParams(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c)
+void LineRaster::DrawThin(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                          int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color)
 {
-  color = c;
-  x_start = x1;
-  y_start = y1;
-  x_end = x2;
-  y_end = y2;
-  width  = (x1 < x2) ? (x2 - x1) : (x1 - x2);
-  height = (y1 < y2) ? (y2 - y1) : (y1 - y2);
-  rotation = 0;
+  // Line always drawn from top to bottom, so both directions give same pixels
+  if(y1 > y2)
+  {
+    int32_t tmp = x1; x1 = x2; x2 = tmp;
+    tmp = y1; y1 = y2; y2 = tmp;
+  }
+  // Draw only if needed
+  if((line >= y1) && (line <= y2))
+  {
+    const int32_t dx = x2 - x1;
+    const int32_t dy = y2 - y1;
+    const int32_t adx = abs(dx);
+    const int32_t t = line - y1;
+    // Start and end distance from x1 of pixels on this line
+    int32_t u1, u2;
+    if(dy == 0)
+    {
+      // Horizontal line
+      u1 = 0;
+      u2 = adx;
+    }
+    else if(adx > dy)
+    {
+      // X-major line: pixel x belongs to line on which rounded y of line is.
+      // Run starts after middle between this and previous line and ends
+      // before middle between this and next line.
+      u1 = (t == 0) ? 0 : (((2 * t - 1) * adx + 2 * dy - 1) / (2 * dy));
+      u2 = (t == dy) ? adx : (((2 * t + 1) * adx + 2 * dy - 1) / (2 * dy) - 1);
+    }
+    else
+    {
+      // Y-major line: one pixel on line, x rounded
+      u1 = (2 * t * adx + dy) / (2 * dy);
+      u2 = u1;
+    }
+    // Convert distances to buffer positions
+    if(dx >= 0) FillSpan(buf, n, x1 + u1 - start_x, x1 + u2 - start_x, color);
+    else        FillSpan(buf, n, x1 - u2 - start_x, x1 - u1 - start_x, color);
+  }
 }
 
 // *****************************************************************************
-// ***   Put line in buffer   **************************************************
+// ***   Draw anti-aliased line part   *****************************************
 // *****************************************************************************
-void Line::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+void LineRaster::DrawAa(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                        int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color)
 {
-  // Draw only if needed
-  if((line >= y_start) && (line <= y_end))
+  // Coordinates in 16.16 fixed point format, alpha is distance of pixel
+  // center to line converted to 0..ALPHA_MAX range.
+  int32_t dx = x2 - x1;
+  int32_t dy = y2 - y1;
+  if(abs(dx) > abs(dy))
   {
-    const int32_t deltaX = abs(x_end - x_start);
-    const int32_t deltaY = abs(y_end - y_start);
-    const int32_t signX = x_start < x_end ? 1 : -1;
-    const int32_t signY = y_start < y_end ? 1 : -1;
-
-    int32_t error = deltaX - deltaY;
-    
-    int32_t x = x_start - start_x;
-    int32_t y = y_start;
-
-    int32_t end_x = x_end - start_x;
-    while((x != end_x || y != y_end) && (y != line))
+    // X-major line drawn from left to right, two pixels in each column
+    if(dx < 0)
     {
-      const int32_t error2 = error * 2;
-      if(error2 > -deltaY) 
-      {
-        error -= deltaY;
-        x += signX;
-      }
-      if(error2 < deltaX) 
+      int32_t tmp = x1; x1 = x2; x2 = tmp;
+      tmp = y1; y1 = y2; y2 = tmp;
+      dx = -dx;
+      dy = -dy;
+    }
+    // Y increment for each x
+    const int32_t g = (dy << 16) / dx;
+    // Columns where line closer than one pixel to the scanline
+    int32_t start = x1;
+    int32_t end = x2;
+    if(dy != 0)
+    {
+      const int32_t r = dx / abs(dy) + 1;
+      const int32_t xc = x1 + (line - y1) * dx / dy;
+      if(start < xc - r) start = xc - r;
+      if(end > xc + r) end = xc + r;
+    }
+    // Prevent buffer overflow
+    if(start < start_x) start = start_x;
+    if(end >= start_x + n) end = start_x + n - 1;
+    // Y of line in first column
+    int32_t yf = (y1 << 16) + (start - x1) * g - (line << 16);
+    for(int32_t x = start; x <= end; x++, yf += g)
+    {
+      const int32_t d = abs(yf);
+      if(d < 0x10000)
       {
-        error += deltaX;
-        y += signY;
+        buf[x - start_x] = Blitter::Blend(color, buf[x - start_x], (0x10000 - d) >> 11);
       }
     }
-
-    while((x != end_x || y != y_end) && (y == line))
+  }
+  else
+  {
+    // Y-major line drawn from top to bottom, two pixels on each line
+    if(dy < 0)
+    {
+      int32_t tmp = x1; x1 = x2; x2 = tmp;
+      tmp = y1; y1 = y2; y2 = tmp;
+      dx = -dx;
+      dy = -dy;
+    }
+    if((line >= y1) && (line <= y2))
     {
-      if((x >= 0) && (x < n)) buf[x] = color;
-      const int32_t error2 = error * 2;
-      if(error2 > -deltaY) 
+      // X increment for each y
+      const int32_t g = (dy == 0) ? 0 : ((dx << 16) / dy);
+      // X of line on this line
+      const int32_t xf = (x1 << 16) + (line - y1) * g;
+      const int32_t x = (xf >> 16) - start_x;
+      const uint32_t frac = xf & 0xFFFF;
+      if((x >= 0) && (x < n))
       {
-        error -= deltaY;
-        x += signX;
+        buf[x] = Blitter::Blend(color, buf[x], (0x10000 - frac) >> 11);
       }
-      if(error2 < deltaX) 
+      if((x + 1 >= 0) && (x + 1 < n))
       {
-        break;
+        buf[x + 1] = Blitter::Blend(color, buf[x + 1], frac >> 11);
       }
     }
   }
 }
 
+// *****************************************************************************
+// ***   Draw thick line part   ************************************************
+// *****************************************************************************
+void LineRaster::DrawThick(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                           int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                           uint32_t w, uint16_t color)
+{
+  // Half width vector along line
+  const float hw = (float)w * 0.5f;
+  const float dx = (float)(x2 - x1);
+  const float dy = (float)(y2 - y1);
+  const float len = sqrtf(dx * dx + dy * dy);
+  float ux = hw;
+  float uy = 0.0f;
+  if(len > 0.0f)
+  {
+    ux = dx * hw / len;
+    uy = dy * hw / len;
+  }
+  // Corners of line rectangle with square caps
+  const float cx[4] = {x1 - ux - uy, x2 + ux - uy, x2 + ux + uy, x1 - ux + uy};
+  const float cy[4] = {y1 - uy + ux, y2 + uy + ux, y2 + uy - ux, y1 - uy - ux};
+  // Find edges crossing the scanline
+  const float y = (float)line;
+  float xmin = 0.0f;
+  float xmax = 0.0f;
+  bool found = false;
+  for(uint32_t i = 0U; i < 4U; i++)
+  {
+    const uint32_t j = (i + 1U) & 3U;
+    // Edge includes top end point only, so shared corners counted once
+    if((cy[i] <= y) != (cy[j] <= y))
+    {
+      const float x = cx[i] + (y - cy[i]) * (cx[j] - cx[i]) / (cy[j] - cy[i]);
+      if(!found || (x < xmin)) xmin = x;
+      if(!found || (x > xmax)) xmax = x;
+      found = true;
+    }
+  }
+  // Pixels with centers inside rectangle
+  if(found)
+  {
+    FillSpan(buf, n, (int32_t)ceilf(xmin) - start_x, (int32_t)ceilf(xmax) - 1 - start_x, color);
+  }
+}
+
+// *****************************************************************************
+// ***   Fill span   ***********************************************************
+// *****************************************************************************
+void LineRaster::FillSpan(uint16_t* buf, int32_t n, int32_t start, int32_t end, uint16_t color)
+{
+  // Prevent write in memory before buffer
+  if(start < 0) start = 0;
+  // Prevent buffer overflow
+  if(end >= n) end = n - 1;
+  if(start <= end) Blitter::FillLine(&buf[start], end - start + 1, color);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// ***   Line   ****************************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+Line::Line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c, uint32_t w, bool aa)
+{
+  SetParams(x1, y1, x2, y2, c, w, aa);
+}
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void Line::SetParams(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c, uint32_t w, bool aa)
+{
+  // Old area should be redrawn
+  Invalidate();
+  color = c;
+  line_width = (w == 0U) ? 1U : w;
+  anti_alias = aa;
+  // Object area is bounding box of line pixels
+  const int32_t margin = LineRaster::GetMargin(line_width, anti_alias);
+  x_start = ((x1 < x2) ? x1 : x2) - margin;
+  y_start = ((y1 < y2) ? y1 : y2) - margin;
+  x_end = ((x1 < x2) ? x2 : x1) + margin;
+  y_end = ((y1 < y2) ? y2 : y1) + margin;
+  width  = x_end - x_start;
+  height = y_end - y_start;
+  rotation = 0;
+  // End points relative to object area, so Move() works without recalculation
+  x1_ofs = x1 - x_start;
+  y1_ofs = y1 - y_start;
+  x2_ofs = x2 - x_start;
+  y2_ofs = y2 - y_start;
+  // New area should be redrawn
+  Invalidate();
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void Line::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    LineRaster::Draw(buf, n, line, start_x, x_start + x1_ofs, y_start + y1_ofs,
+                     x_start + x2_ofs, y_start + y2_ofs, line_width, anti_alias, color);
+  }
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
@@ -208,96 +411,74 @@ void Line::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
 
 // *****************************************************************************
 // *****************************************************************************
-// ***   Circle   **************************************************************
+// ***   Polyline   ************************************************************
 // *****************************************************************************
 // *****************************************************************************
 
 // *****************************************************************************
 // ***   Constructor   *********************************************************
 // *****************************************************************************
-Circle::Circle(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill)
+Polyline::Polyline(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c, uint32_t w, bool aa)
 {
-  SetParams(x, y, r, c, is_fill);
+  SetParams(x, y, pts, cnt, c, w, aa);
 }
 
 // *****************************************************************************
 // ***   SetParams   ***********************************************************
 // *****************************************************************************
-void Circle::SetParams(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill)
+void Polyline::SetParams(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c, uint32_t w, bool aa)
 {
+  // Old area should be redrawn
+  Invalidate();
   color = c;
-  radius = r;
-  x_start = x - r;
-  y_start = y - r;
-  x_end = x + r;
-  y_end = y + r;
-  width = r*2;
-  height = r*2;
+  line_width = (w == 0U) ? 1U : w;
+  anti_alias = aa;
+  points = pts;
+  points_cnt = (pts == nullptr) ? 0U : cnt;
+  margin = LineRaster::GetMargin(line_width, anti_alias);
+  // Find bounding box of points
+  int32_t min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+  for(uint32_t i = 0U; i < points_cnt; i++)
+  {
+    if((i == 0U) || (points[i].x < min_x)) min_x = points[i].x;
+    if((i == 0U) || (points[i].y < min_y)) min_y = points[i].y;
+    if((i == 0U) || (points[i].x > max_x)) max_x = points[i].x;
+    if((i == 0U) || (points[i].y > max_y)) max_y = points[i].y;
+  }
+  x_start = x + min_x - margin;
+  y_start = y + min_y - margin;
+  x_end = x + max_x + margin;
+  y_end = y + max_y + margin;
+  width  = x_end - x_start;
+  height = y_end - y_start;
   rotation = 0;
-  fill = is_fill;
+  // Position of polyline relative to object area, so Move() works
+  org_x = x - x_start;
+  org_y = y - y_start;
+  // New area should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
-void Circle::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+void Polyline::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
 {
   // Draw only if needed
   if((line >= y_start) && (line <= y_end))
   {
-    int32_t x = 0;
-    int32_t y = radius;
-    int32_t x0 = x_start + radius - start_x;
-    int32_t y0 = y_start + radius;
-    int32_t delta = 1 - 2 * radius;
-    int32_t error = 0;
-    bool line_drawed = false;
-    
-    while(y >= 0) 
+    const int32_t x = x_start + org_x;
+    const int32_t y = y_start + org_y;
+    // Segments joined by overlapped caps
+    for(uint32_t i = 1U; i < points_cnt; i++)
     {
-      if( (y0 + y == line) || (y0 - y == line) )
-      {
-        if(fill)
-        {
-          int32_t i = x0 - x;
-          if(i < 0) i = 0;
-          if(x0 + x < n) n = x0 + x;
-          for(;i < n; i++)
-          {
-            buf[i] = color;
-          }
-          break;
-        }
-        else
-        {
-          int32_t xl = x0 - x;
-          int32_t xr = x0 + x;
-          if((xl > 0) && (xl < n)) buf[xl] = color;
-          if((xr > 0) && (xr < n)) buf[xr] = color;
-        }
-        line_drawed = true;
-      }
-      else
-      {
-        if(line_drawed == true) break;
-      }
-      error = 2 * (delta + y) - 1;
-      if(delta < 0 && error <= 0)
-      {
-        ++x;
-        delta += 2 * x + 1;
-        continue;
-      }
-      error = 2 * (delta - x) - 1;
-      if(delta > 0 && error > 0)
-      {
-        --y;
-        delta += 1 - 2 * y;
-        continue;
-      }
-      ++x;
-      delta += 2 * (x - y);
-      --y;
+      const int32_t y1 = y + points[i - 1U].y;
+      const int32_t y2 = y + points[i].y;
+      // Skip segments which don't cross the line
+      if(((y1 < y2) ? y1 : y2) - margin > line) continue;
+      if(((y1 < y2) ? y2 : y1) + margin < line) continue;
+      LineRaster::Draw(buf, n, line, start_x, x + points[i - 1U].x, y1,
+                       x + points[i].x, y2, line_width, anti_alias, color);
     }
   }
 }
@@ -305,22 +486,210 @@ void Circle::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
-void Circle::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+void Polyline::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
 {
+  // FIX ME: implement for Vertical Update Mode too
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// ***   RoundShape   **********************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RoundShape::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    DrawSpans(buf, n, line, start_x, x_start, x_end, y_start, y_end, radius_x, radius_y);
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void RoundShape::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Draw only if needed
   if((row >= x_start) && (row <= x_end))
   {
-    // Find start x position
-    int32_t start = y_start - start_y;
-    // Prevent write in memory before buffer
-    if(start < 0) start = 0;
-    // Find start x position
-    int32_t end = y_end - start_y;
-    // Prevent buffer overflow
-    if(end > n) end = n;
-    // Have sense draw only if end pointer in buffer
-    if(end > 0)
+    DrawSpans(buf, n, row, start_y, y_start, y_end, x_start, x_end, radius_y, radius_x);
+  }
+}
+
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool RoundShape::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  bool result = false;
+  int32_t start = 0;
+  int32_t end = 0;
+  // Only filled shape is opaque
+  if(fill && IsSpanInside(line, x1, x2) &&
+     GetSpan(line, x_start, x_end, y_start, y_end, radius_x, radius_y, start, end))
+  {
+    result = (x1 >= start) && (x2 <= end);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Set shape parameters   ************************************************
+// *****************************************************************************
+void RoundShape::SetShape(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rx, int32_t ry,
+                          int32_t c, bool is_fill, int32_t t)
+{
+  // Old area should be redrawn
+  Invalidate();
+  color = c;
+  x_start = x;
+  y_start = y;
+  x_end = x + w - 1;
+  y_end = y + h - 1;
+  width = w;
+  height = h;
+  rotation = 0;
+  // Corners can't be bigger than shape
+  if(rx > (w - 1) / 2) rx = (w - 1) / 2;
+  if(ry > (h - 1) / 2) ry = (h - 1) / 2;
+  radius_x = (rx < 0) ? 0 : rx;
+  radius_y = (ry < 0) ? 0 : ry;
+  thickness = (t < 1) ? 1 : ((t > UINT8_MAX) ? UINT8_MAX : t);
+  fill = is_fill;
+  // New area should be redrawn
+  Invalidate();
+}
+
+// *****************************************************************************
+// ***   Get span of shape on line   *******************************************
+// *****************************************************************************
+bool RoundShape::GetSpan(int32_t pos, int32_t a_start, int32_t a_end, int32_t b_start, int32_t b_end,
+                         int32_t ra, int32_t rb, int32_t& start, int32_t& end)
+{
+  bool result = false;
+  // Distance from line to straight part of shape
+  const int32_t b1 = b_start + rb;
+  const int32_t b2 = b_end - rb;
+  const int32_t d = (pos < b1) ? (b1 - pos) : ((pos > b2) ? (pos - b2) : 0);
+  // Pixel belongs to ellipse if (x / (ra + 0.5))^2 + (d / (rb + 0.5))^2 <= 1,
+  // multiplied by 4 * (2 * ra + 1)^2 * (2 * rb + 1)^2 for integer calculation
+  const int32_t bb = (2 * rb + 1) * (2 * rb + 1);
+  const int32_t c = bb - 4 * d * d;
+  if((b_start <= b_end) && (c >= 0))
+  {
+    // Max x is integer square root of m. For circle m is r^2 + r - d^2.
+    int32_t m;
+    if(ra == rb) m = c / 4;
+    else         m = (int32_t)(((int64_t)(2 * ra + 1) * (2 * ra + 1) * c) / (4 * bb));
+    int32_t x = (int32_t)sqrtf((float)m);
+    // Fix rounding of float square root
+    while(x * x > m) x--;
+    while((x + 1) * (x + 1) <= m) x++;
+    // Span is straight part of shape expanded by half width of ellipse
+    start = a_start + ra - x;
+    end = a_end - ra + x;
+    result = (start <= end);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Draw shape on line   **************************************************
+// *****************************************************************************
+void RoundShape::DrawSpans(uint16_t* buf, int32_t n, int32_t pos, int32_t start, int32_t a_start, int32_t a_end,
+                           int32_t b_start, int32_t b_end, int32_t ra, int32_t rb)
+{
+  int32_t s = 0;
+  int32_t e = 0;
+  if(GetSpan(pos, a_start, a_end, b_start, b_end, ra, rb, s, e))
+  {
+    // Inner shape for outline: if radius less than thickness corner of inner
+    // shape is square
+    int32_t is = 0;
+    int32_t ie = 0;
+    const int32_t t = thickness;
+    if(!fill && GetSpan(pos, a_start + t, a_end - t, b_start + t, b_end - t,
+                        (ra > t) ? (ra - t) : 0, (rb > t) ? (rb - t) : 0, is, ie))
+    {
+      // Left and right parts of outline
+      LineRaster::FillSpan(buf, n, s - start, is - 1 - start, color);
+      LineRaster::FillSpan(buf, n, ie + 1 - start, e - start, color);
+    }
+    else
     {
-      for(int32_t i = start; i < end; i++) buf[i] = color;
+      // Solid line
+      LineRaster::FillSpan(buf, n, s - start, e - start, color);
     }
   }
 }
+
+// *****************************************************************************
+// *****************************************************************************
+// ***   Ellipse   *************************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+Ellipse::Ellipse(int32_t x, int32_t y, int32_t rx, int32_t ry, int32_t c, bool is_fill, int32_t t)
+{
+  SetParams(x, y, rx, ry, c, is_fill, t);
+}
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void Ellipse::SetParams(int32_t x, int32_t y, int32_t rx, int32_t ry, int32_t c, bool is_fill, int32_t t)
+{
+  SetShape(x - rx, y - ry, rx * 2 + 1, ry * 2 + 1, rx, ry, c, is_fill, t);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// ***   Circle   **************************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+Circle::Circle(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill, int32_t t)
+{
+  SetParams(x, y, r, c, is_fill, t);
+}
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void Circle::SetParams(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill, int32_t t)
+{
+  SetShape(x - r, y - r, r * 2 + 1, r * 2 + 1, r, r, c, is_fill, t);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// ***   RoundRect   ***********************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+RoundRect::RoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, int32_t c, bool is_fill, int32_t t)
+{
+  SetParams(x, y, w, h, r, c, is_fill, t);
+}
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void RoundRect::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, int32_t c, bool is_fill, int32_t t)
+{
+  SetShape(x, y, w, h, r, r, c, is_fill, t);
+}
@@ -2,7 +2,7 @@
 //  @file Primitives.h
 //  @author Nicolai Shlapunov
 //
-//  @details DevCore: Primitives Visual Object Classes(Box, Line, Circle), header
+//  @details DevCore: Primitives Visual Object Classes(Box, Line, Polyline, Circle, Ellipse, RoundRect), header
 //
 //  @section LICENSE
 //
@@ -43,6 +43,16 @@
 // *****************************************************************************
 #include "DevCfg.h"
 #include "VisObject.h"
+#include "Blitters.h"
+
+// *****************************************************************************
+// ***   Point structure   *****************************************************
+// *****************************************************************************
+typedef struct
+{
+  int16_t x;
+  int16_t y;
+} Point;
 
 // *****************************************************************************
 // ***   Box Class   ***********************************************************
@@ -74,6 +84,11 @@ class Box : public VisObject
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
     
   private:
     // Box color
@@ -82,9 +97,65 @@ class Box : public VisObject
     bool fill = false;
 };
 
+// *****************************************************************************
+// ***   Line Raster Class   ***************************************************
+// *****************************************************************************
+// * Functions for draw part of line which crosses scanline. Span of line on
+// * scanline calculated directly from end points, so each scanline costs only
+// * its span width. Used by Line, Polyline and other primitives.
+class LineRaster
+{
+  public:
+    // *************************************************************************
+    // ***   Draw line part on scanline   **************************************
+    // *************************************************************************
+    // * Line drawn w pixels wide with square caps. Anti-aliasing used only for
+    // * 1 pixel wide lines.
+    static void Draw(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                     int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                     uint32_t w, bool aa, uint16_t color);
+
+    // *************************************************************************
+    // ***   Get margin of line pixels around end points   *********************
+    // *************************************************************************
+    static inline int32_t GetMargin(uint32_t w, bool aa)
+    {
+      // Caps and sides of thick line are w/2 from end points, corners are up to
+      // w/2 * sqrt(2). Anti-aliased line touches neighbour pixels.
+      return (w > 1U) ? ((w * 3U + 3U) / 4U) : (aa ? 1 : 0);
+    }
+
+    // *************************************************************************
+    // ***   Fill span   *******************************************************
+    // *************************************************************************
+    // * Fill pixels from start to end clipped by buffer of n pixels.
+    static void FillSpan(uint16_t* buf, int32_t n, int32_t start, int32_t end, uint16_t color);
+
+  private:
+    // *************************************************************************
+    // ***   Draw 1 pixel wide line part   *************************************
+    // *************************************************************************
+    static void DrawThin(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                         int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color);
+
+    // *************************************************************************
+    // ***   Draw anti-aliased line part   *************************************
+    // *************************************************************************
+    static void DrawAa(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                       int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color);
+
+    // *************************************************************************
+    // ***   Draw thick line part   ********************************************
+    // *************************************************************************
+    static void DrawThick(uint16_t* buf, int32_t n, int32_t line, int32_t start_x,
+                          int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                          uint32_t w, uint16_t color);
+};
+
 // *****************************************************************************
 // ***   Line Class   **********************************************************
 // *****************************************************************************
+// * Object area is bounding box of line, end points stored relative to it.
 class Line : public VisObject
 {
   public:
@@ -96,12 +167,14 @@ class Line : public VisObject
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
-    Line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c);
+    Line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c, uint32_t w = 1U, bool aa = false);
 
     // *************************************************************************
     // ***   SetParams   *******************************************************
     // *************************************************************************
-    void SetParams(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c);
+    // * Line drawn w pixels wide. If aa set, 1 pixel wide line is anti-aliased
+    // * and blended with objects below it.
+    void SetParams(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t c, uint32_t w = 1U, bool aa = false);
 
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
@@ -114,30 +187,38 @@ class Line : public VisObject
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
     
   private:
+    // End points relative to start of object area
+    int16_t x1_ofs = 0, y1_ofs = 0, x2_ofs = 0, y2_ofs = 0;
     // Line color
     uint16_t color = 0U;
+    // Line width
+    uint8_t line_width = 1U;
+    // Anti-aliased line
+    bool anti_alias = false;
 };
 
 // *****************************************************************************
-// ***   Circle Class   ********************************************************
+// ***   Polyline Class   ******************************************************
 // *****************************************************************************
-class Circle : public VisObject
+// * Points are relative to polyline position and must exist while polyline
+// * exists. SetParams() must be called after points change.
+class Polyline : public VisObject
 {
   public:
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
-    Circle() {};
+    Polyline() {};
 
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
-    Circle(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill = false);
+    Polyline(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c, uint32_t w = 1U, bool aa = false);
 
     // *************************************************************************
-    // ***   SetParams   **************************************II***************
+    // ***   SetParams   *******************************************************
     // *************************************************************************
-    void SetParams(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill = false);
+    void SetParams(int32_t x, int32_t y, const Point* pts, uint32_t cnt, int32_t c, uint32_t w = 1U, bool aa = false);
 
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
@@ -150,12 +231,146 @@ class Circle : public VisObject
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
   private:
-    // Circle color
+    // Points of polyline
+    const Point* points = nullptr;
+    // Count of points
+    uint32_t points_cnt = 0U;
+    // Position of polyline relative to start of object area
+    int16_t org_x = 0, org_y = 0;
+    // Margin of line pixels around points
+    int16_t margin = 0;
+    // Line color
     uint16_t color = 0U;
-    // Circle radius
-    int16_t radius = 0;
-    // Is box fill ?
+    // Line width
+    uint8_t line_width = 1U;
+    // Anti-aliased line
+    bool anti_alias = false;
+};
+
+// *****************************************************************************
+// ***   Round Shape Class   ***************************************************
+// *****************************************************************************
+// * Base class for shapes with elliptic corners: object area with corners cut
+// * by ellipse quarters with radii rx and ry. Span of each line calculated
+// * directly from distance to straight part of shape, so line costs only its
+// * width. Outline is difference between shape and the same shape reduced by
+// * thickness.
+class RoundShape : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
+
+  protected:
+    // *************************************************************************
+    // ***   Set shape parameters   ********************************************
+    // *************************************************************************
+    // * Radii limited by half of width and height.
+    void SetShape(int32_t x, int32_t y, int32_t w, int32_t h, int32_t rx, int32_t ry,
+                  int32_t c, bool is_fill, int32_t t);
+
+  private:
+    // *************************************************************************
+    // ***   Get span of shape on line   ***************************************
+    // *************************************************************************
+    // * Line at position pos crosses shape from b_start to b_end. Shape from
+    // * a_start to a_end along line, ra and rb are radii along and across line.
+    // * Returns false if line doesn't cross shape.
+    static bool GetSpan(int32_t pos, int32_t a_start, int32_t a_end, int32_t b_start, int32_t b_end,
+                        int32_t ra, int32_t rb, int32_t& start, int32_t& end);
+
+    // *************************************************************************
+    // ***   Draw shape on line   **********************************************
+    // *************************************************************************
+    void DrawSpans(uint16_t* buf, int32_t n, int32_t pos, int32_t start, int32_t a_start, int32_t a_end,
+                   int32_t b_start, int32_t b_end, int32_t ra, int32_t rb);
+
+    // Radii of corners
+    int16_t radius_x = 0, radius_y = 0;
+    // Shape color
+    uint16_t color = 0U;
+    // Outline thickness
+    uint8_t thickness = 1U;
+    // Is shape fill ?
     bool fill = false;
 };
 
+// *****************************************************************************
+// ***   Ellipse Class   *******************************************************
+// *****************************************************************************
+class Ellipse : public RoundShape
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Ellipse() {};
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Ellipse(int32_t x, int32_t y, int32_t rx, int32_t ry, int32_t c, bool is_fill = false, int32_t t = 1);
+
+    // *************************************************************************
+    // ***   SetParams   *******************************************************
+    // *************************************************************************
+    void SetParams(int32_t x, int32_t y, int32_t rx, int32_t ry, int32_t c, bool is_fill = false, int32_t t = 1);
+};
+
+// *****************************************************************************
+// ***   Circle Class   ********************************************************
+// *****************************************************************************
+class Circle : public RoundShape
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Circle() {};
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    Circle(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill = false, int32_t t = 1);
+
+    // *************************************************************************
+    // ***   SetParams   **************************************II***************
+    // *************************************************************************
+    void SetParams(int32_t x, int32_t y, int32_t r, int32_t c, bool is_fill = false, int32_t t = 1);
+};
+
+// *****************************************************************************
+// ***   Rounded Rectangle Class   *********************************************
+// *****************************************************************************
+class RoundRect : public RoundShape
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    RoundRect() {};
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    RoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, int32_t c, bool is_fill = false, int32_t t = 1);
+
+    // *************************************************************************
+    // ***   SetParams   *******************************************************
+    // *************************************************************************
+    void SetParams(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, int32_t c, bool is_fill = false, int32_t t = 1);
+};
+
 #endif
@@ -0,0 +1,280 @@
+//******************************************************************************
+//  @file PropFont.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Proportional Anti-Aliased Font Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "PropFont.h"
+#include "AssetDrv.h"
+#include "LzDecoder.h"
+#include "Blitters.h"
+
+#include <cstring> // for memcmp() and memcpy()
+
+// *****************************************************************************
+// ***   Static variables   ****************************************************
+// *****************************************************************************
+PropFont::CacheSlot PropFont::cache[FONT_CACHE_GLYPHS];
+uint8_t PropFont::cache_data[FONT_CACHE_GLYPHS][FONT_CACHE_GLYPH_SIZE] __attribute__((aligned(4)));
+uint32_t PropFont::cache_tick = 0U;
+
+// *****************************************************************************
+// ***   Init font from flash   ************************************************
+// *****************************************************************************
+Result PropFont::Init(const uint8_t* data)
+{
+  Result result = Result::ERR_NULL_PTR;
+  if(data != nullptr)
+  {
+    const Header& hdr = *(const Header*)data;
+    result = SetFont(hdr, data + sizeof(Header), data, 0U);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Load font from SD card   **********************************************
+// *****************************************************************************
+Result PropFont::Load(const char* name, void* buf, uint32_t size)
+{
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  AssetDrv::AssetInfo info;
+  Header hdr;
+  uint32_t tables_size = 0U;
+
+  // Find font and read header
+  Result result = asset_drv.Find(name, info);
+  if(result.IsGood())
+  {
+    result = Result::ERR_FILE_FORMAT;
+    if(info.size > sizeof(hdr)) result = asset_drv.Read(info.offset, &hdr, sizeof(hdr));
+  }
+  // Check buffer size
+  if(result.IsGood())
+  {
+    tables_size = hdr.glyphs_cnt * sizeof(Glyph) + hdr.kerning_cnt * sizeof(KerningPair);
+    if((buf == nullptr) || (tables_size > size) || (((uintptr_t)buf & 3U) != 0U))
+    {
+      result = Result::ERR_BAD_PARAMETER;
+    }
+  }
+  // Read tables
+  if(result.IsGood())
+  {
+    result = asset_drv.Read(info.offset + sizeof(hdr), buf, tables_size);
+  }
+  // Set font parameters
+  if(result.IsGood())
+  {
+    result = SetFont(hdr, (const uint8_t*)buf, nullptr, info.offset);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get glyph index   *****************************************************
+// *****************************************************************************
+int32_t PropFont::GetGlyphIndex(uint32_t code)
+{
+  int32_t result = default_glyph;
+  // Binary search in glyphs sorted by code
+  int32_t lo = 0;
+  int32_t hi = glyphs_cnt - 1;
+  while(lo <= hi)
+  {
+    const int32_t mid = (lo + hi) / 2;
+    if(glyphs[mid].code < code)      lo = mid + 1;
+    else if(glyphs[mid].code > code) hi = mid - 1;
+    else
+    {
+      result = mid;
+      break;
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get kerning   *********************************************************
+// *****************************************************************************
+int32_t PropFont::GetKerning(uint32_t left, uint32_t right)
+{
+  int32_t result = 0;
+  // Binary search in pairs sorted by left and right glyphs
+  const uint32_t key = (left << 16) | right;
+  int32_t lo = 0;
+  int32_t hi = kerning_cnt - 1;
+  while(lo <= hi)
+  {
+    const int32_t mid = (lo + hi) / 2;
+    const uint32_t pair = ((uint32_t)kerning[mid].left << 16) | kerning[mid].right;
+    if(pair < key)      lo = mid + 1;
+    else if(pair > key) hi = mid - 1;
+    else
+    {
+      result = kerning[mid].adjust;
+      break;
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get glyph bitmap   ****************************************************
+// *****************************************************************************
+const uint8_t* PropFont::GetGlyphData(uint32_t idx, int32_t line, int32_t x1, int32_t x2)
+{
+  const uint8_t* data = nullptr;
+  const Glyph& g = glyphs[idx];
+  const uint32_t size = ((g.width * bits + 7U) / 8U) * g.height;
+
+  // Uncompressed glyphs in flash used directly
+  if((font_data != nullptr) && !compressed)
+  {
+    data = font_data + g.offset;
+  }
+  else if((size <= FONT_CACHE_GLYPH_SIZE) && ((font_data != nullptr) || (g.size <= ASSET_CACHE_ROW_SIZE)))
+  {
+    // Find glyph in any slot and least recently used slot. Each glyph
+    // requested for each line of string, so glyphs of string should stay in
+    // cache until all of them drawn.
+    uint32_t victim = 0U;
+    cache_tick++;
+    for(uint32_t i = 0U; i < FONT_CACHE_GLYPHS; i++)
+    {
+      if((cache[i].font == this) && (cache[i].glyph == idx))
+      {
+        cache[i].last_use = cache_tick;
+        data = cache_data[i];
+        break;
+      }
+      if(cache[i].last_use < cache[victim].last_use) victim = i;
+    }
+    // Decode glyph to cache
+    if(data == nullptr)
+    {
+      const uint8_t* src = nullptr;
+      if(font_data != nullptr)
+      {
+        src = font_data + g.offset;
+      }
+      else
+      {
+        src = AssetDrv::GetInstance().GetRow(file_offset + g.offset, g.size, line, x1, x2);
+      }
+      if(src != nullptr)
+      {
+        if(compressed) src = LzDecoder::DecodeRow(src, size);
+        memcpy(cache_data[victim], src, size);
+        cache[victim].font = this;
+        cache[victim].glyph = idx;
+        cache[victim].last_use = cache_tick;
+        data = cache_data[victim];
+      }
+    }
+  }
+  else
+  {
+    // Glyph is too big for glyph cache or for AssetDrv cache row
+  }
+
+  return data;
+}
+
+// *****************************************************************************
+// ***   Decode UTF-8 character   **********************************************
+// *****************************************************************************
+uint32_t PropFont::DecodeUtf8(const uint8_t*& str)
+{
+  uint32_t code = *str++;
+  if(code >= 0x80U)
+  {
+    // Count of continuation bytes
+    uint32_t cnt = (code >= 0xF0U) ? 3U : ((code >= 0xE0U) ? 2U : ((code >= 0xC0U) ? 1U : 0U));
+    if(cnt == 0U)
+    {
+      // Continuation byte without first byte
+      code = 0xFFFDU;
+    }
+    else
+    {
+      code &= 0x3FU >> cnt;
+      for(; cnt > 0U; cnt--)
+      {
+        // Byte which isn't continuation byte isn't skipped
+        if((*str & 0xC0U) != 0x80U)
+        {
+          code = 0xFFFDU;
+          break;
+        }
+        code = (code << 6) | (*str++ & 0x3FU);
+      }
+    }
+  }
+  return code;
+}
+
+// *****************************************************************************
+// ***   Private: Set font parameters   ****************************************
+// *****************************************************************************
+Result PropFont::SetFont(const Header& hdr, const uint8_t* tables, const uint8_t* data, uint32_t offset)
+{
+  Result result = Result::ERR_FILE_FORMAT;
+  if(IsValid(hdr))
+  {
+    // Glyphs of previous font shouldn't be found in cache
+    for(uint32_t i = 0U; i < FONT_CACHE_GLYPHS; i++)
+    {
+      if(cache[i].font == this)
+      {
+        cache[i].font = nullptr;
+        cache[i].last_use = 0U;
+      }
+    }
+    font_data = data;
+    file_offset = offset;
+    glyphs = (const Glyph*)tables;
+    kerning = (const KerningPair*)(tables + hdr.glyphs_cnt * sizeof(Glyph));
+    glyphs_cnt = hdr.glyphs_cnt;
+    kerning_cnt = hdr.kerning_cnt;
+    height = hdr.height;
+    baseline = hdr.baseline;
+    bits = hdr.bits_per_pixel & ~FONT_LZ;
+    compressed = (hdr.bits_per_pixel & FONT_LZ) != 0U;
+    // Alpha for each coverage value
+    const uint32_t max = (1U << bits) - 1U;
+    for(uint32_t i = 0U; i <= max; i++)
+    {
+      alpha_table[i] = (i * Blitter::ALPHA_MAX + max / 2U) / max;
+    }
+    default_glyph = -1;
+    default_glyph = GetGlyphIndex('?');
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Check header   ***********************************************
+// *****************************************************************************
+bool PropFont::IsValid(const Header& hdr)
+{
+  const uint8_t bpp = hdr.bits_per_pixel & ~FONT_LZ;
+  return (memcmp(hdr.signature, "DBFN", sizeof(hdr.signature)) == 0) &&
+         ((bpp == 1U) || (bpp == 2U) || (bpp == 4U));
+}
@@ -0,0 +1,242 @@
+//******************************************************************************
+//  @file PropFont.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Proportional Anti-Aliased Font Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef PropFont_h
+#define PropFont_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// *****************************************************************************
+// ***   Proportional Font Class   *********************************************
+// *****************************************************************************
+// * Font created by Tools/FontConverter.py. It starts from Header followed by
+// * table of glyphs sorted by code, table of kerning pairs sorted by glyphs
+// * and glyph bitmaps. Bitmap contains rows of 1, 2 or 4-bit pixel coverage
+// * stored from the most significant bits of byte, each row starts from new
+// * byte. Bitmaps can be LZ compressed, each glyph separately. All values are
+// * little endian.
+// * Font can be in flash or in pack file on SD card. Compressed glyphs and
+// * glyphs from SD card decoded to glyph cache in RAM shared by all fonts.
+class PropFont
+{
+  public:
+    // Glyph bitmaps are LZ compressed(flag in bits_per_pixel field)
+    static const uint8_t FONT_LZ = 0x20U;
+
+    // *************************************************************************
+    // ***   Font header   *****************************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Signature "DBFN"
+      char signature[4];
+      // Bits per pixel and flags
+      uint8_t bits_per_pixel;
+      // Height of line
+      uint8_t height;
+      // Distance from top of line to baseline
+      uint8_t baseline;
+      // Reserved
+      uint8_t reserved;
+      // Count of glyphs and kerning pairs
+      uint16_t glyphs_cnt;
+      uint16_t kerning_cnt;
+    } Header;
+
+    // *************************************************************************
+    // ***   Glyph description   ***********************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Unicode code point
+      uint32_t code;
+      // Offset of bitmap from start of font and size of stored bitmap
+      uint32_t offset;
+      uint16_t size;
+      // Size of bitmap
+      uint8_t width;
+      uint8_t height;
+      // Position of bitmap relative to pen position and top of line
+      int8_t x_ofs;
+      int8_t y_ofs;
+      // Pen advance
+      uint8_t advance;
+      // Reserved
+      uint8_t reserved;
+    } Glyph;
+
+    // *************************************************************************
+    // ***   Kerning pair   ****************************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Indexes of left and right glyphs
+      uint16_t left;
+      uint16_t right;
+      // Pen adjustment
+      int16_t adjust;
+    } KerningPair;
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    PropFont() {};
+
+    // *************************************************************************
+    // ***   Init font from flash   ********************************************
+    // *************************************************************************
+    // * Data must be 32-bit aligned.
+    Result Init(const uint8_t* data);
+
+    // *************************************************************************
+    // ***   Load font from SD card   ******************************************
+    // *************************************************************************
+    // * Read glyphs and kerning tables from pack file opened by AssetDrv to
+    // * buffer. Buffer must be 32-bit aligned and exist while font used.
+    // * Bitmaps stay in file and read to glyph cache when needed.
+    Result Load(const char* name, void* buf, uint32_t size);
+
+    // *************************************************************************
+    // ***   Get glyph index   *************************************************
+    // *************************************************************************
+    // * Returns index of glyph for code, index of '?' glyph if font hasn't
+    // * glyph for code or -1 if font hasn't both.
+    int32_t GetGlyphIndex(uint32_t code);
+
+    // *************************************************************************
+    // ***   Get glyph   *******************************************************
+    // *************************************************************************
+    inline const Glyph& GetGlyph(uint32_t idx) {return glyphs[idx];}
+
+    // *************************************************************************
+    // ***   Get kerning   *****************************************************
+    // *************************************************************************
+    int32_t GetKerning(uint32_t left, uint32_t right);
+
+    // *************************************************************************
+    // ***   Get glyph bitmap   ************************************************
+    // *************************************************************************
+    // * Returns pointer to glyph bitmap or nullptr if bitmap isn't read from
+    // * SD card yet. In this case area x1..x2 of line will be redrawn when
+    // * bitmap is read. Glyph from SD card must fit in ASSET_CACHE_ROW_SIZE.
+    // * Must be called only from display driver task.
+    const uint8_t* GetGlyphData(uint32_t idx, int32_t line, int32_t x1, int32_t x2);
+
+    // *************************************************************************
+    // ***   Get alpha for pixel coverage   ************************************
+    // *************************************************************************
+    inline uint32_t GetAlpha(uint32_t coverage) {return alpha_table[coverage];}
+
+    // *************************************************************************
+    // ***   Get parameters   **************************************************
+    // *************************************************************************
+    inline uint32_t GetHeight(void) {return height;}
+    inline uint32_t GetBaseline(void) {return baseline;}
+    inline uint32_t GetBitsPerPixel(void) {return bits;}
+
+    // *************************************************************************
+    // ***   Decode UTF-8 character   ******************************************
+    // *************************************************************************
+    // * Returns code point and moves pointer to next character. Invalid
+    // * sequence returns U+FFFD.
+    static uint32_t DecodeUtf8(const uint8_t*& str);
+
+  private:
+    // *************************************************************************
+    // ***   Glyph cache slot   ************************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Font and index of glyph in slot
+      const PropFont* font;
+      uint16_t glyph;
+      // Last use of slot for find least recently used slot
+      uint32_t last_use;
+    } CacheSlot;
+
+    // *************************************************************************
+    // ***   Private: Set font parameters   ************************************
+    // *************************************************************************
+    Result SetFont(const Header& hdr, const uint8_t* tables, const uint8_t* data, uint32_t offset);
+
+    // *************************************************************************
+    // ***   Private: Check header   *******************************************
+    // *************************************************************************
+    static bool IsValid(const Header& hdr);
+
+    // Font data in flash or nullptr for font on SD card
+    const uint8_t* font_data = nullptr;
+    // Offset of font in pack file
+    uint32_t file_offset = 0U;
+    // Tables of glyphs and kerning pairs
+    const Glyph* glyphs = nullptr;
+    const KerningPair* kerning = nullptr;
+    uint16_t glyphs_cnt = 0U;
+    uint16_t kerning_cnt = 0U;
+    // Glyph used for missing characters
+    int16_t default_glyph = -1;
+    // Height of line and distance from top of line to baseline
+    uint8_t height = 0U;
+    uint8_t baseline = 0U;
+    // Bits per pixel without flags
+    uint8_t bits = 0U;
+    // Glyph bitmaps are LZ compressed
+    bool compressed = false;
+    // Alpha for each pixel coverage
+    uint8_t alpha_table[16];
+
+    // Glyph cache. Glyph can be in any slot, least recently used slot
+    // replaced.
+    static CacheSlot cache[FONT_CACHE_GLYPHS];
+    static uint8_t cache_data[FONT_CACHE_GLYPHS][FONT_CACHE_GLYPH_SIZE];
+    static uint32_t cache_tick;
+};
+
+#endif
@@ -0,0 +1,200 @@
+//******************************************************************************
+//  @file PropString.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Proportional String Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "PropString.h"
+#include "Blitters.h"
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+PropString::PropString(const char* str, int32_t x, int32_t y, uint32_t tc, PropFont& fnt)
+{
+  SetParams(str, x, y, tc, fnt);
+}
+
+// *****************************************************************************
+// ***   SetParams   ***********************************************************
+// *****************************************************************************
+void PropString::SetParams(const char* str, int32_t x, int32_t y, uint32_t tc, PropFont& fnt)
+{
+  // Old area should be redrawn
+  Invalidate();
+  string = (const uint8_t*)str;
+  // Drop string set by SetString() and not applied yet
+  new_string = nullptr;
+  taken_string = nullptr;
+  font = &fnt;
+  txt_color = tc;
+  rotation = 0;
+  Layout(x, y);
+  // New area should be redrawn
+  Invalidate();
+}
+
+// *****************************************************************************
+// ***   SetColor   ************************************************************
+// *****************************************************************************
+void PropString::SetColor(uint32_t tc)
+{
+  txt_color = tc;
+  // String area should be redrawn
+  Invalidate();
+}
+
+// *****************************************************************************
+// ***   SetString   ***********************************************************
+// *****************************************************************************
+void PropString::SetString(const char* str)
+{
+  // Characters used by DisplayDrv during frame drawing, so new string will
+  // be applied before next frame
+  Rtos::EnterCriticalSection();
+  new_string = (const uint8_t*)str;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void PropString::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take new string if it set
+  if(new_string != nullptr)
+  {
+    taken_string = new_string;
+    new_string = nullptr;
+  }
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void PropString::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply new string if it set
+  if(taken_string != nullptr)
+  {
+    // Old area should be redrawn
+    Invalidate();
+    string = taken_string;
+    taken_string = nullptr;
+    Layout(x_start + org_x, y_start);
+    // New area should be redrawn
+    Invalidate();
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void PropString::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // FIX ME: implement for Vertical Update Mode too
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void PropString::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end) && (font != nullptr))
+  {
+    const int32_t row = line - y_start;
+    const int32_t pen_x = x_start + org_x;
+    const int32_t end_x = start_x + n;
+    const uint32_t bits = font->GetBitsPerPixel();
+    const uint32_t mask = (1U << bits) - 1U;
+    for(uint32_t i = 0U; i < chars_cnt; i++)
+    {
+      const PropFont::Glyph& g = font->GetGlyph(chars[i].glyph);
+      const int32_t gx = pen_x + chars[i].x + g.x_ofs;
+      const int32_t gy = row - g.y_ofs;
+      // Skip glyphs which doesn't cross the span
+      if((gy < 0) || (gy >= g.height) || (gx + g.width <= start_x) || (gx >= end_x)) continue;
+      // Visible part of glyph row
+      const int32_t px1 = (gx < start_x) ? (start_x - gx) : 0;
+      const int32_t px2 = (gx + g.width > end_x) ? (end_x - gx) : g.width;
+      // Glyph from SD card can be not read yet, it will be redrawn later
+      const uint8_t* data = font->GetGlyphData(chars[i].glyph, line, gx + px1, gx + px2 - 1);
+      if(data == nullptr) continue;
+      const uint8_t* src = data + gy * ((g.width * bits + 7U) / 8U);
+      uint16_t* dst = buf + gx - start_x;
+      for(int32_t px = px1; px < px2; px++)
+      {
+        const uint32_t bit = px * bits;
+        const uint32_t coverage = (src[bit >> 3] >> (8U - bits - (bit & 7U))) & mask;
+        if(coverage != 0U)
+        {
+          const uint32_t alpha = font->GetAlpha(coverage);
+          dst[px] = (alpha == Blitter::ALPHA_MAX) ? txt_color : Blitter::Blend(txt_color, dst[px], alpha);
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Layout string   **********************************************
+// *****************************************************************************
+void PropString::Layout(int32_t x, int32_t y)
+{
+  int32_t pen = 0;
+  int32_t prev = -1;
+  // Pixels of glyphs can be out of pen advance
+  int32_t left = 0;
+  int32_t right = 0;
+  chars_cnt = 0U;
+  if((string != nullptr) && (font != nullptr))
+  {
+    const uint8_t* p = string;
+    while((*p != 0U) && (chars_cnt < PROP_STRING_MAX_CHARS))
+    {
+      const int32_t idx = font->GetGlyphIndex(PropFont::DecodeUtf8(p));
+      if(idx >= 0)
+      {
+        if(prev >= 0) pen += font->GetKerning(prev, idx);
+        const PropFont::Glyph& g = font->GetGlyph(idx);
+        chars[chars_cnt].glyph = idx;
+        chars[chars_cnt].x = pen;
+        chars_cnt++;
+        if((g.width != 0U) && (pen + g.x_ofs < left))             left = pen + g.x_ofs;
+        if((g.width != 0U) && (pen + g.x_ofs + g.width > right)) right = pen + g.x_ofs + g.width;
+        pen += g.advance;
+        prev = idx;
+      }
+    }
+    if(pen > right) right = pen;
+  }
+  org_x = -left;
+  width = right - left;
+  height = (font != nullptr) ? font->GetHeight() : 0;
+  x_start = x + left;
+  y_start = y;
+  x_end = x_start + width - 1;
+  y_end = y_start + height - 1;
+}
@@ -0,0 +1,158 @@
+//******************************************************************************
+//  @file PropString.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Proportional String Visual Object Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef PropString_h
+#define PropString_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "VisObject.h"
+#include "PropFont.h"
+
+// *****************************************************************************
+// ***   Proportional String Class   *******************************************
+// *****************************************************************************
+// * UTF-8 string drawn by PropFont with transparent background. Anti-aliased
+// * glyphs blended with objects below. Position of each character calculated
+// * when string set, so string can't be longer than PROP_STRING_MAX_CHARS.
+class PropString : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    PropString() {};
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    PropString(const char* str, int32_t x, int32_t y, uint32_t tc, PropFont& fnt);
+
+    // *************************************************************************
+    // ***   SetParams   *******************************************************
+    // *************************************************************************
+    void SetParams(const char* str, int32_t x, int32_t y, uint32_t tc, PropFont& fnt);
+
+    // *************************************************************************
+    // ***   SetString   *******************************************************
+    // *************************************************************************
+    // * New string will be shown from next frame. Caller must keep string
+    // * buffer until it replaced. If string buffer changed directly, SetString()
+    // * must be called again for update position of characters.
+    void SetString(const char* str);
+
+    // *************************************************************************
+    // ***   SetColor   ********************************************************
+    // *************************************************************************
+    void SetColor(uint32_t tc);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x = 0);
+
+    // *************************************************************************
+    // ***   GetLength   *******************************************************
+    // *************************************************************************
+    // * Count of characters in string.
+    inline uint32_t GetLength(void) {return chars_cnt;}
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+  private:
+    // *************************************************************************
+    // ***   Character position   **********************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Index of glyph in font
+      uint16_t glyph;
+      // Pen position relative to string start
+      int16_t x;
+    } CharPos;
+
+    // *************************************************************************
+    // ***   Private: Layout string   ******************************************
+    // *************************************************************************
+    // * Decodes string, finds glyphs, calculates position of characters and
+    // * area of string.
+    void Layout(int32_t x, int32_t y);
+
+    // Pointer to string
+    const uint8_t* string = nullptr;
+    // Pointer to string set by SetString() and not applied yet
+    const uint8_t* volatile new_string = nullptr;
+    // Pointer to string taken by TakePending() and not applied yet
+    const uint8_t* taken_string = nullptr;
+    // Font
+    PropFont* font = nullptr;
+    // Characters of string
+    CharPos chars[PROP_STRING_MAX_CHARS];
+    uint16_t chars_cnt = 0U;
+    // Offset of pen start from object start(glyph can be left of pen)
+    int16_t org_x = 0;
+    // Text color
+    uint16_t txt_color = 0U;
+};
+
+#endif
@@ -0,0 +1,508 @@
+//******************************************************************************
+//  @file SpriteBatch.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Sprite Batch Visual Object Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "SpriteBatch.h"
+#include "DisplayDrv.h" // for InvalidateArea()
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+SpriteBatch::SpriteBatch(int32_t x, int32_t y, int32_t w, int32_t h, Sprite* sprites_array, uint32_t size)
+{
+  x_start = x;
+  y_start = y;
+  x_end = x + w - 1;
+  y_end = y + h - 1;
+  width = w;
+  height = h;
+  sprites = sprites_array;
+  // Indexes are 16-bit and NONE is reserved
+  sprites_size = (size < NONE) ? size : (NONE - 1U);
+  // All records are free
+  for(uint32_t i = 0U; i < sprites_size; i++)
+  {
+    sprites[i].flags = 0U;
+    sprites[i].ynext = (i + 1U < sprites_size) ? (i + 1U) : NONE;
+  }
+  free_head = (sprites_size != 0U) ? 0U : NONE;
+}
+
+// *****************************************************************************
+// ***   Add sprite   **********************************************************
+// *****************************************************************************
+int32_t SpriteBatch::AddSprite(const ImageDesc& img_dsc, int32_t x, int32_t y, uint8_t z, bool flip)
+{
+  int32_t id = -1;
+  Rtos::EnterCriticalSection();
+  // Take first free record
+  if(free_head != NONE)
+  {
+    id = free_head;
+    Sprite& s = sprites[id];
+    free_head = s.ynext;
+    s.new_x = x;
+    s.new_y = y;
+    s.new_img = &img_dsc;
+    s.z = z;
+    s.flags = FLAG_USED | (flip ? FLAG_NEW_FLIP : 0U);
+    SetChanged(id);
+    sprites_cnt++;
+  }
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+  return id;
+}
+
+// *****************************************************************************
+// ***   Delete sprite   *******************************************************
+// *****************************************************************************
+void SpriteBatch::DelSprite(int32_t id)
+{
+  Rtos::EnterCriticalSection();
+  if(IsValid(id) && (sprites[id].new_img != nullptr))
+  {
+    // Record will be freed when changes applied
+    sprites[id].new_img = nullptr;
+    SetChanged(id);
+    sprites_cnt--;
+  }
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Move sprite   *********************************************************
+// *****************************************************************************
+void SpriteBatch::MoveSprite(int32_t id, int32_t x, int32_t y, bool is_delta)
+{
+  Rtos::EnterCriticalSection();
+  if(IsValid(id))
+  {
+    Sprite& s = sprites[id];
+    s.new_x = is_delta ? (s.new_x + x) : x;
+    s.new_y = is_delta ? (s.new_y + y) : y;
+    SetChanged(id);
+  }
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Set image of sprite   *************************************************
+// *****************************************************************************
+void SpriteBatch::SetSpriteImage(int32_t id, const ImageDesc& img_dsc)
+{
+  Rtos::EnterCriticalSection();
+  if(IsValid(id) && (sprites[id].new_img != nullptr))
+  {
+    sprites[id].new_img = &img_dsc;
+    SetChanged(id);
+  }
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Set horizontal flip of sprite   ***************************************
+// *****************************************************************************
+void SpriteBatch::SetSpriteFlip(int32_t id, bool flip)
+{
+  Rtos::EnterCriticalSection();
+  if(IsValid(id))
+  {
+    Sprite& s = sprites[id];
+    s.flags = flip ? (s.flags | FLAG_NEW_FLIP) : (s.flags & ~FLAG_NEW_FLIP);
+    SetChanged(id);
+  }
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void SpriteBatch::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end))
+  {
+    // DisplayDrv draws areas line by line from top to bottom. New area starts
+    // from the top of Y list.
+    if((line <= last_line) || (start_x != last_start_x) || (n != last_n))
+    {
+      active_list = NONE;
+      y_cursor = y_head;
+      last_start_x = start_x;
+      last_n = n;
+    }
+    last_line = line;
+    // Part of batch area in buffer
+    int32_t x1 = (x_start > start_x) ? x_start : start_x;
+    int32_t x2 = (x_end < start_x + n - 1) ? x_end : (start_x + n - 1);
+    // Add sprites started on this line or above to the list of sprites on
+    // current line
+    while((y_cursor != NONE) && (sprites[y_cursor].y <= line))
+    {
+      Sprite& s = sprites[y_cursor];
+      // Skip sprites which ended above or outside of area
+      if((s.y + s.img->height > line) && (s.x <= x2) && (s.x + s.img->width > x1) && (s.blit != nullptr))
+      {
+        AddToActiveList(y_cursor);
+      }
+      y_cursor = s.ynext;
+    }
+    // Draw sprites on line
+    uint16_t idx = active_list;
+    uint16_t prev = NONE;
+    while(idx != NONE)
+    {
+      Sprite& s = sprites[idx];
+      uint16_t next = s.anext;
+      int32_t bottom = s.y + s.img->height - 1;
+      // Lines between areas can be skipped, so sprite can end above line
+      if(bottom >= line)
+      {
+        DrawSprite(s, buf, line, x1, x2, start_x);
+      }
+      // If sprite ends on this line - remove it from list
+      if(bottom <= line)
+      {
+        if(prev != NONE) sprites[prev].anext = next;
+        else             active_list = next;
+      }
+      else
+      {
+        prev = idx;
+      }
+      idx = next;
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void SpriteBatch::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // FIX ME: implement for Vertical Update Mode too
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void SpriteBatch::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take list of changed sprites. Values of sprites taken one by one when
+  // changes applied.
+  taken_head = pending_head;
+  pending_head = NONE;
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void SpriteBatch::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply changes of sprites
+  bool is_sort = false;
+  // Sprites shown first time. They sorted and added to Y list at the end.
+  uint16_t new_list = NONE;
+  uint16_t idx = taken_head;
+  taken_head = NONE;
+  while(idx != NONE)
+  {
+    Sprite& s = sprites[idx];
+    const bool was_shown = (s.flags & FLAG_SHOWN) != 0U;
+    // Old area should be redrawn
+    if(was_shown) InvalidateSprite(s);
+    // Take values set by tasks. Sprite changed after it will be added to
+    // list of changed sprites again.
+    Rtos::EnterCriticalSection();
+    const uint16_t next = s.pnext;
+    const ImageDesc* img = s.new_img;
+    const int16_t x = s.new_x;
+    const int16_t y = s.new_y;
+    s.flags &= ~FLAG_CHANGED;
+    if(img == nullptr)
+    {
+      // Remove deleted sprite from Y list
+      if(was_shown)
+      {
+        if(s.yprev != NONE) sprites[s.yprev].ynext = s.ynext;
+        else                y_head = s.ynext;
+        if(s.ynext != NONE) sprites[s.ynext].yprev = s.yprev;
+        else                y_tail = s.yprev;
+      }
+      // Free record
+      s.flags = 0U;
+      s.ynext = free_head;
+      free_head = idx;
+    }
+    else
+    {
+      s.flags = (s.flags & FLAG_NEW_FLIP) ? (s.flags | FLAG_FLIP) : (s.flags & ~FLAG_FLIP);
+      s.flags |= FLAG_SHOWN;
+    }
+    Rtos::ExitCriticalSection();
+    // Apply changes
+    if(img != nullptr)
+    {
+      if(was_shown && (s.y != y)) is_sort = true;
+      s.x = x;
+      s.y = y;
+      s.img = img;
+      // Select kernel for image format. Unsupported images aren't drawn.
+      if(img->bits_per_pixel & IMAGE_ALPHA)
+      {
+        s.blit = Blitter::GetAlphaBlitter(s.flags & FLAG_FLIP);
+      }
+      else
+      {
+        s.blit = Blitter::GetBlitter(img->bits_per_pixel, s.flags & FLAG_FLIP, img->transparent_color >= 0);
+      }
+      // New sprite will be added to Y list
+      if(was_shown == false)
+      {
+        s.ynext = new_list;
+        new_list = idx;
+      }
+      // New area should be redrawn
+      InvalidateSprite(s);
+    }
+    idx = next;
+  }
+  // Keep Y list sorted
+  if(is_sort) SortList();
+  if(new_list != NONE) MergeToList(SortByY(new_list));
+  // Lists changed - start from the top for next line
+  last_line = 0x7FFFFFFF;
+}
+
+// *****************************************************************************
+// ***   Private: Mark sprite changed   ****************************************
+// *****************************************************************************
+void SpriteBatch::SetChanged(uint16_t idx)
+{
+  // Must be called inside critical section. Sprite added to list of changed
+  // sprites only once.
+  Sprite& s = sprites[idx];
+  if((s.flags & FLAG_CHANGED) == 0U)
+  {
+    s.flags |= FLAG_CHANGED;
+    s.pnext = pending_head;
+    pending_head = idx;
+  }
+  changes_pending = true;
+}
+
+// *****************************************************************************
+// ***   Private: Invalidate sprite area   *************************************
+// *****************************************************************************
+void SpriteBatch::InvalidateSprite(const Sprite& s)
+{
+  // Only part of sprite inside batch is drawn
+  int32_t x1 = (s.x > x_start) ? s.x : x_start;
+  int32_t y1 = (s.y > y_start) ? s.y : y_start;
+  int32_t x2 = s.x + s.img->width - 1;
+  int32_t y2 = s.y + s.img->height - 1;
+  if(x2 > x_end) x2 = x_end;
+  if(y2 > y_end) y2 = y_end;
+  if((x1 <= x2) && (y1 <= y2) && IsShow())
+  {
+    DisplayDrv::GetInstance().InvalidateArea(x1, y1, x2, y2);
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Sort Y list   ************************************************
+// *****************************************************************************
+void SpriteBatch::SortList(void)
+{
+  // Sprites moves between frames are small, so insertion sort is fast here
+  uint16_t idx = (y_head != NONE) ? sprites[y_head].ynext : NONE;
+  while(idx != NONE)
+  {
+    Sprite& s = sprites[idx];
+    // Save next sprite before moving current one
+    uint16_t next = s.ynext;
+    // Find new position for sprite
+    uint16_t pos = s.yprev;
+    while((pos != NONE) && (sprites[pos].y > s.y)) pos = sprites[pos].yprev;
+    // Move sprite if position changed
+    if(pos != s.yprev)
+    {
+      // Remove sprite from list. It can't be first sprite in the list since
+      // previous sprite has greater Y.
+      sprites[s.yprev].ynext = s.ynext;
+      if(s.ynext != NONE) sprites[s.ynext].yprev = s.yprev;
+      else                y_tail = s.yprev;
+      // Insert sprite after found position
+      s.yprev = pos;
+      if(pos != NONE)
+      {
+        s.ynext = sprites[pos].ynext;
+        sprites[pos].ynext = idx;
+      }
+      else
+      {
+        s.ynext = y_head;
+        y_head = idx;
+      }
+      sprites[s.ynext].yprev = idx;
+    }
+    // Next sprite
+    idx = next;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Sort list of new sprites by Y   ******************************
+// *****************************************************************************
+uint16_t SpriteBatch::SortByY(uint16_t head)
+{
+  // Bottom-up merge sort: list in bin i has 2^i sprites. 16-bit indexes
+  // never fill all bins.
+  uint16_t bins[16];
+  for(uint32_t i = 0U; i < NumberOf(bins); i++) bins[i] = NONE;
+  while(head != NONE)
+  {
+    uint16_t list = head;
+    head = sprites[head].ynext;
+    sprites[list].ynext = NONE;
+    uint32_t i = 0U;
+    for(; (i < NumberOf(bins) - 1U) && (bins[i] != NONE); i++)
+    {
+      list = MergeByY(bins[i], list);
+      bins[i] = NONE;
+    }
+    bins[i] = MergeByY(bins[i], list);
+  }
+  // Merge all bins
+  uint16_t result = NONE;
+  for(uint32_t i = 0U; i < NumberOf(bins); i++)
+  {
+    result = MergeByY(bins[i], result);
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: Merge two lists sorted by Y   ********************************
+// *****************************************************************************
+uint16_t SpriteBatch::MergeByY(uint16_t a, uint16_t b)
+{
+  uint16_t head = NONE;
+  uint16_t tail = NONE;
+  while((a != NONE) || (b != NONE))
+  {
+    uint16_t idx;
+    if((b == NONE) || ((a != NONE) && (sprites[a].y <= sprites[b].y)))
+    {
+      idx = a;
+      a = sprites[a].ynext;
+    }
+    else
+    {
+      idx = b;
+      b = sprites[b].ynext;
+    }
+    if(tail != NONE) sprites[tail].ynext = idx;
+    else             head = idx;
+    tail = idx;
+  }
+  if(tail != NONE) sprites[tail].ynext = NONE;
+  return head;
+}
+
+// *****************************************************************************
+// ***   Private: Merge sorted list of new sprites to Y list   *****************
+// *****************************************************************************
+void SpriteBatch::MergeToList(uint16_t head)
+{
+  // Both lists sorted, so each list passed once
+  uint16_t pos = y_head;
+  while(head != NONE)
+  {
+    Sprite& s = sprites[head];
+    uint16_t next = s.ynext;
+    // Find first sprite with greater Y
+    while((pos != NONE) && (sprites[pos].y <= s.y)) pos = sprites[pos].ynext;
+    // Insert sprite before it
+    s.ynext = pos;
+    s.yprev = (pos != NONE) ? sprites[pos].yprev : y_tail;
+    if(s.yprev != NONE) sprites[s.yprev].ynext = head;
+    else                y_head = head;
+    if(pos != NONE) sprites[pos].yprev = head;
+    else            y_tail = head;
+    head = next;
+  }
+}
+
+// *****************************************************************************
+// ***   Private: Add sprite to list of sprites on current line   **************
+// *****************************************************************************
+void SpriteBatch::AddToActiveList(uint16_t idx)
+{
+  // Find position in the list: list sorted by Z, sprites with the same Z
+  // sorted by index
+  uint16_t pos = active_list;
+  uint16_t prev = NONE;
+  while(   (pos != NONE)
+        && (   (sprites[pos].z < sprites[idx].z)
+            || ((sprites[pos].z == sprites[idx].z) && (pos < idx)) ) )
+  {
+    prev = pos;
+    pos = sprites[pos].anext;
+  }
+  // Insert sprite
+  sprites[idx].anext = pos;
+  if(prev != NONE) sprites[prev].anext = idx;
+  else             active_list = idx;
+}
+
+// *****************************************************************************
+// ***   Private: Draw sprite line   *******************************************
+// *****************************************************************************
+void SpriteBatch::DrawSprite(const Sprite& s, uint16_t* buf, int32_t line, int32_t x1, int32_t x2, int32_t start_x)
+{
+  const ImageDesc& img = *s.img;
+  int32_t s_end = s.x + img.width - 1;
+  // Sprite part inside batch area in buffer
+  int32_t start = ((s.x > x1) ? s.x : x1) - start_x;
+  int32_t end = ((s_end < x2) ? s_end : x2) - start_x;
+  if(start <= end)
+  {
+    // First pixel in buffer is counted from the right side of flipped sprite
+    int32_t idx = (s.flags & FLAG_FLIP) ? (s_end - start_x - start) : (start - (s.x - start_x));
+    // Lines of packed images start from byte boundary
+    uint32_t line_size = (img.width * (img.bits_per_pixel & ~IMAGE_ALPHA) + 7U) / 8U;
+    const uint8_t* p_line = img.img8 + (line - s.y) * line_size;
+    s.blit(&buf[start], p_line, idx, end - start + 1, img.palette, img.transparent_color);
+  }
+}
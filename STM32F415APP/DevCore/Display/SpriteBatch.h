@@ -0,0 +1,241 @@
+//******************************************************************************
+//  @file SpriteBatch.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Sprite Batch Visual Object Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef SpriteBatch_h
+#define SpriteBatch_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "VisObject.h"
+#include "Image.h"
+#include "Blitters.h"
+
+// *****************************************************************************
+// ***   Sprite Batch Class   **************************************************
+// *****************************************************************************
+// * One VisObject which draws many small sprites. Sprites aren't VisObjects:
+// * they are records in array provided by user, so DisplayDrv sees only one
+// * object and sprites cost neither list nodes nor virtual calls. Sprites kept
+// * in list sorted by Y and only sprites which cross the line are drawn.
+// * Sprites are drawn only inside batch area. Changes of sprites are applied
+// * before next frame like changes of VisObjects: only sprites from list of
+// * changed sprites are visited, free records kept in free list. Run-length
+// * encoded and LZ compressed images aren't supported.
+class SpriteBatch : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Sprite record   ***************************************************
+    // *************************************************************************
+    // * Fields used by SpriteBatch only, user should just allocate array.
+    typedef struct
+    {
+      // Position and image of sprite on screen
+      int16_t x, y;
+      const ImageDesc* img;
+      // Kernel for copy image line to buffer
+      Blitter::BlitFunction blit;
+      // Position and image set by task and not applied yet
+      int16_t new_x, new_y;
+      const ImageDesc* new_img;
+      // Z position in batch: sprites with bigger Z drawn over other sprites
+      uint8_t z;
+      // Sprite flags
+      uint8_t flags;
+      // Next and previous sprites in Y sorted list
+      uint16_t ynext, yprev;
+      // Next sprite in list of sprites on current line
+      uint16_t anext;
+      // Next sprite in list of changed sprites
+      uint16_t pnext;
+    } Sprite;
+
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    // * Sprites array must exist while batch exists.
+    SpriteBatch(int32_t x, int32_t y, int32_t w, int32_t h, Sprite* sprites_array, uint32_t size);
+
+    // *************************************************************************
+    // ***   Add sprite   ******************************************************
+    // *************************************************************************
+    // * Returns id of sprite or -1 if there are no free records. Image
+    // * description must exist while sprite uses it.
+    int32_t AddSprite(const ImageDesc& img_dsc, int32_t x, int32_t y, uint8_t z = 0U, bool flip = false);
+
+    // *************************************************************************
+    // ***   Delete sprite   ***************************************************
+    // *************************************************************************
+    void DelSprite(int32_t id);
+
+    // *************************************************************************
+    // ***   Move sprite   *****************************************************
+    // *************************************************************************
+    void MoveSprite(int32_t id, int32_t x, int32_t y, bool is_delta = false);
+
+    // *************************************************************************
+    // ***   Set image of sprite   *********************************************
+    // *************************************************************************
+    void SetSpriteImage(int32_t id, const ImageDesc& img_dsc);
+
+    // *************************************************************************
+    // ***   Set horizontal flip of sprite   ***********************************
+    // *************************************************************************
+    void SetSpriteFlip(int32_t id, bool flip);
+
+    // *************************************************************************
+    // ***   Get count of sprites   ********************************************
+    // *************************************************************************
+    inline uint32_t GetSpritesCnt(void) {return sprites_cnt;}
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+  private:
+    // Index of empty list
+    static const uint16_t NONE = 0xFFFFU;
+    // Sprite flags
+    static const uint8_t FLAG_USED     = 0x01U; // Record allocated by task
+    static const uint8_t FLAG_SHOWN    = 0x02U; // Sprite in Y sorted list
+    static const uint8_t FLAG_CHANGED  = 0x04U; // Sprite has changes
+    static const uint8_t FLAG_FLIP     = 0x08U; // Sprite flipped
+    static const uint8_t FLAG_NEW_FLIP = 0x10U; // Flip set by task
+
+    // *************************************************************************
+    // ***   Private: Check sprite id   ****************************************
+    // *************************************************************************
+    inline bool IsValid(int32_t id)
+    {
+      return (id >= 0) && ((uint32_t)id < sprites_size) && (sprites[id].flags & FLAG_USED);
+    }
+
+    // *************************************************************************
+    // ***   Private: Mark sprite changed   ************************************
+    // *************************************************************************
+    void SetChanged(uint16_t idx);
+
+    // *************************************************************************
+    // ***   Private: Invalidate sprite area   *********************************
+    // *************************************************************************
+    void InvalidateSprite(const Sprite& s);
+
+    // *************************************************************************
+    // ***   Private: Sort Y list   ********************************************
+    // *************************************************************************
+    void SortList(void);
+
+    // *************************************************************************
+    // ***   Private: Sort list of new sprites by Y   **************************
+    // *************************************************************************
+    // * List linked by ynext. Returns head of sorted list.
+    uint16_t SortByY(uint16_t head);
+
+    // *************************************************************************
+    // ***   Private: Merge two lists sorted by Y   ****************************
+    // *************************************************************************
+    uint16_t MergeByY(uint16_t a, uint16_t b);
+
+    // *************************************************************************
+    // ***   Private: Merge sorted list of new sprites to Y list   *************
+    // *************************************************************************
+    void MergeToList(uint16_t head);
+
+    // *************************************************************************
+    // ***   Private: Add sprite to list of sprites on current line   **********
+    // *************************************************************************
+    void AddToActiveList(uint16_t idx);
+
+    // *************************************************************************
+    // ***   Private: Draw sprite line   ***************************************
+    // *************************************************************************
+    void DrawSprite(const Sprite& s, uint16_t* buf, int32_t line, int32_t x1, int32_t x2, int32_t start_x);
+
+    // Array of sprites
+    Sprite* sprites;
+    // Size of array
+    uint32_t sprites_size;
+    // Count of used records
+    volatile uint32_t sprites_cnt = 0U;
+    // First free record. Free records linked by ynext.
+    uint16_t free_head = NONE;
+    // Sprites changed by tasks and sprites taken by TakePending()
+    uint16_t pending_head = NONE;
+    uint16_t taken_head = NONE;
+    // First and last sprites in Y sorted list
+    uint16_t y_head = NONE;
+    uint16_t y_tail = NONE;
+    // Next sprite in Y list which isn't added to list of sprites on line yet
+    uint16_t y_cursor = NONE;
+    // List of sprites on current line
+    uint16_t active_list = NONE;
+    // Parameters of last drawn line. Lists restarted when new area drawn.
+    int32_t last_line = 0x7FFFFFFF;
+    int32_t last_start_x = 0;
+    int32_t last_n = 0;
+};
+
+#endif
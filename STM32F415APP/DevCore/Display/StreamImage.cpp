@@ -0,0 +1,292 @@
+//******************************************************************************
+//  @file StreamImage.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Image streamed from SD card, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "StreamImage.h"
+
+// *****************************************************************************
+// ***   Constructor   *********************************************************
+// *****************************************************************************
+StreamImage::StreamImage(int32_t x, int32_t y)
+{
+  x_start = x;
+  y_start = y;
+  x_end = x - 1;
+  y_end = y - 1;
+}
+
+// *****************************************************************************
+// ***   Load image   **********************************************************
+// *****************************************************************************
+Result StreamImage::Load(const char* name)
+{
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  AssetDrv::AssetInfo info;
+  AssetDrv::ImageHeader hdr;
+  Blitter::BlitFunction new_blit = nullptr;
+  uint32_t new_line_size = 0U;
+  uint32_t new_offset = 0U;
+
+  // Find image and read header
+  Result result = asset_drv.Find(name, info);
+  if(result.IsGood())
+  {
+    result = Result::ERR_FILE_FORMAT;
+    if(info.size > sizeof(hdr)) result = asset_drv.Read(info.offset, &hdr, sizeof(hdr));
+  }
+  // Check image format
+  if(result.IsGood())
+  {
+    new_line_size = (hdr.width * (hdr.bits_per_pixel & ~(IMAGE_ALPHA | IMAGE_LZ)) + 7U) / 8U;
+    // Image lines follow palette
+    new_offset = info.offset + sizeof(hdr) + hdr.palette_size * sizeof(uint16_t);
+    if(hdr.bits_per_pixel & IMAGE_ALPHA)
+    {
+      new_blit = Blitter::GetAlphaBlitter(false);
+    }
+    else if((hdr.bits_per_pixel & IMAGE_RLE) == 0U)
+    {
+      new_blit = Blitter::GetBlitter(hdr.bits_per_pixel & ~IMAGE_LZ, false, hdr.transparent_color >= 0);
+    }
+    // Compressed rows decoded to LzDecoder buffer, other rows read to cache
+    uint32_t max_line_size = (hdr.bits_per_pixel & IMAGE_LZ) ? LzDecoder::MAX_ROW_SIZE : ASSET_CACHE_ROW_SIZE;
+    if((new_blit == nullptr) || (new_line_size > max_line_size) ||
+       (hdr.palette_size > MAX_PALETTE_SIZE))
+    {
+      result = Result::ERR_NOT_IMPLEMENTED;
+    }
+  }
+  // Check size of compressed rows
+  if(result.IsGood() && (hdr.bits_per_pixel & IMAGE_LZ))
+  {
+    result = CheckLzRows(new_offset, hdr.height);
+  }
+  // Palette buffer is used until previous loaded image applied
+  if(result.IsGood())
+  {
+    Rtos::EnterCriticalSection();
+    if((new_params.blit != nullptr) || (taken_params.blit != nullptr))
+    {
+      result = Result::ERR_BUSY;
+    }
+    Rtos::ExitCriticalSection();
+  }
+  // Read palette
+  if(result.IsGood() && (hdr.palette_size != 0U))
+  {
+    result = asset_drv.Read(info.offset + sizeof(hdr), new_palette, hdr.palette_size * sizeof(uint16_t));
+  }
+  // Set image parameters
+  if(result.IsGood())
+  {
+    Params params;
+    params.img_offset = new_offset;
+    params.line_size = new_line_size;
+    params.width = hdr.width;
+    params.height = hdr.height;
+    params.bits = hdr.bits_per_pixel & ~(IMAGE_ALPHA | IMAGE_LZ);
+    params.compressed = (hdr.bits_per_pixel & IMAGE_LZ) != 0U;
+    params.palette_size = hdr.palette_size;
+    params.transparent_color = hdr.transparent_color;
+    params.blit = new_blit;
+    // Image used by DisplayDrv during frame drawing, so new image will be
+    // applied before next frame
+    Rtos::EnterCriticalSection();
+    new_params = params;
+    changes_pending = true;
+    Rtos::ExitCriticalSection();
+    // Apply changes immediately if object isn't in DisplayDrv list
+    CommitChanges();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void StreamImage::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take new image if it loaded
+  if(new_params.blit != nullptr)
+  {
+    taken_params = new_params;
+    new_params.blit = nullptr;
+  }
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void StreamImage::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply new image if it loaded
+  if(taken_params.blit != nullptr)
+  {
+    // Old area should be redrawn
+    Invalidate();
+    img_offset = taken_params.img_offset;
+    line_size = taken_params.line_size;
+    bits = taken_params.bits;
+    compressed = taken_params.compressed;
+    transparent_color = taken_params.transparent_color;
+    blit = taken_params.blit;
+    memcpy(palette, new_palette, taken_params.palette_size * sizeof(uint16_t));
+    width = taken_params.width;
+    height = taken_params.height;
+    x_end = x_start + width - 1;
+    y_end = y_start + height - 1;
+    // Palette buffer can be used by next Load()
+    taken_params.blit = nullptr;
+    // New area should be redrawn
+    Invalidate();
+  }
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void StreamImage::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // Draw only if needed
+  if((line >= y_start) && (line <= y_end) && (blit != nullptr))
+  {
+    AssetDrv& asset_drv = AssetDrv::GetInstance();
+    // Find start x position
+    int32_t start = x_start - start_x;
+    // Prevent write in memory before buffer
+    if(start < 0) start = 0;
+    // Find start x position
+    int32_t end = x_end - start_x;
+    // Prevent buffer overflow
+    if(end >= n) end = n - 1;
+    // Have sense draw only if object in buffer
+    if(start <= end)
+    {
+      int32_t row = line - y_start;
+      // Index of first pixel in the image line
+      int32_t idx = start - (x_start - start_x);
+      if(compressed)
+      {
+        DrawLzRow(&buf[start], idx, end - start + 1, row, start + start_x, end + start_x);
+      }
+      else
+      {
+        // Get line from cache. If it isn't read yet, line will be redrawn later.
+        const uint8_t* p_line = asset_drv.GetRow(img_offset + row * line_size, line_size,
+                                                 line, start + start_x, end + start_x);
+        if(p_line != nullptr)
+        {
+          blit(&buf[start], p_line, idx, end - start + 1, palette, transparent_color);
+        }
+        // Read next lines in advance
+        for(uint32_t i = 1U; (i <= ASSET_PREFETCH_ROWS) && (line + (int32_t)i <= y_end); i++)
+        {
+          asset_drv.Prefetch(img_offset + (row + i) * line_size, line_size);
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Put row of LZ compressed image in buffer   ****************************
+// *****************************************************************************
+void StreamImage::DrawLzRow(uint16_t* buf, int32_t idx, int32_t n, int32_t row, int32_t x1, int32_t x2)
+{
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  int32_t line = row + y_start;
+  // First row of offsets table part and count of offsets in it
+  uint32_t first = row - row % LZ_TABLE_ROWS;
+  uint32_t cnt = ((height - first < LZ_TABLE_ROWS) ? (height - first) : LZ_TABLE_ROWS) + 1U;
+  // Get part of table from cache
+  const uint32_t* table = (const uint32_t*)asset_drv.GetRow(img_offset + first * sizeof(uint32_t),
+                                                            cnt * sizeof(uint32_t), line, x1, x2);
+  if(table != nullptr)
+  {
+    // Copy offsets of row and rows for prefetch: table can be replaced in cache
+    uint32_t offsets[ASSET_PREFETCH_ROWS + 2U];
+    uint32_t offsets_cnt = 0U;
+    for(uint32_t i = row - first; (i < cnt) && (offsets_cnt < NumberOf(offsets)); i++)
+    {
+      offsets[offsets_cnt++] = table[i];
+    }
+    // Get compressed row from cache. If it isn't read yet, line will be
+    // redrawn later.
+    const uint8_t* p_row = asset_drv.GetRow(img_offset + offsets[0U], offsets[1U] - offsets[0U], line, x1, x2);
+    if(p_row != nullptr)
+    {
+      // Decode row up to last pixel in buffer
+      const uint8_t* p_line = LzDecoder::DecodeRow(p_row, ((idx + n) * bits + 7U) / 8U);
+      blit(buf, p_line, idx, n, palette, transparent_color);
+    }
+    // Read next rows in advance
+    for(uint32_t i = 1U; i + 1U < offsets_cnt; i++)
+    {
+      asset_drv.Prefetch(img_offset + offsets[i], offsets[i + 1U] - offsets[i]);
+    }
+    // Read next part of table if next rows in it
+    if((offsets_cnt < NumberOf(offsets)) && (first + LZ_TABLE_ROWS < (uint32_t)height))
+    {
+      first += LZ_TABLE_ROWS;
+      cnt = ((height - first < LZ_TABLE_ROWS) ? (height - first) : LZ_TABLE_ROWS) + 1U;
+      asset_drv.Prefetch(img_offset + first * sizeof(uint32_t), cnt * sizeof(uint32_t));
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Check rows of LZ compressed image   ***********************************
+// *****************************************************************************
+Result StreamImage::CheckLzRows(uint32_t offset, uint32_t rows)
+{
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  Result result = Result::RESULT_OK;
+  // Offsets table read by parts, last offset of part is first offset of next
+  uint32_t table[LZ_TABLE_ROWS + 1U];
+  for(uint32_t first = 0U; (result.IsGood()) && (first < rows); first += LZ_TABLE_ROWS)
+  {
+    uint32_t cnt = ((rows - first < LZ_TABLE_ROWS) ? (rows - first) : LZ_TABLE_ROWS) + 1U;
+    result = asset_drv.Read(offset + first * sizeof(uint32_t), table, cnt * sizeof(uint32_t));
+    for(uint32_t i = 0U; (result.IsGood()) && (i + 1U < cnt); i++)
+    {
+      if(table[i + 1U] < table[i])
+      {
+        result = Result::ERR_FILE_FORMAT;
+      }
+      else if(table[i + 1U] - table[i] > ASSET_CACHE_ROW_SIZE)
+      {
+        result = Result::ERR_NOT_IMPLEMENTED;
+      }
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Put line in buffer   **************************************************
+// *****************************************************************************
+void StreamImage::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y)
+{
+  // Not supported: each column needs all image lines
+}
@@ -0,0 +1,165 @@
+//******************************************************************************
+//  @file StreamImage.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Image streamed from SD card, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef StreamImage_h
+#define StreamImage_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "VisObject.h"
+#include "Image.h"
+#include "Blitters.h"
+#include "AssetDrv.h"
+
+// *****************************************************************************
+// ***   Stream Image Class   **************************************************
+// *****************************************************************************
+// * Image which data stays in pack file on SD card. Only palette kept in RAM,
+// * lines read by AssetDrv to row cache when display driver needs them. Line
+// * which isn't in cache yet isn't drawn and redrawn when it is read. Display
+// * driver draws lines from top to bottom, so next lines read in advance.
+class StreamImage : public VisObject
+{
+  public:
+    // *************************************************************************
+    // ***   Constructor   *****************************************************
+    // *************************************************************************
+    StreamImage(int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Load image   ******************************************************
+    // *************************************************************************
+    // * Read image header and palette from pack file opened by AssetDrv. New
+    // * image will be shown from next frame. Returns ERR_BUSY if previous
+    // * loaded image isn't applied yet. Run-length encoded images and images
+    // * with lines bigger than ASSET_CACHE_ROW_SIZE aren't supported. Lines of
+    // * LZ compressed images are limited by LzDecoder::MAX_ROW_SIZE, but each
+    // * compressed line must fit in ASSET_CACHE_ROW_SIZE: images with bigger
+    // * compressed lines are rejected.
+    Result Load(const char* name);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t y = 0);
+
+    // *************************************************************************
+    // ***   Put line in buffer   **********************************************
+    // *************************************************************************
+    virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
+  private:
+    // Max count of colors in palette
+    static const uint32_t MAX_PALETTE_SIZE = 256U;
+    // Count of rows in one part of LZ offsets table read to cache
+    static const uint32_t LZ_TABLE_ROWS = 16U;
+
+    // Parameters of loaded image
+    typedef struct
+    {
+      uint32_t img_offset;
+      uint32_t line_size;
+      uint16_t width;
+      uint16_t height;
+      uint8_t bits;
+      bool compressed;
+      uint16_t palette_size;
+      int32_t transparent_color;
+      // Kernel for copy image line to buffer, nullptr - no image
+      Blitter::BlitFunction blit;
+    } Params;
+
+    // *************************************************************************
+    // ***   Put row of LZ compressed image in buffer   ************************
+    // *************************************************************************
+    // * Offsets table read to cache by parts, so rows can be found without
+    // * keeping whole table in RAM.
+    void DrawLzRow(uint16_t* buf, int32_t idx, int32_t n, int32_t row, int32_t x1, int32_t x2);
+
+    // *************************************************************************
+    // ***   Check rows of LZ compressed image   *******************************
+    // *************************************************************************
+    // * Row which doesn't fit in cache row can't be read, so it would never be
+    // * drawn.
+    Result CheckLzRows(uint32_t offset, uint32_t rows);
+
+    // Offset of first line in pack file
+    uint32_t img_offset = 0U;
+    // Size of line in bytes
+    uint32_t line_size = 0U;
+    // Bits per pixel without flags
+    uint8_t bits = 0U;
+    // Image is LZ compressed
+    bool compressed = false;
+    // Palette
+    uint16_t palette[MAX_PALETTE_SIZE];
+    // Transparent color (-1 no transparent colors)
+    int32_t transparent_color = -1;
+    // Kernel for copy image line to buffer
+    Blitter::BlitFunction blit = nullptr;
+    // Palette read by Load() and not applied yet
+    uint16_t new_palette[MAX_PALETTE_SIZE];
+    // Parameters set by Load() and not taken yet
+    Params new_params = {};
+    // Parameters taken by TakePending() and not applied yet
+    Params taken_params = {};
+};
+
+#endif
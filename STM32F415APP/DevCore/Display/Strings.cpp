@@ -23,6 +23,11 @@
 
 #include <cstring> // for strlen()
 
+// *****************************************************************************
+// ***   Two pixels for word writes to line buffer   ***************************
+// *****************************************************************************
+typedef uint32_t __attribute__((__may_alias__)) PixelPair;
+
 // *****************************************************************************
 // *****************************************************************************
 // ***   Strings   *************************************************************
@@ -36,6 +41,15 @@ const String::FontProfile String::fonts[FONTS_MAX] =
   { 8, 12, 12, (const uint8_t*)font8x12},
   {12, 16, 32, (const uint8_t*)font12x16} };
 
+// Must be in the same order as fonts
+const String::DrawFunction String::draw_functions[FONTS_MAX][2] =
+//  Transparent background                  Opaque background
+{ {&String::DrawText< 4,  6, 1, false>, &String::DrawText< 4,  6, 1, true>},
+  {&String::DrawText< 6,  8, 1, false>, &String::DrawText< 6,  8, 1, true>},
+  {&String::DrawText< 8,  8, 1, false>, &String::DrawText< 8,  8, 1, true>},
+  {&String::DrawText< 8, 12, 1, false>, &String::DrawText< 8, 12, 1, true>},
+  {&String::DrawText<12, 32, 2, false>, &String::DrawText<12, 32, 2, true>} };
+
 // *****************************************************************************
 // ***   Constructor   *********************************************************
 // *****************************************************************************
@@ -57,18 +71,26 @@ String::String(const char* str, int32_t x, int32_t y, uint32_t tc, uint32_t bgc,
 // *****************************************************************************
 void String::SetParams(const char* str, int32_t x, int32_t y, uint32_t tc, FontType ft)
 {
+  // Old area should be redrawn
+  Invalidate();
   string = (const uint8_t*)str;
+  // Drop string set by SetString() and not applied yet
+  new_string = nullptr;
+  taken_string = nullptr;
   x_start = x;
   y_start = y;
   txt_color = tc;
   bg_color = 0;
   font_type = ft;
   transpatent_bg = true;
-  width = fonts[ft].w * strlen(str);
+  str_len = strlen(str);
+  width = fonts[ft].w * str_len;
   height = fonts[ft].h;
   x_end = x + width - 1;
   y_end = y + height - 1;
   rotation = 0;
+  // New area should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -76,18 +98,26 @@ void String::SetParams(const char* str, int32_t x, int32_t y, uint32_t tc, FontT
 // *****************************************************************************
 void String::SetParams(const char* str, int32_t x, int32_t y, uint32_t tc, uint32_t bgc, FontType ft)
 {
+  // Old area should be redrawn
+  Invalidate();
   string = (const uint8_t*)str;
+  // Drop string set by SetString() and not applied yet
+  new_string = nullptr;
+  taken_string = nullptr;
   x_start = x;
   y_start = y;
   txt_color = tc;
   bg_color = bgc;
   font_type = ft;
   transpatent_bg = false;
-  width = fonts[ft].w * strlen(str);
+  str_len = strlen(str);
+  width = fonts[ft].w * str_len;
   height = fonts[ft].h;
   x_end = x + width - 1;
   y_end = y + height - 1;
   rotation = 0;
+  // New area should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -98,6 +128,8 @@ void String::SetColor(uint32_t tc, uint32_t bgc, bool is_trnsp)
   txt_color = tc;
   bg_color = bgc;
   transpatent_bg = is_trnsp;
+  // String area should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -105,14 +137,52 @@ void String::SetColor(uint32_t tc, uint32_t bgc, bool is_trnsp)
 // *****************************************************************************
 void String::SetString(const char* str)
 {
-  // Lock object for changes
-  LockVisObject();
-  //Set new pointer to string
-  string = (const uint8_t*)str;
-  width = fonts[font_type].w * strlen(str);
-  x_end = x_start + width - 1;
-  // Unlock object after changes
-  UnlockVisObject();
+  // String pointer used by DisplayDrv during frame drawing, so new pointer
+  // will be applied before next frame
+  Rtos::EnterCriticalSection();
+  new_string = (const uint8_t*)str;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void String::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take new string if it set
+  if(new_string != nullptr)
+  {
+    taken_string = new_string;
+    new_string = nullptr;
+  }
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void String::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply new string if it set
+  if(taken_string != nullptr)
+  {
+    // Old area should be redrawn
+    Invalidate();
+    // Set new pointer to string
+    string = taken_string;
+    taken_string = nullptr;
+    str_len = strlen((const char*)string);
+    width = fonts[font_type].w * str_len;
+    x_end = x_start + width - 1;
+    // New area should be redrawn
+    Invalidate();
+  }
 }
 
 // *****************************************************************************
@@ -123,51 +193,100 @@ void String::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
   // Draw only if needed
   if((line >= y_start) && (line <= y_end) && (string != nullptr))
   {
-    // Current symbol X position
-    int32_t x = x_start;
-    // Number of bytes need skipped for draw line
-    uint32_t skip_bytes = (line - y_start) * fonts[font_type].bytes_per_char / fonts[font_type].h;
-    // Pointer to string. Will increment for get characters.
-    const uint8_t* str = string;
-
-    // While we have symbols
-    while(*str != '\0')
+    // Call function for font and background
+    (this->*draw_functions[font_type][transpatent_bg ? 0 : 1])(buf, n, line, start_x);
+  }
+}
+
+// *****************************************************************************
+// ***   Draw line of text   ***************************************************
+// *****************************************************************************
+template<uint32_t W, uint32_t BPC, uint32_t BPR, bool OPAQUE>
+void String::DrawText(uint16_t* buf, int32_t n, int32_t line, int32_t start_x)
+{
+  // First and last visible pixels relative to start of string
+  int32_t px1 = start_x - x_start;
+  int32_t px2 = start_x + n - 1 - x_start;
+  if(px1 < 0) px1 = 0;
+  if(px2 > (int32_t)(W * str_len) - 1) px2 = W * str_len - 1;
+  // Draw only if string in buffer
+  if(px1 <= px2)
+  {
+    // Row of first character in font data
+    const uint8_t* data = fonts[font_type].font_data + (line - y_start) * BPR;
+    // First and last visible characters
+    uint32_t idx = (uint32_t)px1 / W;
+    const uint32_t last = (uint32_t)px2 / W;
+    // Pixels of first character outside buffer
+    uint32_t skip = px1 - idx * W;
+    // Pointer to first visible pixel in buffer
+    uint16_t* dst = buf + (x_start + px1 - start_x);
+    // Colors of two pixels for each combination of two bits
+    uint32_t pairs[4];
+    if(OPAQUE)
+    {
+      pairs[0] = bg_color  | ((uint32_t)bg_color  << 16);
+      pairs[1] = txt_color | ((uint32_t)bg_color  << 16);
+      pairs[2] = bg_color  | ((uint32_t)txt_color << 16);
+      pairs[3] = txt_color | ((uint32_t)txt_color << 16);
+    }
+    for(; idx <= last; idx++)
     {
-      uint32_t b = 0;
-      uint32_t w = 0;
-      // Get all symbol line
-      for(uint32_t i = 0; i < fonts[font_type].bytes_per_char; i++)
+      const uint8_t c = string[idx];
+      // String can be changed by user after length calculated
+      if(c == '\0') break;
+      // Row of character: bit 0 is left pixel
+      const uint8_t* p = data + c * BPC;
+      uint32_t b = (BPR == 1U) ? p[0] : (p[0] | ((uint32_t)p[1] << 8));
+      // Count of visible pixels of character
+      uint32_t cnt = ((idx == last) ? (px2 - idx * W + 1U) : W) - skip;
+      b >>= skip;
+      skip = 0U;
+      if(OPAQUE)
       {
-        b |= fonts[font_type].font_data[((uint32_t)(*str)) * fonts[font_type].bytes_per_char + skip_bytes + i] << (i*8);
+        uint16_t* d = dst;
+        uint32_t i = cnt;
+        // Align destination to word
+        if((i > 0U) && (((uintptr_t)d & 2U) != 0U))
+        {
+          *d++ = (b & 1U) ? txt_color : bg_color;
+          b >>= 1;
+          i--;
+        }
+        // Two pixels by each write
+        PixelPair* d32 = (PixelPair*)d;
+        for(; i >= 2U; i -= 2U)
+        {
+          *d32++ = pairs[b & 3U];
+          b >>= 2;
+        }
+        // Last pixel
+        if(i > 0U) *(uint16_t*)d32 = (b & 1U) ? txt_color : bg_color;
       }
-      // Output symbol line
-      while(w < fonts[font_type].w)
+      else
       {
-        // Put color in buffer only if visible
-        if((x >= start_x) && (x < start_x+n))
+        // Only pixels of character written
+        b &= (1U << cnt) - 1U;
+        while(b != 0U)
         {
-          if((b&1) == 1)
-          {
-            buf[x] = txt_color;
-          }
-          else if(transpatent_bg == false)
-          {
-            buf[x] = bg_color;
-          }
-          else
-          {
-            // Empty statement
-          }
+          dst[__builtin_ctz(b)] = txt_color;
+          b &= b - 1U;
         }
-        b >>= 1;
-        w++;
-        x++;
       }
-      str++;
+      dst += cnt;
     }
   }
 }
 
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool String::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // String is opaque only if it has background
+  return (transpatent_bg == false) && IsSpanInside(line, x1, x2);
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
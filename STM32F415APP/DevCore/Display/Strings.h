@@ -91,6 +91,8 @@ class String : public VisObject
     // *************************************************************************
     // ***   SetString   *******************************************************
     // *************************************************************************
+    // * New string will be shown from next frame. Caller must keep string
+    // * buffer until it replaced.
     void SetString(const char* str);
 
     // *************************************************************************
@@ -108,6 +110,11 @@ class String : public VisObject
     // *************************************************************************
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
 
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
+
     // *************************************************************************
     // ***   GetFontW   ********************************************************
     // *************************************************************************
@@ -118,10 +125,45 @@ class String : public VisObject
     // *************************************************************************
     static uint32_t GetFontH(FontType ft);
 
+    // *************************************************************************
+    // ***   GetLength   *******************************************************
+    // *************************************************************************
+    // * Length of string calculated when string set.
+    inline uint32_t GetLength(void) {return str_len;}
+
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
   private:
+    // *************************************************************************
+    // ***   Draw line of text   ***********************************************
+    // *************************************************************************
+    // * Specialized for each font and background type, so pixel loops have no
+    // * checks of font parameters. W is width of character, BPC is bytes per
+    // * character and BPR is bytes per row of character.
+    template<uint32_t W, uint32_t BPC, uint32_t BPR, bool OPAQUE>
+    void DrawText(uint16_t* buf, int32_t n, int32_t line, int32_t start_x);
+
+    // Type of function for draw line of text
+    typedef void (String::*DrawFunction)(uint16_t* buf, int32_t n, int32_t line, int32_t start_x);
+
     // Pointer to string
     // FIX ME: must be changed for prevent changing string during drawing
     const uint8_t* string = nullptr;
+    // Pointer to string set by SetString() and not applied yet
+    const uint8_t* volatile new_string = nullptr;
+    // Pointer to string taken by TakePending() and not applied yet
+    const uint8_t* taken_string = nullptr;
+    // Length of string
+    uint16_t str_len = 0U;
     // Text color
     uint16_t txt_color = 0;
     // Background color
@@ -141,6 +183,9 @@ class String : public VisObject
 
     // Fonts structures. One for all String classes.
     static const FontProfile fonts[FONTS_MAX];
+    // Functions for draw line of text for each font with transparent and
+    // opaque background
+    static const DrawFunction draw_functions[FONTS_MAX][2];
 };
 
 #endif
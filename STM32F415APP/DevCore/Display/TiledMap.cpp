@@ -19,13 +19,16 @@
 // ***   Includes   ************************************************************
 // *****************************************************************************
 #include "TiledMap.h"
+#include "DisplayDrv.h" // for ScrollScreen()
+#include "AssetDrv.h"
 
 // *****************************************************************************
 // ***   Constructor   *********************************************************
 // *****************************************************************************
 TiledMap::TiledMap(int32_t x, int32_t y, int32_t w, int32_t h,
                    uint8_t* map, uint32_t map_w, uint32_t map_h, uint8_t bitmask,
-                   const ImageDesc* tiles, uint32_t n, int32_t def_color)
+                   const ImageDesc* tiles, uint32_t n, int32_t def_color,
+                   TileRow* cache, uint32_t cache_size)
 {
   x_start = x;
   y_start = y;
@@ -42,6 +45,11 @@ TiledMap::TiledMap(int32_t x, int32_t y, int32_t w, int32_t h,
   tile_width = tiles->width;
   tile_height = tiles->height;
   bg_color = def_color;
+  // Use cache only if tile row fits in entry
+  if(tile_width <= TileRowCache::TILE_WIDTH)
+  {
+    tile_cache.Init(cache, cache_size);
+  }
 }
 
 // *****************************************************************************
@@ -52,32 +60,29 @@ void TiledMap::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_
   // Draw only if needed
   if((line >= y_start) && (line <= y_end))
   {
-    int32_t start_offset = 0;
     // Find start x position
     int32_t start = x_start - start_x;
     // Prevent write in memory before buffer
-    if(start < 0)
-    {
-      start_offset = -start;
-      start = 0;
-    }
+    if(start < 0) start = 0;
     // Find end x position
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
     if(end >= n) end = n - 1;
-    
+    // Map X position of first pixel in buffer
+    int32_t start_offset = x_pos + start + start_x - x_start;
+
     // Find start tile index and offsets
-    int32_t x_tile_idx = (x_pos + start_x + start_offset) / tile_width;
+    int32_t x_tile_idx = start_offset / tile_width;
     int32_t y_tile_idx = (y_pos + line - y_start) / tile_height;
     int32_t tile_idx = y_tile_idx * map_width + x_tile_idx;
-    int32_t x_tile_offset = (x_pos  + start_x + start_offset) % tile_width;
-    int32_t y_tile_offset = ((y_pos + line - y_start) % tile_height) * tile_width;
+    int32_t x_tile_offset = start_offset % tile_width;
+    int32_t y_tile_offset = (y_pos + line - y_start) % tile_height;
     
     // If default color is 0 or greater
     if(bg_color >= 0)
     {
       // Fill buffer by default color
-      for(int32_t i = start; i < end; i++)
+      for(int32_t i = start; i <= end; i++)
       {
         buf[i] = bg_color;
       }
@@ -85,34 +90,67 @@ void TiledMap::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_
     // Prepare variables for first cycle
     int32_t pix_idx = start;
     int32_t tile_pix_idx = x_tile_offset;
+    // Count of tiles in pack file or in flash
+    uint32_t n_tiles = (stream.blit != nullptr) ? stream.tiles_cnt : tiles_cnt;
     // Draw line with tiles
-    while(pix_idx < n)
+    while(pix_idx <= end)
     {
       // Get tile value
       uint8_t tile_val = tiles_map[tile_idx] & tile_bitmask;
       // Skip empty tiles
-      if(tile_val >= tiles_cnt)
+      if(tile_val >= n_tiles)
       {
         pix_idx += tile_width - tile_pix_idx;
         tile_idx++;
         tile_pix_idx = 0;
         continue;
       }
-      // Get pointer to the current tile image
-      const uint8_t* tile_ptr = &tiles_img[tile_val].img8[y_tile_offset];
-      // Get pointer to the current tile palette
-      const uint16_t* palette_ptr = tiles_img[tile_val].palette;
-      // Get transparent color
-      const int32_t transparent_color = tiles_img[tile_val].transparent_color;
-      // Draw tile
-      for(;(tile_pix_idx < (int32_t)tile_width) && (pix_idx <= end); tile_pix_idx++)
+      // Count of tile pixels in buffer
+      int32_t cnt = tile_width - tile_pix_idx;
+      if(cnt > end - pix_idx + 1) cnt = end - pix_idx + 1;
+      if(stream.blit != nullptr)
       {
-        // Get pixel data
-        uint16_t data = palette_ptr[tile_ptr[tile_pix_idx]];
-        // If not transparent - output to buffer
-        if(data != transparent_color) buf[pix_idx] = data;
-        pix_idx++; 
+        // Get whole tile from cache. If it isn't read yet, tile pixels of
+        // line will be redrawn later.
+        const uint8_t* tile_ptr = AssetDrv::GetInstance().GetRow(stream.offset + tile_val * stream.tile_size, stream.tile_size,
+                                                                 line, pix_idx + start_x, pix_idx + cnt - 1 + start_x);
+        if(tile_ptr != nullptr)
+        {
+          stream.blit(&buf[pix_idx], tile_ptr + y_tile_offset * stream.line_size, tile_pix_idx, cnt,
+                      stream_palette, stream.transparent_color);
+        }
       }
+      else if(tile_cache.IsEnabled())
+      {
+        // Get current tile image
+        const ImageDesc& tile = tiles_img[tile_val];
+        // Copy row expanded to RGB565 from cache
+        TileRow& tile_row = tile_cache.GetRow(tile, y_tile_offset);
+        if(tile_row.is_opaque)
+        {
+          memcpy(&buf[pix_idx], &tile_row.pixels[tile_pix_idx], cnt * sizeof(buf[0]));
+        }
+        else
+        {
+          Blitter::BlitFunction blit = Blitter::GetBlitter(16U, false, true);
+          blit(&buf[pix_idx], tile_row.pixels, tile_pix_idx, cnt, nullptr, tile.transparent_color);
+        }
+      }
+      else
+      {
+        // Get current tile image
+        const ImageDesc& tile = tiles_img[tile_val];
+        // Get pointer to the line of current tile image, lines of packed
+        // images start from byte boundary
+        const uint8_t* tile_ptr = tile.img8 + y_tile_offset * ((tile_width * tile.bits_per_pixel + 7U) / 8U);
+        // Draw tile by kernel for tile format
+        Blitter::BlitFunction blit = Blitter::GetBlitter(tile.bits_per_pixel, false, tile.transparent_color >= 0);
+        if(blit != nullptr)
+        {
+          blit(&buf[pix_idx], tile_ptr, tile_pix_idx, cnt, tile.palette, tile.transparent_color);
+        }
+      }
+      pix_idx += cnt;
       // Increase tile index
       tile_idx++;
       // Clear tile pixel counter
@@ -121,6 +159,15 @@ void TiledMap::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_
   }
 }
 
+// *****************************************************************************
+// ***   Check if line span covered by opaque pixels   *************************
+// *****************************************************************************
+bool TiledMap::IsOpaque(int32_t line, int32_t x1, int32_t x2)
+{
+  // Map is opaque only if it filled by background color
+  return (bg_color >= 0) && IsSpanInside(line, x1, x2);
+}
+
 // *****************************************************************************
 // ***   Put line in buffer   **************************************************
 // *****************************************************************************
@@ -134,12 +181,145 @@ void TiledMap::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y
 // *****************************************************************************
 void TiledMap::ScrollView(int32_t dx, int32_t dy)
 {
-  LockVisObject();
-  x_pos += dx;
-  if(x_pos < 0) x_pos = 0;
-  y_pos += dy;
-  if(y_pos < 0) y_pos = 0; 
-  UnlockVisObject();
+  // Map position used by DisplayDrv during frame drawing, so scroll will be
+  // applied before next frame
+  Rtos::EnterCriticalSection();
+  int32_t x = x_pos + taken_scroll_dx + scroll_dx + dx;
+  if(x < 0) x = 0;
+  int32_t y = y_pos + taken_scroll_dy + scroll_dy + dy;
+  if(y < 0) y = 0;
+  scroll_dx = x - x_pos - taken_scroll_dx;
+  scroll_dy = y - y_pos - taken_scroll_dy;
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Load tiles from pack file   *******************************************
+// *****************************************************************************
+Result TiledMap::LoadTiles(const char* name, uint32_t tile_h)
+{
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  AssetDrv::AssetInfo info;
+  AssetDrv::ImageHeader hdr;
+  StreamTiles tiles = {};
+
+  // Find image and read header
+  Result result = asset_drv.Find(name, info);
+  if(result.IsGood())
+  {
+    result = Result::ERR_FILE_FORMAT;
+    if(info.size > sizeof(hdr)) result = asset_drv.Read(info.offset, &hdr, sizeof(hdr));
+  }
+  // Check image format
+  if(result.IsGood())
+  {
+    tiles.line_size = (hdr.width * hdr.bits_per_pixel + 7U) / 8U;
+    tiles.tile_size = tiles.line_size * tile_h;
+    tiles.offset = info.offset + sizeof(hdr) + hdr.palette_size * sizeof(uint16_t);
+    tiles.tile_width = hdr.width;
+    tiles.tile_height = tile_h;
+    tiles.tiles_cnt = (tile_h != 0U) ? (hdr.height / tile_h) : 0U;
+    tiles.palette_size = hdr.palette_size;
+    tiles.transparent_color = hdr.transparent_color;
+    // There are no kernels for bits per pixel with compression or alpha flags
+    tiles.blit = Blitter::GetBlitter(hdr.bits_per_pixel, false, hdr.transparent_color >= 0);
+    if(   (tiles.blit == nullptr) || (tiles.tiles_cnt == 0U)
+       || (tiles.tile_size > ASSET_CACHE_ROW_SIZE) || (hdr.palette_size > MAX_STREAM_PALETTE_SIZE) )
+    {
+      result = Result::ERR_NOT_IMPLEMENTED;
+    }
+  }
+  // Palette buffer is used until previous loaded tiles applied
+  if(result.IsGood())
+  {
+    Rtos::EnterCriticalSection();
+    if((new_stream.blit != nullptr) || (taken_stream.blit != nullptr))
+    {
+      result = Result::ERR_BUSY;
+    }
+    Rtos::ExitCriticalSection();
+  }
+  // Read palette
+  if(result.IsGood() && (hdr.palette_size != 0U))
+  {
+    result = asset_drv.Read(info.offset + sizeof(hdr), new_stream_palette, hdr.palette_size * sizeof(uint16_t));
+  }
+  // Tiles used by DisplayDrv during frame drawing, so new tiles will be
+  // applied before next frame
+  if(result.IsGood())
+  {
+    Rtos::EnterCriticalSection();
+    new_stream = tiles;
+    changes_pending = true;
+    Rtos::ExitCriticalSection();
+    // Apply changes immediately if object isn't in DisplayDrv list
+    CommitChanges();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Take changes   ********************************************************
+// *****************************************************************************
+void TiledMap::TakePending(void)
+{
+  // Take movement first
+  VisObject::TakePending();
+  // Take scroll
+  taken_scroll_dx += scroll_dx;
+  taken_scroll_dy += scroll_dy;
+  scroll_dx = 0;
+  scroll_dy = 0;
+  // Take tiles if they loaded
+  if(new_stream.blit != nullptr)
+  {
+    taken_stream = new_stream;
+    new_stream.blit = nullptr;
+  }
+}
+
+// *****************************************************************************
+// ***   Apply changes   *******************************************************
+// *****************************************************************************
+void TiledMap::ApplyChanges(void)
+{
+  // Apply movement first
+  VisObject::ApplyChanges();
+  // Apply scroll
+  if((taken_scroll_dx != 0) || (taken_scroll_dy != 0))
+  {
+    // Horizontal scroll can be done by display hardware, otherwise whole
+    // map should be redrawn
+    if(   (hw_scroll == false) || (taken_scroll_dy != 0)
+       || (DisplayDrv::GetInstance().ScrollScreen(this, taken_scroll_dx) == false) )
+    {
+      Invalidate();
+    }
+    // Tasks calculate scroll from position with taken scroll, so both
+    // changed together
+    Rtos::EnterCriticalSection();
+    x_pos += taken_scroll_dx;
+    y_pos += taken_scroll_dy;
+    taken_scroll_dx = 0;
+    taken_scroll_dy = 0;
+    Rtos::ExitCriticalSection();
+  }
+  // Apply tiles loaded from pack file
+  if(taken_stream.blit != nullptr)
+  {
+    stream = taken_stream;
+    memcpy(stream_palette, new_stream_palette, stream.palette_size * sizeof(uint16_t));
+    tile_width = stream.tile_width;
+    tile_height = stream.tile_height;
+    // Palette buffer can be used by next LoadTiles()
+    taken_stream.blit = nullptr;
+    // Whole map should be redrawn with new tiles
+    Invalidate();
+  }
 }
 
 // *****************************************************************************
@@ -177,3 +357,66 @@ int8_t TiledMap::GetLvlDataByXY(uint32_t x, uint32_t y)
   // Return result
   return result;
 }
+
+// *****************************************************************************
+// *****************************************************************************
+// ***   TileRowCache   ********************************************************
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// ***   Init cache   **********************************************************
+// *****************************************************************************
+void TileRowCache::Init(Entry* entries, uint32_t size)
+{
+  cache = entries;
+  sets = (entries != nullptr) ? (size / WAYS) : 0U;
+  // Mark all entries as empty
+  for(uint32_t i = 0U; i < sets * WAYS; i++)
+  {
+    cache[i].tile = nullptr;
+    cache[i].last_use = 0U;
+  }
+}
+
+// *****************************************************************************
+// ***   Get cached tile row   *************************************************
+// *****************************************************************************
+TileRowCache::Entry& TileRowCache::GetRow(const ImageDesc& tile, uint32_t row)
+{
+  // Tiles stored in arrays, so rows of different tiles in the same line
+  // placed in different sets
+  uint32_t tile_idx = (uintptr_t)&tile / sizeof(ImageDesc);
+  Entry* set = &cache[((row * 37U + tile_idx) % sets) * WAYS];
+  // Find row in set or least recently used entry for replace
+  Entry* entry = &set[0];
+  for(uint32_t i = 0U; (i < WAYS) && ((entry->tile != &tile) || (entry->row != row)); i++)
+  {
+    if(((set[i].tile == &tile) && (set[i].row == row)) || (set[i].last_use < entry->last_use)) entry = &set[i];
+  }
+  // Fill entry if row isn't in cache
+  if((entry->tile != &tile) || (entry->row != row))
+  {
+    const uint8_t* tile_ptr = tile.img8 + row * ((tile.width * tile.bits_per_pixel + 7U) / 8U);
+    // Expand all pixels including transparent
+    Blitter::BlitFunction blit = Blitter::GetBlitter(tile.bits_per_pixel, false, false);
+    if(blit != nullptr)
+    {
+      blit(entry->pixels, tile_ptr, 0, tile.width, tile.palette, 0U);
+    }
+    else
+    {
+      memset(entry->pixels, 0x00, sizeof(entry->pixels));
+    }
+    // Row without transparent pixels can be copied
+    entry->is_opaque = true;
+    for(uint32_t i = 0U; (i < tile.width) && (tile.transparent_color >= 0); i++)
+    {
+      if(entry->pixels[i] == tile.transparent_color) entry->is_opaque = false;
+    }
+    entry->tile = &tile;
+    entry->row = row;
+  }
+  entry->last_use = ++use_cnt;
+  return *entry;
+}
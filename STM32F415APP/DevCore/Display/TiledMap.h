@@ -45,18 +45,84 @@
 #include "VisObject.h"
 #include "Image.h"
 
+// *****************************************************************************
+// ***   Tile Row Cache Class   ************************************************
+// *****************************************************************************
+// * Cache of tile rows with pixels expanded from tile format to RGB565. Rows
+// * filled on first use and least recently used rows replaced when cache is
+// * full. Memory for entries provided by user.
+class TileRowCache
+{
+  public:
+    // Max width of tile which rows can be cached
+    static const uint32_t TILE_WIDTH = 16U;
+
+    // *************************************************************************
+    // ***   Cache entry   *****************************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Tile image and row of it
+      const ImageDesc* tile;
+      uint16_t row;
+      // Row has no transparent pixels
+      bool is_opaque;
+      // Value of cache use counter when entry was used last time
+      uint32_t last_use;
+      // Pixels of tile row
+      uint16_t pixels[TILE_WIDTH];
+    } Entry;
+
+    // *************************************************************************
+    // ***   Init cache   ******************************************************
+    // *************************************************************************
+    // * Cache is disabled if entries is nullptr.
+    void Init(Entry* entries, uint32_t size);
+
+    // *************************************************************************
+    // ***   Check if cache enabled   ******************************************
+    // *************************************************************************
+    inline bool IsEnabled(void) {return sets != 0U;}
+
+    // *************************************************************************
+    // ***   Get cached tile row   *********************************************
+    // *************************************************************************
+    // * Returns entry for row of tile. Entry filled if row isn't in cache.
+    // * Tile width must not exceed TILE_WIDTH.
+    Entry& GetRow(const ImageDesc& tile, uint32_t row);
+
+  private:
+    // Count of entries in each set of cache. Row can be placed only in one
+    // set, so only few entries checked for each tile.
+    static const uint32_t WAYS = 4U;
+
+    // Cache entries
+    Entry* cache = nullptr;
+    // Count of sets in cache
+    uint32_t sets = 0U;
+    // Cache use counter
+    uint32_t use_cnt = 0U;
+};
+
 // *****************************************************************************
 // ***   Tile Map Class   ******************************************************
 // *****************************************************************************
 class TiledMap : public VisObject
 {
   public:
+    // Entry of optional cache of tile rows
+    typedef TileRowCache::Entry TileRow;
+
     // *************************************************************************
     // ***   Constructor   *****************************************************
     // *************************************************************************
+    // * Optional cache of tile rows makes drawing of maps with few distinct
+    // * tiles much faster: rows filled on first use and least recently used
+    // * rows replaced when cache is full. Cache must exist while map exists.
     TiledMap(int32_t x, int32_t y, int32_t w, int32_t h,
              uint8_t* map, uint32_t map_w, uint32_t map_h, uint8_t bitmask,
-             const ImageDesc* tiles, uint32_t n, int32_t def_color);
+             const ImageDesc* tiles, uint32_t n, int32_t def_color,
+             TileRow* cache = nullptr, uint32_t cache_size = 0U);
 
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
@@ -67,12 +133,39 @@ class TiledMap : public VisObject
     // ***   Put line in buffer   **********************************************
     // *************************************************************************
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t x = 0);
+
+    // *************************************************************************
+    // ***   Check if line span covered by opaque pixels   *********************
+    // *************************************************************************
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2);
     
     // *************************************************************************
     // ***   Scroll tiled map   ************************************************
     // *************************************************************************
+    // * Map will be scrolled before next frame.
     void ScrollView(int32_t dx, int32_t dy = 0);
 
+    // *************************************************************************
+    // ***   Load tiles from pack file   ***************************************
+    // *************************************************************************
+    // * Replace tiles given to constructor by image asset from pack file opened
+    // * by AssetDrv. Asset contains tiles with height tile_h placed one under
+    // * another. Whole tile read to one AssetDrv cache row when it is drawn
+    // * first time, so tile data must fit in ASSET_CACHE_ROW_SIZE. Tile which
+    // * isn't read yet isn't drawn and redrawn when it is read. Compressed
+    // * tiles and tiles with alpha channel aren't supported, palette is
+    // * limited by MAX_STREAM_PALETTE_SIZE colors. New tiles will be shown from
+    // * next frame. Returns ERR_BUSY if previous loaded tiles aren't applied
+    // * yet.
+    Result LoadTiles(const char* name, uint32_t tile_h);
+
+    // *************************************************************************
+    // ***   Enable hardware scroll   ******************************************
+    // *************************************************************************
+    // * If map covers whole screen width, horizontal scroll will be done by
+    // * display hardware and only new columns of map will be drawn.
+    void SetHardwareScroll(bool enable) {hw_scroll = enable;}
+
     // *************************************************************************
     // ***   GetMapPosX   ******************************************************
     // *************************************************************************
@@ -86,12 +179,12 @@ class TiledMap : public VisObject
     // *************************************************************************
     // ***   GetMapPosX   ******************************************************
     // *************************************************************************
-    int32_t GetMapPosX(void) {return x_pos;}
+    int32_t GetMapPosX(void) {return x_pos + taken_scroll_dx + scroll_dx;}
     
     // *************************************************************************
     // ***   GetMapPosY   ******************************************************
     // *************************************************************************
-    int32_t GetMapPosY(void) {return y_pos;}
+    int32_t GetMapPosY(void) {return y_pos + taken_scroll_dy + scroll_dy;}
 
     // *************************************************************************
     // ***   GetPixWidth   *****************************************************
@@ -103,7 +196,38 @@ class TiledMap : public VisObject
     // *************************************************************************
     int32_t GetPixHeight() {return (tile_height * map_height);}
 
+  protected:
+    // *************************************************************************
+    // ***   Take changes   ****************************************************
+    // *************************************************************************
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   Apply changes   ***************************************************
+    // *************************************************************************
+    virtual void ApplyChanges(void);
+
   private:
+    // Max count of colors in palette of tiles loaded from pack file
+    static const uint32_t MAX_STREAM_PALETTE_SIZE = 16U;
+
+    // Parameters of tiles loaded from pack file
+    typedef struct
+    {
+      // Offset of first tile in pack file and size of tile in bytes
+      uint32_t offset;
+      uint32_t tile_size;
+      // Size of tile line in bytes
+      uint32_t line_size;
+      uint16_t tile_width;
+      uint16_t tile_height;
+      uint32_t tiles_cnt;
+      uint16_t palette_size;
+      int32_t transparent_color;
+      // Kernel for copy tile line to buffer, nullptr - tiles from constructor
+      Blitter::BlitFunction blit;
+    } StreamTiles;
+
     // Pointer to the tiles map
     uint8_t* tiles_map;
     // Map width in tiles
@@ -126,6 +250,24 @@ class TiledMap : public VisObject
     int32_t x_pos = 0;
     // Y position of tiled map in the viewport
     int32_t y_pos = 0;
+    // Use display hardware for horizontal scroll
+    bool hw_scroll = false;
+    // Scroll requested by task and not applied yet
+    int32_t scroll_dx = 0;
+    int32_t scroll_dy = 0;
+    // Scroll taken by TakePending() and not applied yet
+    int32_t taken_scroll_dx = 0;
+    int32_t taken_scroll_dy = 0;
+    // Cache of tile rows
+    TileRowCache tile_cache;
+    // Tiles loaded from pack file
+    StreamTiles stream = {};
+    uint16_t stream_palette[MAX_STREAM_PALETTE_SIZE];
+    // Tiles and palette loaded by LoadTiles() and not applied yet
+    StreamTiles new_stream = {};
+    uint16_t new_stream_palette[MAX_STREAM_PALETTE_SIZE];
+    // Tiles taken by TakePending() and not applied yet
+    StreamTiles taken_stream = {};
 };
 
 #endif
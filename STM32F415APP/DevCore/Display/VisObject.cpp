@@ -30,24 +30,6 @@ VisObject::~VisObject()
   DisplayDrv::GetInstance().DelVisObjectFromList(this);
 }
 
-// *****************************************************************************
-// ***   Lock Visual Object  ***************************************************
-// *****************************************************************************
-void VisObject::LockVisObject()
-{
-  // Lock line
-  DisplayDrv::GetInstance().LockDisplayLine();
-};
-
-// *****************************************************************************
-// ***   Unlock Visual Object   ************************************************
-// *****************************************************************************
-void VisObject::UnlockVisObject() 
-{
-  // Unlock line
-  DisplayDrv::GetInstance().UnlockDisplayLine();
-};
-
 // *****************************************************************************
 // ***   Show Visual Object   **************************************************
 // *****************************************************************************
@@ -76,15 +58,9 @@ void VisObject::Hide(void)
 // *****************************************************************************
 bool VisObject::IsShow(void)
 {
-  // Return false by default
-  bool ret = false;
-  // If any pointer is not null - object in list
-  if( (p_next != nullptr) || (p_prev != nullptr) )
-  {
-    ret = true;
-  }
-  // Return result
-  return ret;
+  // Single object in the list has no neighbours, so DisplayDrv checks the
+  // list head too
+  return DisplayDrv::GetInstance().IsVisObjectInList(this);
 }
 
 // *****************************************************************************
@@ -92,27 +68,105 @@ bool VisObject::IsShow(void)
 // *****************************************************************************
 void VisObject::Move(int32_t x, int32_t y, bool is_delta)
 {
-  // Lock object for changes
-  LockVisObject();
-  // Make changes
+  // Object coordinates used by DisplayDrv during frame drawing, so only
+  // requested movement saved here. Critical section is very short and,
+  // unlike line mutex, never blocks task until end of frame drawing.
+  Rtos::EnterCriticalSection();
   if(is_delta == true)
   {
     // Move object in delta coordinates
-    x_start += x;
-    y_start += y;
-    x_end += x;
-    y_end += y;
+    move_dx += x;
+    move_dy += y;
   }
   else
   {
     // Move object in absolute coordinates
-    x_start = x;
-    y_start = y;
-    x_end = x + width - 1;
-    y_end = y + height - 1;
+    move_dx = x - (x_start + taken_dx);
+    move_dy = y - (y_start + taken_dy);
+  }
+  // DisplayDrv will apply movement before next frame
+  changes_pending = true;
+  Rtos::ExitCriticalSection();
+  // Apply changes immediately if object isn't in DisplayDrv list
+  CommitChanges();
+}
+
+// *****************************************************************************
+// ***   Take changes of Visual Object   ***************************************
+// *****************************************************************************
+void VisObject::TakePending(void)
+{
+  taken_dx += move_dx;
+  taken_dy += move_dy;
+  move_dx = 0;
+  move_dy = 0;
+}
+
+// *****************************************************************************
+// ***   Apply changes of Visual Object   **************************************
+// *****************************************************************************
+void VisObject::ApplyChanges(void)
+{
+  if((taken_dx != 0) || (taken_dy != 0))
+  {
+    // Old area should be redrawn
+    Invalidate();
+    // Move object. Tasks calculate absolute movement from position with
+    // taken movement, so both changed together.
+    Rtos::EnterCriticalSection();
+    x_start += taken_dx;
+    y_start += taken_dy;
+    x_end += taken_dx;
+    y_end += taken_dy;
+    taken_dx = 0;
+    taken_dy = 0;
+    Rtos::ExitCriticalSection();
+    // New area should be redrawn
+    Invalidate();
+  }
+}
+
+// *****************************************************************************
+// ***   Commit changes of Visual Object   *************************************
+// *****************************************************************************
+void VisObject::CommitChanges(void)
+{
+  // DisplayDrv applies changes of objects from the list before next frame
+  if(DisplayDrv::GetInstance().IsVisObjectInList(this) == false)
+  {
+    // Line mutex isn't taken here: function can be called from Action()
+    // when mutex already taken. Object drawn by parent object invalidates
+    // its area, so line drawn during change will be redrawn in next frame.
+    // Hidden object can be changed by several tasks, so only taking of
+    // pending changes is done inside critical section, like DisplayDrv does.
+    Rtos::EnterCriticalSection();
+    TakePending();
+    changes_pending = false;
+    Rtos::ExitCriticalSection();
+    ApplyChanges();
+  }
+}
+
+// *****************************************************************************
+// ***   Invalidate Visual Object   ********************************************
+// *****************************************************************************
+void VisObject::Invalidate(void)
+{
+  // Add object area to changed areas list
+  DisplayDrv::GetInstance().InvalidateVisObject(this);
+}
+
+// *****************************************************************************
+// ***   Set opacity of Visual Object   ****************************************
+// *****************************************************************************
+void VisObject::SetAlpha(uint8_t a)
+{
+  if(alpha != a)
+  {
+    alpha = a;
+    // Object area should be redrawn with new opacity
+    Invalidate();
   }
-  // Unlock object after changes
-  UnlockVisObject();
 }
 
 // *****************************************************************************
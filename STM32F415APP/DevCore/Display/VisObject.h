@@ -73,16 +73,6 @@ class VisObject
     // * remove from list before delete and delete semaphore.
     virtual ~VisObject();
 
-    // *************************************************************************
-    // ***   LockVisObject   ***************************************************
-    // *************************************************************************
-    void LockVisObject();
-
-    // *************************************************************************
-    // ***   UnlockVisObject   *************************************************
-    // *************************************************************************
-    void UnlockVisObject();
-
     // *************************************************************************
     // ***   Show   ************************************************************
     // *************************************************************************
@@ -109,9 +99,32 @@ class VisObject
     // ***   Move   ************************************************************
     // *************************************************************************
     // * Move object on screen. Set new x and y coordinates. If flag is set - 
-    // * move is relative, not absolute.
+    // * move is relative, not absolute. Object will be moved by DisplayDrv
+    // * before next frame, so caller never waits for frame drawing.
     virtual void Move(int32_t x, int32_t y, bool is_delta = false);
 
+    // *************************************************************************
+    // ***   Invalidate   ******************************************************
+    // *************************************************************************
+    // * Mark object area on screen as changed. DisplayDrv redraws only changed
+    // * areas, so derived classes must call it before and after any change of
+    // * object position or appearance. User must call it if object content
+    // * changed directly(for example string buffer changed by sprintf()).
+    void Invalidate(void);
+
+    // *************************************************************************
+    // ***   SetAlpha   ********************************************************
+    // *************************************************************************
+    // * Set opacity of whole object from 0(invisible) to 255(opaque). Object
+    // * with alpha less than 255 blended over objects below it by DisplayDrv.
+    // * Used only in horizontal update mode.
+    void SetAlpha(uint8_t a);
+
+    // *************************************************************************
+    // ***   GetAlpha   ********************************************************
+    // *************************************************************************
+    inline uint8_t GetAlpha(void) {return alpha;}
+
     // *************************************************************************
     // ***   DrawInBufH   ******************************************************
     // *************************************************************************
@@ -126,6 +139,14 @@ class VisObject
     // * Each derived class must implement this function.
     virtual void DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_x = 0) = 0;
 
+    // *************************************************************************
+    // ***   IsOpaque   ********************************************************
+    // *************************************************************************
+    // * Return true if object covers all pixels of line from x1 to x2 by
+    // * opaque pixels. Display driver doesn't draw objects below such object
+    // * and doesn't clear line. Derived classes should override it if possible.
+    virtual bool IsOpaque(int32_t line, int32_t x1, int32_t x2) {return false;}
+
     // *************************************************************************
     // ***   Action   **********************************************************
     // *************************************************************************
@@ -134,22 +155,28 @@ class VisObject
     // *************************************************************************
     // ***   Return Start X coordinate   ***************************************
     // *************************************************************************
-    virtual int32_t GetStartX(void) {return x_start;};
+    virtual int32_t GetStartX(void) {return x_start + move_dx + taken_dx;};
 
     // *************************************************************************
     // ***   Return Start Y coordinate   ***************************************
     // *************************************************************************
-    virtual int32_t GetStartY(void) {return y_start;};
+    virtual int32_t GetStartY(void) {return y_start + move_dy + taken_dy;};
 
     // *************************************************************************
     // ***   Return End X coordinate   *****************************************
     // *************************************************************************
-    virtual int32_t GetEndX(void) {return x_end;};
+    virtual int32_t GetEndX(void) {return x_end + move_dx + taken_dx;};
 
     // *************************************************************************
     // ***   Return End Y coordinate   *****************************************
     // *************************************************************************
-    virtual int32_t GetEndY(void) {return y_end;};
+    virtual int32_t GetEndY(void) {return y_end + move_dy + taken_dy;};
+
+    // *************************************************************************
+    // ***   Return CPU cycles spent to draw object in last frame   ************
+    // *************************************************************************
+    // * Counted only if render profiling enabled in DisplayDrv.
+    inline uint32_t GetDrawCycles(void) {return last_draw_cycles;};
 
     // *************************************************************************
     // ***   Return Width of object   ******************************************
@@ -162,6 +189,41 @@ class VisObject
     virtual int32_t GetHeight(void) {return height;};
 
   protected:
+    // *************************************************************************
+    // ***   TakePending   *****************************************************
+    // *************************************************************************
+    // * Take changes made by tasks since previous frame. DisplayDrv calls it
+    // * inside critical section before frame drawing if changes_pending flag
+    // * is set, so it should only copy pending values to fields used by
+    // * ApplyChanges(). Derived classes with own deferred changes must call it
+    // * too.
+    virtual void TakePending(void);
+
+    // *************************************************************************
+    // ***   ApplyChanges   ****************************************************
+    // *************************************************************************
+    // * Apply changes taken by TakePending(). DisplayDrv calls it right after
+    // * TakePending() with interrupts enabled, so areas invalidation and
+    // * recalculation of object don't delay interrupts. Derived classes with
+    // * own deferred changes must call it too.
+    virtual void ApplyChanges(void);
+
+    // *************************************************************************
+    // ***   CommitChanges   ***************************************************
+    // *************************************************************************
+    // * Must be called by setters after save deferred changes. Object which
+    // * isn't in DisplayDrv list(hidden or drawn by parent object) applies
+    // * changes immediately.
+    void CommitChanges(void);
+
+    // *************************************************************************
+    // ***   Check if line span inside object   ********************************
+    // *************************************************************************
+    inline bool IsSpanInside(int32_t line, int32_t x1, int32_t x2)
+    {
+      return (line >= y_start) && (line <= y_end) && (x1 >= x_start) && (x2 <= x_end);
+    }
+
     // *************************************************************************
     // ***   Object parameters   ***********************************************
     // *************************************************************************
@@ -176,6 +238,8 @@ class VisObject
     int8_t rotation = 0;
     // Object active
     bool active = false;
+    // Object has changes that should be applied before next frame
+    volatile bool changes_pending = false;
 
   private:
     // *************************************************************************
@@ -191,6 +255,24 @@ class VisObject
     // Pointer to next object. This pointer need to maker object list. Object
     // can be added only to one list.
     VisObject* p_prev = nullptr;
+    // Pointers to next and previous objects in the list sorted by Y. This
+    // list used by DisplayDrv to find objects that cross the line.
+    VisObject* p_ynext = nullptr;
+    VisObject* p_yprev = nullptr;
+    // Pointer to next object in DisplayDrv list of objects on current line
+    VisObject* p_anext = nullptr;
+    // Position of object in the list. Updated by DisplayDrv every frame and
+    // used to keep order of objects with the same Z.
+    uint32_t rank = 0U;
+    // CPU cycles spent to draw object in current and last frames
+    uint32_t draw_cycles = 0U;
+    uint32_t last_draw_cycles = 0U;
+    // Object movement requested by task and not applied yet
+    int16_t move_dx = 0, move_dy = 0;
+    // Object movement taken by TakePending() and not applied yet
+    int16_t taken_dx = 0, taken_dy = 0;
+    // Opacity of object
+    uint8_t alpha = 255U;
 
     // DisplayDrv is friend for access to pointers and Z
     friend class DisplayDrv;
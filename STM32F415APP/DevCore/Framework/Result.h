@@ -87,6 +87,7 @@ class Result
       ERR_SEMAPHORE_CREATE,
       ERR_SEMAPHORE_TAKE,
       ERR_SEMAPHORE_GIVE,
+      ERR_TASK_NOTIFY_TAKE,
 
       // ***   UART errors   ***************************************************
       ERR_UART_GENERAL,
@@ -109,6 +110,12 @@ class Result
       ERR_SPI_TIMEOUT,
       ERR_SPI_UNKNOWN,
 
+      // ***   File errors   ***************************************************
+      ERR_FILE_OPEN,
+      ERR_FILE_READ,
+      ERR_FILE_WRITE,
+      ERR_FILE_FORMAT,
+
       // ***   Elements count   ************************************************
       RESULTS_CNT
     };
@@ -49,6 +49,51 @@ void Rtos::TaskDelete(TaskHandle_t task)
   vTaskDelete(task);
 }
 
+// *****************************************************************************
+// ***   GetCurrentTask   ******************************************************
+// *****************************************************************************
+TaskHandle_t Rtos::GetCurrentTask()
+{
+  return xTaskGetCurrentTaskHandle();
+}
+
+// *****************************************************************************
+// ***   TaskNotifyGive   ******************************************************
+// *****************************************************************************
+void Rtos::TaskNotifyGive(TaskHandle_t task)
+{
+  // Check handler mode
+  if(IsInHandlerMode())
+  {
+    BaseType_t task_woken = pdFALSE;
+    // Give notification from ISR
+    vTaskNotifyGiveFromISR(task, &task_woken);
+    // Switch context if needed
+    portEND_SWITCHING_ISR(task_woken);
+  }
+  else
+  {
+    // Give notification
+    (void) xTaskNotifyGive(task);
+  }
+}
+
+// *****************************************************************************
+// ***   TaskNotifyTake   ******************************************************
+// *****************************************************************************
+Result Rtos::TaskNotifyTake(TickType_t ticks_to_wait)
+{
+  Result result = Result::ERR_TASK_NOTIFY_TAKE;
+
+  // Take notification and clear notification value
+  if(ulTaskNotifyTake(pdTRUE, ticks_to_wait) != 0U)
+  {
+    result = Result::RESULT_OK;
+  }
+
+  return result;
+}
+
 // *****************************************************************************
 // ***   Determine whether we are in thread mode or handler mode   *************
 // *****************************************************************************
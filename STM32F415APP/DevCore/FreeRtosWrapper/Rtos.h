@@ -82,6 +82,24 @@ class Rtos
     // *************************************************************************
     static void TaskDelete(TaskHandle_t task = nullptr);
 
+    // *************************************************************************
+    // ***   GetCurrentTask   **************************************************
+    // *************************************************************************
+    static TaskHandle_t GetCurrentTask();
+
+    // *************************************************************************
+    // ***   TaskNotifyGive   **************************************************
+    // *************************************************************************
+    // * Increment notification value of task. Can be called from interrupt.
+    static void TaskNotifyGive(TaskHandle_t task);
+
+    // *************************************************************************
+    // ***   TaskNotifyTake   **************************************************
+    // *************************************************************************
+    // * Wait until notification value of current task is non-zero and clear
+    // * it. Notifications given before call aren't lost.
+    static Result TaskNotifyTake(TickType_t ticks_to_wait);
+
     // *************************************************************************
     // ***   IsInHandlerMode   *************************************************
     // *************************************************************************
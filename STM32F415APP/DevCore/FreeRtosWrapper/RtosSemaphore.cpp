@@ -59,7 +59,7 @@ Result RtosSemaphore::Take(TickType_t ticks_to_wait)
   // Check handler mode
   if(Rtos::IsInHandlerMode())
   {
-    BaseType_t task_woken;
+    BaseType_t task_woken = pdFALSE;
     // Take semaphore from ISR
     res = xSemaphoreTakeFromISR(semaphore, &task_woken);
     // Switch context if needed
@@ -93,12 +93,12 @@ Result RtosSemaphore::Give()
 {
   Result result;
   // Variable for check result
-  BaseType_t res = xSemaphoreGive(semaphore);
+  BaseType_t res;
 
   // Check handler mode
   if(Rtos::IsInHandlerMode())
   {
-    BaseType_t task_woken;
+    BaseType_t task_woken = pdFALSE;
     // Give semaphore from ISR
     res = xSemaphoreGiveFromISR(semaphore, &task_woken);
     // Switch context if needed
@@ -0,0 +1,173 @@
+//******************************************************************************
+//  @file IDisplay.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Display driver interface, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef IDisplay_h
+#define IDisplay_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// *****************************************************************************
+// ***   Display Driver Interface   ********************************************
+// *****************************************************************************
+class IDisplay
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    explicit IDisplay() {};
+
+    // *************************************************************************
+    // ***   Public: Destructor   **********************************************
+    // *************************************************************************
+    virtual ~IDisplay() {};
+
+    // *************************************************************************
+    // ***   Public: Init   ****************************************************
+    // *************************************************************************
+    virtual Result Init() = 0;
+
+    // *************************************************************************
+    // ***   Public: SetRotation   *********************************************
+    // *************************************************************************
+    virtual void SetRotation(uint8_t r) = 0;
+
+    // *************************************************************************
+    // ***   Public: GetWidth   ************************************************
+    // *************************************************************************
+    virtual int32_t GetWidth(void) = 0;
+
+    // *************************************************************************
+    // ***   Public: GetHeight   ***********************************************
+    // *************************************************************************
+    virtual int32_t GetHeight(void) = 0;
+
+    // *************************************************************************
+    // ***   Public: GetBytesPerPixel   ****************************************
+    // *************************************************************************
+    virtual int32_t GetBytesPerPixel(void) = 0;
+
+    // *************************************************************************
+    // ***   Public: SetAddrWindow   *******************************************
+    // *************************************************************************
+    // * Set window for following pixel data.
+    virtual void SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) = 0;
+
+    // *************************************************************************
+    // ***   Public: WriteDataStream   *****************************************
+    // *************************************************************************
+    // * Start asynchronous transfer of pixel data. Callback will be called when
+    // * transfer complete. Data must exist until then.
+    virtual void WriteDataStream(uint8_t* data, uint32_t n) = 0;
+
+    // *************************************************************************
+    // ***   Public: IsTransferComplete   **************************************
+    // *************************************************************************
+    virtual bool IsTransferComplete(void) {return true;}
+
+    // *************************************************************************
+    // ***   Public: StopTransfer   ********************************************
+    // *************************************************************************
+    virtual void StopTransfer(void) {};
+
+    // *************************************************************************
+    // ***   Public: AbortTransfer   *******************************************
+    // *************************************************************************
+    // * Abort transfer started by WriteDataStream(). Callback isn't called.
+    virtual void AbortTransfer(void) {};
+
+    // *************************************************************************
+    // ***   Public: FillRect   ************************************************
+    // *************************************************************************
+    // * Fill rectangle by solid color. Returns when fill complete.
+    virtual void FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
+
+    // *************************************************************************
+    // ***   Public: SetScrollOffset   *****************************************
+    // *************************************************************************
+    // * Hardware scroll along long side of display. After call screen pixel
+    // * with coordinate 0 shows display memory with coordinate offset.
+    virtual void SetScrollOffset(uint16_t offset) = 0;
+
+    // *************************************************************************
+    // ***   Public: SetCallback   *********************************************
+    // *************************************************************************
+    // * Set function which will be called when transfer started by
+    // * WriteDataStream() complete. Can be called from interrupt.
+    virtual void SetCallback(void (*clbk)(void* ptr), void* clbk_ptr) {callback = clbk; callback_ptr = clbk_ptr;}
+
+    // *************************************************************************
+    // ***   Public: SetErrorCallback   ****************************************
+    // *************************************************************************
+    // * Set function which will be called when transfer started by
+    // * WriteDataStream() failed. Can be called from interrupt.
+    virtual void SetErrorCallback(void (*clbk)(void* ptr), void* clbk_ptr) {error_callback = clbk; error_callback_ptr = clbk_ptr;}
+
+  protected:
+    // Transfer complete callback
+    void (*callback)(void* ptr) = nullptr;
+
+    // Pointer to pass to callback
+    void* callback_ptr = nullptr;
+
+    // Transfer error callback
+    void (*error_callback)(void* ptr) = nullptr;
+
+    // Pointer to pass to error callback
+    void* error_callback_ptr = nullptr;
+
+  private:
+    // *************************************************************************
+    // ***   Private: Constructors and assign operator - prevent copying   *****
+    // *************************************************************************
+    IDisplay(const IDisplay&);
+};
+
+#endif
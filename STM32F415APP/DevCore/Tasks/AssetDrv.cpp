@@ -0,0 +1,496 @@
+//******************************************************************************
+//  @file AssetDrv.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Asset Driver Class, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "AssetDrv.h"
+#include "DisplayDrv.h"
+#include "Rtos.h"
+
+#include <string.h>
+
+// *****************************************************************************
+// ***   Get Instance   ********************************************************
+// *****************************************************************************
+AssetDrv& AssetDrv::GetInstance(void)
+{
+  // This class is static and declared here
+  static AssetDrv asset_drv;
+  // Return reference to class
+  return asset_drv;
+}
+
+// *****************************************************************************
+// ***   Asset Driver Loop   ***************************************************
+// *****************************************************************************
+Result AssetDrv::Loop()
+{
+  // Wait semaphore for start reading requested rows
+  rows_requested.Take();
+
+  // Flag for request display update
+  bool update = false;
+
+  // Read all requested rows
+  while(queue_head != queue_tail)
+  {
+    // Row for read. Row in requested state can't be changed by display driver.
+    CacheRow& row = rows[queue[queue_head % ASSET_CACHE_ROWS]];
+    uint32_t idx = &row - rows;
+    queue_head++;
+
+    // Read row data
+    file_mutex.Lock();
+    Result result = Result::ERR_FILE_READ;
+    if(is_open) result = ReadFile(row.offset, rows_data[idx], row.size);
+    file_mutex.Release();
+
+    // Area for redraw
+    bool redraw;
+    int16_t x1, y1, x2, y2;
+    // Update row state
+    Rtos::EnterCriticalSection();
+    // Row requested before file was closed isn't valid
+    if(row.file_gen != file_gen) result = Result::ERR_FILE_READ;
+    row.state = result.IsGood() ? ROW_READY : ROW_EMPTY;
+    redraw = row.redraw;
+    x1 = row.x1; y1 = row.y1; x2 = row.x2; y2 = row.y2;
+    row.redraw = false;
+    if(result.IsGood()) cur_stats.bytes_read += row.size;
+    Rtos::ExitCriticalSection();
+
+    // Redraw lines where row wasn't drawn
+    if(redraw && result.IsGood())
+    {
+      DisplayDrv::GetInstance().InvalidateArea(x1, y1, x2, y2);
+      update = true;
+    }
+  }
+
+  // Lines which weren't requested because cache was full should be requested
+  // again now, when cache has free rows.
+  bool is_retry;
+  int16_t x1, y1, x2, y2;
+  Rtos::EnterCriticalSection();
+  is_retry = retry;
+  x1 = retry_x1; y1 = retry_y1; x2 = retry_x2; y2 = retry_y2;
+  retry = false;
+  Rtos::ExitCriticalSection();
+  if(is_retry)
+  {
+    DisplayDrv::GetInstance().InvalidateArea(x1, y1, x2, y2);
+    update = true;
+  }
+
+  // Request new frame
+  if(update)
+  {
+    DisplayDrv::GetInstance().UpdateDisplay();
+  }
+
+  // Always run
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Open pack file   ******************************************************
+// *****************************************************************************
+Result AssetDrv::Open(const char* path)
+{
+  Result result = Result::ERR_NULL_PTR;
+
+  if(path != nullptr)
+  {
+    // Close previous file
+    Close();
+
+    file_mutex.Lock();
+    // Mount SD card if it isn't mounted yet
+    if(SDFatFS.fs_type == 0U)
+    {
+      f_mount(&SDFatFS, (TCHAR const*)SDPath, 0);
+    }
+    // Open file
+    if(f_open(&file, path, FA_READ) != FR_OK)
+    {
+      result = Result::ERR_FILE_OPEN;
+    }
+    else
+    {
+      is_open = true;
+      // Read header
+      uint32_t header[2U];
+      result = ReadFile(0U, header, sizeof(header));
+      // Check signature
+      if(result.IsGood() && (header[0U] != PACK_SIGNATURE))
+      {
+        result = Result::ERR_FILE_FORMAT;
+      }
+      if(result.IsGood())
+      {
+        assets_cnt = header[1U];
+        // Create cluster link map for fast seek. If file too fragmented and
+        // table too small - use normal seek.
+        clmt[0U] = CLMT_SIZE;
+        file.cltbl = clmt;
+        if(f_lseek(&file, CREATE_LINKMAP) != FR_OK)
+        {
+          file.cltbl = nullptr;
+        }
+        // Driver task isn't needed until first pack file opened
+        if(is_task_created == false)
+        {
+          InitTask();
+          // Statistic of frame saved when display driver finishes frame
+          DisplayDrv::GetInstance().SetFrameDoneCallback(FrameDoneCallback, this);
+          is_task_created = true;
+        }
+      }
+      else
+      {
+        // Close file with wrong format
+        f_close(&file);
+        is_open = false;
+      }
+    }
+    file_mutex.Release();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Close pack file   *****************************************************
+// *****************************************************************************
+Result AssetDrv::Close(void)
+{
+  file_mutex.Lock();
+  // Rows from closed file can't be used anymore
+  ClearCache();
+  // Close file
+  if(is_open)
+  {
+    f_close(&file);
+    is_open = false;
+    assets_cnt = 0U;
+  }
+  file_mutex.Release();
+
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Find asset   **********************************************************
+// *****************************************************************************
+Result AssetDrv::Find(const char* name, AssetInfo& info)
+{
+  Result result = Result::ERR_NULL_PTR;
+
+  if(name != nullptr)
+  {
+    // Asset table entry: name, offset and size
+    struct
+    {
+      char name[NAME_SIZE];
+      uint32_t offset;
+      uint32_t size;
+    } entry;
+
+    file_mutex.Lock();
+    result = is_open ? Result::ERR_INVALID_ITEM : Result::ERR_FILE_READ;
+    for(uint32_t i = 0U; i < assets_cnt; i++)
+    {
+      // Read entry after header
+      Result res = ReadFile(8U + i * sizeof(entry), &entry, sizeof(entry));
+      if(res.IsBad())
+      {
+        result = res;
+        break;
+      }
+      // Check name
+      if(strncmp(name, entry.name, NAME_SIZE) == 0)
+      {
+        info.offset = entry.offset;
+        info.size = entry.size;
+        result = Result::RESULT_OK;
+        break;
+      }
+    }
+    file_mutex.Release();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Read data from pack file   ********************************************
+// *****************************************************************************
+Result AssetDrv::Read(uint32_t offset, void* buf, uint32_t size)
+{
+  Result result = Result::ERR_NULL_PTR;
+
+  if(buf != nullptr)
+  {
+    file_mutex.Lock();
+    result = Result::ERR_FILE_READ;
+    if(is_open) result = ReadFile(offset, buf, size);
+    file_mutex.Release();
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Load image to RAM   ***************************************************
+// *****************************************************************************
+Result AssetDrv::LoadImage(const char* name, ImageDesc& img_dsc, void* buf, uint32_t size)
+{
+  AssetInfo info;
+  ImageHeader hdr;
+
+  // Find image
+  Result result = Find(name, info);
+  // Read image header
+  if(result.IsGood())
+  {
+    result = Result::ERR_FILE_FORMAT;
+    if(info.size > sizeof(hdr)) result = Read(info.offset, &hdr, sizeof(hdr));
+  }
+  // Check buffer size
+  if(result.IsGood() && ((buf == nullptr) || (info.size - sizeof(hdr) > size)))
+  {
+    result = Result::ERR_BAD_PARAMETER;
+  }
+  // Read palette and image data
+  if(result.IsGood())
+  {
+    result = Read(info.offset + sizeof(hdr), buf, info.size - sizeof(hdr));
+  }
+  // Fill image description
+  if(result.IsGood())
+  {
+    img_dsc.width = hdr.width;
+    img_dsc.height = hdr.height;
+    img_dsc.bits_per_pixel = hdr.bits_per_pixel;
+    img_dsc.palette = (hdr.palette_size != 0U) ? (const uint16_t*)buf : nullptr;
+    img_dsc.img8 = (const uint8_t*)buf + hdr.palette_size * sizeof(uint16_t);
+    img_dsc.transparent_color = hdr.transparent_color;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Get row from cache   **************************************************
+// *****************************************************************************
+const uint8_t* AssetDrv::GetRow(uint32_t offset, uint32_t size, int32_t line, int32_t x1, int32_t x2)
+{
+  const uint8_t* data = nullptr;
+  // Flag for start reading
+  bool request = false;
+
+  // Big rows can't be cached
+  if(size <= ASSET_CACHE_ROW_SIZE)
+  {
+    Rtos::EnterCriticalSection();
+    // Find row or request it
+    CacheRow* row = Request(offset, size);
+    if((row != nullptr) && (row->state == ROW_READY))
+    {
+      data = rows_data[row - rows];
+      cur_stats.hits++;
+    }
+    else
+    {
+      if(row != nullptr)
+      {
+        // Line should be redrawn when row is read
+        AddArea(row->redraw, row->x1, row->y1, row->x2, row->y2, line, x1, x2);
+        request = true;
+      }
+      else
+      {
+        // Line should be redrawn when cache has free rows
+        AddArea(retry, retry_x1, retry_y1, retry_x2, retry_y2, line, x1, x2);
+      }
+      cur_stats.misses++;
+    }
+    Rtos::ExitCriticalSection();
+  }
+
+  // Wake up driver task
+  if(request)
+  {
+    rows_requested.Give();
+  }
+
+  return data;
+}
+
+// *****************************************************************************
+// ***   Prefetch row   ********************************************************
+// *****************************************************************************
+void AssetDrv::Prefetch(uint32_t offset, uint32_t size)
+{
+  // Big rows can't be cached
+  if(size <= ASSET_CACHE_ROW_SIZE)
+  {
+    Rtos::EnterCriticalSection();
+    // Find row or request it
+    CacheRow* row = Request(offset, size);
+    bool request = (row != nullptr) && (row->state == ROW_REQUESTED);
+    Rtos::ExitCriticalSection();
+    // Wake up driver task
+    if(request)
+    {
+      rows_requested.Give();
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Finish statistic of frame   *******************************************
+// *****************************************************************************
+void AssetDrv::FrameDoneCallback(void* ptr)
+{
+  AssetDrv& drv = *(AssetDrv*)ptr;
+  Rtos::EnterCriticalSection();
+  drv.last_stats = drv.cur_stats;
+  drv.cur_stats.hits = 0U;
+  drv.cur_stats.misses = 0U;
+  drv.cur_stats.bytes_read = 0U;
+  Rtos::ExitCriticalSection();
+}
+
+// *****************************************************************************
+// ***   Get statistic of last frame   *****************************************
+// *****************************************************************************
+void AssetDrv::GetFrameStats(Stats& stats)
+{
+  Rtos::EnterCriticalSection();
+  stats = last_stats;
+  Rtos::ExitCriticalSection();
+}
+
+// *****************************************************************************
+// ***   Find row in cache or request it   *************************************
+// *****************************************************************************
+AssetDrv::CacheRow* AssetDrv::Request(uint32_t offset, uint32_t size)
+{
+  CacheRow* row = nullptr;
+  // Least recently used row which can be replaced
+  CacheRow* lru = nullptr;
+
+  use_cnt++;
+  for(uint32_t i = 0U; i < ASSET_CACHE_ROWS; i++)
+  {
+    if((rows[i].state != ROW_EMPTY) && (rows[i].file_gen == file_gen) &&
+       (rows[i].offset == offset) && (rows[i].size == size))
+    {
+      row = &rows[i];
+      row->last_use = use_cnt;
+      break;
+    }
+    // Requested rows can't be replaced - driver task reads them
+    if(rows[i].state == ROW_EMPTY)
+    {
+      if((lru == nullptr) || (lru->state != ROW_EMPTY)) lru = &rows[i];
+    }
+    else if(rows[i].state == ROW_READY)
+    {
+      if((lru == nullptr) || ((lru->state == ROW_READY) && (use_cnt - rows[i].last_use > use_cnt - lru->last_use))) lru = &rows[i];
+    }
+  }
+
+  // If row not found - request it instead of least recently used row
+  if((row == nullptr) && (lru != nullptr))
+  {
+    row = lru;
+    row->offset = offset;
+    row->size = size;
+    row->state = ROW_REQUESTED;
+    row->last_use = use_cnt;
+    row->file_gen = file_gen;
+    row->redraw = false;
+    // Add row to queue. Queue can't overflow: each row can be in queue once.
+    queue[queue_tail % ASSET_CACHE_ROWS] = row - rows;
+    queue_tail++;
+  }
+
+  return row;
+}
+
+// *****************************************************************************
+// ***   Add area to redraw area   *********************************************
+// *****************************************************************************
+void AssetDrv::AddArea(bool& redraw, int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2,
+                       int32_t line, int32_t start, int32_t end)
+{
+  if(redraw)
+  {
+    if(start < x1) x1 = start;
+    if(end > x2)   x2 = end;
+    if(line < y1)  y1 = line;
+    if(line > y2)  y2 = line;
+  }
+  else
+  {
+    x1 = start;
+    x2 = end;
+    y1 = line;
+    y2 = line;
+    redraw = true;
+  }
+}
+
+// *****************************************************************************
+// ***   Read data from file   *************************************************
+// *****************************************************************************
+Result AssetDrv::ReadFile(uint32_t offset, void* buf, uint32_t size)
+{
+  Result result = Result::ERR_FILE_READ;
+  UINT br = 0U;
+
+  // Set file position and read data
+  if((f_lseek(&file, offset) == FR_OK) && (f_read(&file, buf, size, &br) == FR_OK) && (br == size))
+  {
+    result = Result::RESULT_OK;
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Clear cache   *********************************************************
+// *****************************************************************************
+void AssetDrv::ClearCache(void)
+{
+  Rtos::EnterCriticalSection();
+  for(uint32_t i = 0U; i < ASSET_CACHE_ROWS; i++)
+  {
+    // Requested rows will be cleared by driver task after read
+    if(rows[i].state == ROW_READY)
+    {
+      rows[i].state = ROW_EMPTY;
+    }
+  }
+  // Rows requested before can't be used
+  file_gen++;
+  retry = false;
+  Rtos::ExitCriticalSection();
+}
@@ -0,0 +1,290 @@
+//******************************************************************************
+//  @file AssetDrv.h
+//  @author Nicolai Shlapunov
+//
+//  @details DevCore: Asset Driver Class, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef AssetDrv_h
+#define AssetDrv_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "AppTask.h"
+#include "RtosMutex.h"
+#include "RtosSemaphore.h"
+#include "Image.h"
+#include "fatfs.h"
+
+// *****************************************************************************
+// ***   Asset Driver Class. This class implement reading of assets from pack
+// ***   file on SD card.   ****************************************************
+// *****************************************************************************
+// * Pack file created by Tools/AssetPacker.py. It starts from header: "DBPK"
+// * signature and 32-bit count of assets. Header followed by table of assets:
+// * 16 bytes zero padded name, 32-bit offset and 32-bit size of each asset.
+// * Image asset starts from ImageHeader followed by palette and image lines in
+// * ImageDesc format. All values are little endian.
+// * Rows of streamed images read by driver task to the cache, so display
+// * driver never waits for SD card. Row which isn't in cache yet isn't drawn,
+// * its line redrawn when row is read.
+class AssetDrv : public AppTask
+{
+  public:
+    // *************************************************************************
+    // ***   Image asset header   **********************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Image width and height
+      uint16_t width;
+      uint16_t height;
+      // Bits per pixel, same as in ImageDesc
+      uint8_t bits_per_pixel;
+      // Reserved
+      uint8_t reserved;
+      // Count of colors in palette
+      uint16_t palette_size;
+      // Transparent color (-1 no transparent colors)
+      int32_t transparent_color;
+    } ImageHeader;
+
+    // *************************************************************************
+    // ***   Asset location in pack file   *************************************
+    // *************************************************************************
+    typedef struct
+    {
+      uint32_t offset;
+      uint32_t size;
+    } AssetInfo;
+
+    // *************************************************************************
+    // ***   Row cache statistic   *********************************************
+    // *************************************************************************
+    typedef struct
+    {
+      // Count of rows found in cache when display driver draws them
+      uint32_t hits;
+      // Count of rows which weren't read yet
+      uint32_t misses;
+      // Count of bytes read from SD card
+      uint32_t bytes_read;
+    } Stats;
+
+    // *************************************************************************
+    // ***   Get Instance   ****************************************************
+    // *************************************************************************
+    // * This class is singleton. For use this class you must call GetInstance()
+    // * to receive reference to Asset Driver class
+    static AssetDrv& GetInstance(void);
+
+    // *************************************************************************
+    // ***   Asset Driver Loop   ***********************************************
+    // *************************************************************************
+    virtual Result Loop();
+
+    // *************************************************************************
+    // ***   Open pack file   **************************************************
+    // *************************************************************************
+    // * Mount SD card if it isn't mounted yet and open pack file. Cluster map
+    // * of file created for fast random access if file isn't too fragmented.
+    // * Driver task created when first pack file opened.
+    Result Open(const char* path);
+
+    // *************************************************************************
+    // ***   Close pack file   *************************************************
+    // *************************************************************************
+    // * All objects which use assets must be deleted before close.
+    Result Close(void);
+
+    // *************************************************************************
+    // ***   Find asset   ******************************************************
+    // *************************************************************************
+    Result Find(const char* name, AssetInfo& info);
+
+    // *************************************************************************
+    // ***   Read data from pack file   ****************************************
+    // *************************************************************************
+    // * Blocking read. Shouldn't be used from display driver task.
+    Result Read(uint32_t offset, void* buf, uint32_t size);
+
+    // *************************************************************************
+    // ***   Load image to RAM   ***********************************************
+    // *************************************************************************
+    // * Read palette and image data to buffer and fill image description, so
+    // * image can be used by Image, TiledMap and other objects. Buffer must be
+    // * 16-bit aligned.
+    Result LoadImage(const char* name, ImageDesc& img_dsc, void* buf, uint32_t size);
+
+    // *************************************************************************
+    // ***   Get row from cache   **********************************************
+    // *************************************************************************
+    // * Called by display driver. Returns pointer to row data or nullptr if
+    // * row isn't read yet. In this case row requested and area x1..x2 of line
+    // * will be redrawn when row is read.
+    const uint8_t* GetRow(uint32_t offset, uint32_t size, int32_t line, int32_t x1, int32_t x2);
+
+    // *************************************************************************
+    // ***   Prefetch row   ****************************************************
+    // *************************************************************************
+    // * Request row if it isn't in cache.
+    void Prefetch(uint32_t offset, uint32_t size);
+
+    // *************************************************************************
+    // ***   Get statistic of last frame   *************************************
+    // *************************************************************************
+    void GetFrameStats(Stats& stats);
+
+  private:
+    // Size of cluster link map table for fast seek
+    static const uint32_t CLMT_SIZE = 32U;
+
+    // Signature of pack file
+    static const uint32_t PACK_SIGNATURE = 0x4B504244U; // "DBPK"
+
+    // Max length of asset name
+    static const uint32_t NAME_SIZE = 16U;
+
+    // State of cache row
+    enum RowState
+    {
+      ROW_EMPTY,
+      ROW_REQUESTED,
+      ROW_READY
+    };
+
+    // Row of cache
+    typedef struct
+    {
+      // Offset and size of row in pack file
+      uint32_t offset;
+      uint32_t size;
+      // State of row
+      volatile RowState state;
+      // Value of cache use counter when row was used last time
+      uint32_t last_use;
+      // Generation of file for which row was requested
+      uint32_t file_gen;
+      // Area which should be redrawn when row is read
+      bool redraw;
+      int16_t x1, y1, x2, y2;
+    } CacheRow;
+
+    // *************************************************************************
+    // ***   Find row in cache or request it   *********************************
+    // *************************************************************************
+    // * Must be called inside critical section. Returns nullptr if there are
+    // * no free rows in cache.
+    CacheRow* Request(uint32_t offset, uint32_t size);
+
+    // *************************************************************************
+    // ***   Add area to redraw area   *****************************************
+    // *************************************************************************
+    static void AddArea(bool& redraw, int16_t& x1, int16_t& y1, int16_t& x2, int16_t& y2,
+                        int32_t line, int32_t start, int32_t end);
+
+    // *************************************************************************
+    // ***   Read data from file   *********************************************
+    // *************************************************************************
+    // * File mutex must be taken by caller.
+    Result ReadFile(uint32_t offset, void* buf, uint32_t size);
+
+    // *************************************************************************
+    // ***   Clear cache   *****************************************************
+    // *************************************************************************
+    void ClearCache(void);
+
+    // *************************************************************************
+    // ***   Finish statistic of frame   ***************************************
+    // *************************************************************************
+    // * Called by display driver when frame drawn. Saves statistic of frame
+    // * and starts statistic of next frame.
+    static void FrameDoneCallback(void* ptr);
+
+    // Driver task created
+    bool is_task_created = false;
+
+    // Pack file
+    FIL file;
+    // Cluster link map table
+    DWORD clmt[CLMT_SIZE];
+    // Pack file opened
+    bool is_open = false;
+    // Count of assets in pack file
+    uint32_t assets_cnt = 0U;
+    // Generation of file, changed when file closed
+    uint32_t file_gen = 0U;
+    // Mutex for access to file
+    RtosMutex file_mutex;
+
+    // Rows of cache
+    CacheRow rows[ASSET_CACHE_ROWS];
+    // Data of rows
+    uint8_t rows_data[ASSET_CACHE_ROWS][ASSET_CACHE_ROW_SIZE] __attribute__((aligned(4)));
+    // Cache use counter
+    uint32_t use_cnt = 0U;
+    // Queue of requested rows
+    uint8_t queue[ASSET_CACHE_ROWS];
+    uint32_t queue_head = 0U;
+    volatile uint32_t queue_tail = 0U;
+    // Semaphore for start reading
+    RtosSemaphore rows_requested;
+
+    // Area of lines which weren't requested because cache was full
+    bool retry = false;
+    int16_t retry_x1, retry_y1, retry_x2, retry_y2;
+
+    // Statistic of current and last frames
+    Stats cur_stats = {0U, 0U, 0U};
+    Stats last_stats = {0U, 0U, 0U};
+
+    // *************************************************************************
+    // ** Private constructor. Only GetInstance() allow to access this class. **
+    // *************************************************************************
+    AssetDrv() : AppTask(ASSET_DRV_TASK_STACK_SIZE, ASSET_DRV_TASK_PRIORITY,
+                         "AssetDrv") {};
+};
+
+#endif
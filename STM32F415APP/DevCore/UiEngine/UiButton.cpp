@@ -41,6 +41,8 @@ UiButton::UiButton(const char* str_in, int32_t x, int32_t y, int32_t w, int32_t
 void UiButton::SetParams(const char* str_in, int32_t x, int32_t y, int32_t w, int32_t h,
                          bool is_active)
 {
+  // Old area should be redrawn
+  Invalidate();
   // Clear callback
   callback = nullptr;
   // Save string
@@ -54,10 +56,12 @@ void UiButton::SetParams(const char* str_in, int32_t x, int32_t y, int32_t w, in
   height = h;
   active = is_active;
   // Set box params
-  box.SetParams(x, y, w, h, COLOR_WHITE);
+  box.SetParams(x, y, w, h, CORNER_RADIUS, COLOR_WHITE);
   // Set string params
   string.SetParams(str, x, y, COLOR_WHITE, String::FONT_8x12);
   string.Move((w-string.GetWidth())/2, (h-string.GetHeight())/2, true);
+  // New area should be redrawn
+  Invalidate();
 }
 
 // *************************************************************************
@@ -102,7 +106,7 @@ void UiButton::Action(VisObject::ActionType action, int32_t tx, int32_t ty)
     case VisObject::ACT_TOUCH:  // Fall thru
     case VisObject::ACT_MOVEIN:
       // Set box params
-      box.SetParams(x_start, y_start, width, height, COLOR_WHITE, true);
+      box.SetParams(x_start, y_start, width, height, CORNER_RADIUS, COLOR_WHITE, true);
       // Set string params
       string.SetColor(COLOR_BLACK);
       break;
@@ -117,7 +121,7 @@ void UiButton::Action(VisObject::ActionType action, int32_t tx, int32_t ty)
       // No break here, because other actions the same as Move Out
     case VisObject::ACT_MOVEOUT:
       // Set box params
-      box.SetParams(x_start, y_start, width, height, COLOR_WHITE, false);
+      box.SetParams(x_start, y_start, width, height, CORNER_RADIUS, COLOR_WHITE, false);
       // Set string params
       string.SetColor(COLOR_WHITE);
       break;
@@ -126,4 +130,7 @@ void UiButton::Action(VisObject::ActionType action, int32_t tx, int32_t ty)
     default:
       break;
   }
+  // Box and string isn't in the display list, so button area should be
+  // redrawn by button itself
+  Invalidate();
 }
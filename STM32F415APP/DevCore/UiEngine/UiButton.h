@@ -107,8 +107,10 @@ class UiButton : public VisObject
     uint32_t param = 0U;
     // String pointer
     const char* str = nullptr;
+    // Radius of button corners
+    static const int32_t CORNER_RADIUS = 3;
     // Box for button
-    Box box;
+    RoundRect box;
     // String for button
     String string;
 };
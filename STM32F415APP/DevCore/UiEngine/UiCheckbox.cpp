@@ -51,11 +51,11 @@ void UiCheckbox::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t star
     // Find start x position
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
-    if(end > n) end = n;
+    if(end >= n) end = n - 1;
     if(checked) color = COLOR_YELLOW;
     else           color = COLOR_MAGENTA;
-    // Have sense draw only if end pointer in buffer
-    if(x_end > 0)
+    // Have sense draw only if object in buffer
+    if((start < n) && (end >= 0))
     {
       // If fill or first/last row - must be solid
       if(true || line == y_start || line == y_end)
@@ -86,6 +86,8 @@ void UiCheckbox::Action(VisObject::ActionType action, int32_t tx, int32_t ty)
     case VisObject::ACT_TOUCH:
       // Change checked state
       checked = !checked;
+      // Checkbox should be redrawn
+      Invalidate();
       break;
   
     // Untouch action 
@@ -160,6 +160,8 @@ bool UiMenu::Run(void)
         if(strlen(menu_txt[i]) < (size_t)str_len) menu_txt[i][strlen(menu_txt[i])] = ' ';
         // Set null-terminator at the end
         menu_txt[i][str_len] = '\0';
+        // String content changed - update it
+        menu_str[i]->SetString(menu_txt[i]);
       }
       // Move selection bar
       selection_bar.Move(x_start + String::GetFontW(items_font),
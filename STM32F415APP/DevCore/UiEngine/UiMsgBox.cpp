@@ -186,13 +186,43 @@ void UiMsgBox::Hide(void)
   }
 }
 
+// *****************************************************************************
+// ***   Set MsgBox opacity   **************************************************
+// *****************************************************************************
+void UiMsgBox::SetAlpha(uint8_t alpha)
+{
+  for(uint32_t i = 0; i < box_cnt; i++)
+  {
+    box[i].SetAlpha(alpha);
+  }
+  for(uint32_t i = 0; i < str_cnt; i++)
+  {
+    string[i].SetAlpha(alpha);
+  }
+}
+
 // *****************************************************************************
 // ***   Show and Hide Msg box after pause   ***********************************
 // *****************************************************************************
-void UiMsgBox::Run(uint32_t delay)
+void UiMsgBox::Run(uint32_t delay, uint32_t fade_ms)
 {
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  const uint32_t start_ms = RtosTick::GetTimeMs();
+  uint32_t elapsed_ms = 0U;
+  // Fade in is part of delay
+  if(fade_ms > delay) fade_ms = delay;
+  SetAlpha((fade_ms != 0U) ? 0U : 255U);
   Show();
-  DisplayDrv::GetInstance().UpdateDisplay();
-  RtosTick::DelayMs(delay);
+  // Alpha of each frame calculated from time of fade in
+  while(elapsed_ms < fade_ms)
+  {
+    SetAlpha((255U * elapsed_ms) / fade_ms);
+    display_drv.UpdateDisplay();
+    display_drv.WaitForFrameDone(fade_ms - elapsed_ms);
+    elapsed_ms = RtosTick::GetTimeMs() - start_ms;
+  }
+  SetAlpha(255U);
+  display_drv.UpdateDisplay();
+  if(elapsed_ms < delay) RtosTick::DelayMs(delay - elapsed_ms);
   Hide();
 }
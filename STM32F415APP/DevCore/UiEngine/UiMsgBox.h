@@ -88,10 +88,19 @@ class UiMsgBox
     // *************************************************************************
     void Hide(void);
 
+    // *************************************************************************
+    // ***   Public: Set MsgBox opacity   **************************************
+    // *************************************************************************
+    void SetAlpha(uint8_t alpha);
+
     // *************************************************************************
     // ***   Public: Run MsgBox   **********************************************
     // *************************************************************************
-    void Run(uint32_t delay);
+    // * MsgBox stays on screen for delay ms and disappears. If fade_ms isn't 0,
+    // * MsgBox fades in during first fade_ms of delay. Each frame of fade in
+    // * drawn as soon as display driver can, so fade doesn't depend on frame
+    // * rate and doesn't make delay longer.
+    void Run(uint32_t delay, uint32_t fade_ms = 0U);
 
   private:
     // Max allowed menu items on the screen
@@ -35,6 +35,8 @@ UiScroll::UiScroll(int32_t x, int32_t y, int32_t w, int32_t h, int32_t n, int32_
 void UiScroll::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, int32_t n, int32_t bar,
                          bool is_vertical, bool is_has_buttons, bool is_active)
 {
+  // Old area should be redrawn
+  Invalidate();
   // General params
   x_start = x;
   y_start = y;
@@ -68,6 +70,8 @@ void UiScroll::SetParams(int32_t x, int32_t y, int32_t w, int32_t h, int32_t n,
   bar_len   = (total_len * bar_cnt) / total_cnt;   // Bar length
   if(bar_len == 0) bar_len = 1; // Bar height can't be less than 1
   empty_len = total_len - bar_len; // Empty length available for bar moving
+  // New area should be redrawn
+  Invalidate();
 }
 
 // *****************************************************************************
@@ -87,10 +91,10 @@ void UiScroll::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_
     // Find start x position
     int32_t end = x_end - start_x;
     // Prevent buffer overflow
-    if(end > n) end = n;
+    if(end >= n) end = n - 1;
 
-    // Have sense draw only if end pointer in buffer
-    if(x_end > 0)
+    // Have sense draw only if object in buffer
+    if((start < n) && (end >= 0))
     {
       // Draw border of scroll
       if((line == y_start) || (line == y_end))
@@ -104,12 +108,14 @@ void UiScroll::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_
       }
       else
       {
-        if(x_start >= 0) buf[x_start] = color;
-        if(x_end   <  n) buf[x_end]   = color;
+        if(x_start - start_x >= 0) buf[x_start - start_x] = color;
+        if(x_end   - start_x <  n) buf[x_end   - start_x] = color;
         if(has_buttons && !vertical)
         {
-          if(x_start + height >= 0) buf[x_start + height] = color;
-          if(x_end   - height <  n) buf[x_end   - height] = color;
+          int32_t btn_start = x_start + height - start_x;
+          int32_t btn_end   = x_end   - height - start_x;
+          if((btn_start >= 0) && (btn_start < n)) buf[btn_start] = color;
+          if((btn_end   >= 0) && (btn_end   < n)) buf[btn_end]   = color;
         }
       }
       // Find start of bar position
@@ -122,18 +128,21 @@ void UiScroll::DrawInBufW(uint16_t* buf, int32_t n, int32_t line, int32_t start_
         // Draw bar line
         if((line >= bar_start) && (line < bar_start + bar_len))
         {
-          for(int32_t i = start+1; i <= end-1; i++) buf[i] = COLOR_MAGENTA;
+          // Skip border pixels only if it in buffer
+          int32_t bar_x1 = (x_start - start_x >= 0) ? start + 1 : start;
+          int32_t bar_x2 = (x_end - start_x < n) ? end - 1 : end;
+          for(int32_t i = bar_x1; i <= bar_x2; i++) buf[i] = COLOR_MAGENTA;
         }
       }
       else
       {
         if((line != y_start) && (line != y_end))
         {
-          bar_start += x_start;
+          bar_start += x_start - start_x;
+          // Find end x position
+          int32_t bar_end = bar_start + bar_len;
           // Prevent write in memory before buffer
           if(bar_start < 0) bar_start = 0;
-          // Find start x position
-          int32_t bar_end = bar_start + bar_len;
           // Prevent buffer overflow
           if(bar_end > n) bar_end = n;
           // Draw line
@@ -157,6 +166,8 @@ void UiScroll::DrawInBufH(uint16_t* buf, int32_t n, int32_t row, int32_t start_y
 // *****************************************************************************
 void UiScroll::Action(VisObject::ActionType action, int32_t tx, int32_t ty)
 {
+  // Scroll should be redrawn
+  Invalidate();
   // Switch for process action
   switch(action)
   {
@@ -87,7 +87,7 @@ class UiScroll : public VisObject
     // *************************************************************************
     // ***   Return End Y coordinate   *****************************************
     // *************************************************************************
-    void SetScrollPos(int32_t pos) {cnt = pos;};
+    void SetScrollPos(int32_t pos) {if(cnt != pos) {cnt = pos; Invalidate();}};
 
     // *************************************************************************
     // ***   Put line in buffer   **********************************************
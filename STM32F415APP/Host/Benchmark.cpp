@@ -0,0 +1,343 @@
+//******************************************************************************
+//  @file Benchmark.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Compositor benchmark - runs applications with host display
+//           and reports frame compose time
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+// Standard headers first: DevCfg.h declares allocation operators without
+// exception specification
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "HostRtos.h"
+#include "HostBoard.h"
+#include "HostDisplay.h"
+#include "DisplayDrv.h"
+#include "InputDrv.h"
+#include "SoundDrv.h"
+#include "AssetDrv.h"
+#include "UiMenu.h"
+#include "GraphDemo.h"
+#include "Gario.h"
+#include "Tetris.h"
+#include "DisplayTest.h"
+
+// *****************************************************************************
+// ***   Scene description   ***************************************************
+// *****************************************************************************
+typedef struct
+{
+  // Scene name for command line and report
+  const char* name;
+  // Application function, runs until stopped
+  void (*Run)(void);
+  // Input script, called every tick with ticks from scene start
+  void (*Input)(uint32_t tick);
+} Scene;
+
+// *****************************************************************************
+// ***   Frame statistic   *****************************************************
+// *****************************************************************************
+typedef struct
+{
+  uint32_t frames;
+  uint64_t total_ns;
+  uint64_t max_ns;
+  uint64_t lines;
+  uint64_t pixels;
+} Stats;
+
+// *****************************************************************************
+// ***   Benchmark state   *****************************************************
+// *****************************************************************************
+// Max virtual time of scene - scene stopped if it doesn't draw enough frames
+static const uint32_t MAX_SCENE_TICKS = 600000U;
+
+static HostDisplay host_display;
+static const Scene* scene = nullptr;
+static uint32_t scene_start_tick = 0U;
+static uint32_t target_frames = 100U;
+static Stats stats;
+
+// *****************************************************************************
+// ***   Scenes   **************************************************************
+// *****************************************************************************
+static void RunGraphDemo(void)
+{
+  GraphDemo::GetInstance().Loop();
+}
+
+static void RunGario(void)
+{
+  Gario::GetInstance().Loop();
+}
+
+static void InputGario(uint32_t tick)
+{
+  // Run right and jump every two seconds
+  HostBoard::PressButton(InputDrv::EXT_LEFT, InputDrv::BTN_RIGHT, true);
+  HostBoard::PressButton(InputDrv::EXT_RIGHT, InputDrv::BTN_DOWN, (tick % 2000U) < 300U);
+}
+
+static void RunTetris(void)
+{
+  Tetris::GetInstance().Loop();
+}
+
+static void InputTetris(uint32_t tick)
+{
+  // Move shape left and right
+  HostBoard::PressButton(InputDrv::EXT_LEFT, InputDrv::BTN_LEFT, (tick % 1000U) < 50U);
+  HostBoard::PressButton(InputDrv::EXT_LEFT, InputDrv::BTN_RIGHT, ((tick + 500U) % 1000U) < 50U);
+}
+
+static char* GetMenuStr(void* ptr, char* buf, uint32_t n, uint32_t add_param)
+{
+  snprintf(buf, n, "%lu", (unsigned long)add_param);
+  return buf;
+}
+
+static void RunUiMenu(void)
+{
+  // Same items as in main menu of application
+  UiMenu::MenuItem items[] =
+  {{"Tetris",          nullptr, &GetMenuStr, nullptr, 1},
+   {"Pong",            nullptr, &GetMenuStr, nullptr, 2},
+   {"Gario",           nullptr, &GetMenuStr, nullptr, 3},
+   {"Calc",            nullptr, &GetMenuStr, nullptr, 4},
+   {"Graphic demo",    nullptr, &GetMenuStr, nullptr, 5},
+   {"Input test",      nullptr, &GetMenuStr, nullptr, 6},
+   {"SD write test",   nullptr, &GetMenuStr, nullptr, 7},
+   {"USB test",        nullptr, &GetMenuStr, nullptr, 8},
+   {"Servo test",      nullptr, &GetMenuStr, nullptr, 9},
+   {"Touch calibrate", nullptr, &GetMenuStr, nullptr, 10},
+   {"I2C Ping",        nullptr, &GetMenuStr, nullptr, 11},
+   {"Display test",    nullptr, &GetMenuStr, nullptr, 12},
+   {"Blit benchmark",  nullptr, &GetMenuStr, nullptr, 13}};
+  UiMenu menu("Main Menu", items, NumberOf(items));
+  // Menu returns when item selected or menu closed - run it again
+  while(true) menu.Run();
+}
+
+static void InputUiMenu(uint32_t tick)
+{
+  // Scroll menu down
+  HostBoard::PressButton(InputDrv::EXT_LEFT, InputDrv::BTN_DOWN, (tick % 300U) < 50U);
+}
+
+static void RunSpriteDemo(void)
+{
+  DisplayTest::GetInstance().SpriteDemo();
+}
+
+static void RunTextDemo(void)
+{
+  DisplayTest::GetInstance().TextDemo();
+}
+
+static const Scene scenes[] =
+{
+  {"graph_demo",  RunGraphDemo,  nullptr},
+  {"gario",       RunGario,      InputGario},
+  {"tetris",      RunTetris,     InputTetris},
+  {"ui_menu",     RunUiMenu,     InputUiMenu},
+  {"sprite_demo", RunSpriteDemo, nullptr},
+  {"text_demo",   RunTextDemo,   nullptr}
+};
+
+// *****************************************************************************
+// ***   Background: input script and input driver   ***************************
+// *****************************************************************************
+static void InputTask(void* ptr)
+{
+  if(scene->Input != nullptr)
+  {
+    scene->Input(HostRtos::GetTickCount() - scene_start_tick);
+  }
+  InputDrv::GetInstance().Loop();
+}
+
+// *****************************************************************************
+// ***   Background: display driver   ******************************************
+// *****************************************************************************
+static void DisplayTask(void* ptr)
+{
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  // Display task would block on mutex locked by application task
+  if(HostRtos::GetAppMutexCnt() == 0U)
+  {
+    uint32_t frame = display_drv.GetFrameCnt();
+    host_display.ResetStats();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    display_drv.Loop();
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    // Count only iterations which drew frame
+    if(display_drv.GetFrameCnt() != frame)
+    {
+      stats.frames++;
+      stats.total_ns += ns;
+      if(ns > stats.max_ns) stats.max_ns = ns;
+      stats.lines += host_display.GetLinesWritten();
+      stats.pixels += host_display.GetPixelsWritten();
+    }
+  }
+  // Stop scene when enough frames drawn or it takes too long
+  if(   (stats.frames >= target_frames)
+     || (HostRtos::GetTickCount() - scene_start_tick >= MAX_SCENE_TICKS))
+  {
+    HostRtos::RequestStop();
+  }
+}
+
+// *****************************************************************************
+// ***   Background: asset driver   ********************************************
+// *****************************************************************************
+static void AssetTask(void* ptr)
+{
+  AssetDrv::GetInstance().Loop();
+}
+
+// *****************************************************************************
+// ***   Init drivers the same way as AppMain does   ***************************
+// *****************************************************************************
+static void InitDrivers(void)
+{
+  DisplayDrv::GetInstance().SetDisplay(host_display);
+  DisplayDrv::GetInstance().InitTask();
+  InputDrv::GetInstance().InitTask(nullptr, &hadc2);
+  SoundDrv::GetInstance().InitTask(&htim4);
+  // Tasks Setup() called by task function on target
+  DisplayDrv::GetInstance().Setup();
+  InputDrv::GetInstance().Setup();
+  SoundDrv::GetInstance().Setup();
+  // Sound task isn't run: host has no speaker
+  HostRtos::AddBackground(InputTask, nullptr);
+  HostRtos::AddBackground(AssetTask, nullptr);
+  HostRtos::AddBackground(DisplayTask, nullptr);
+}
+
+// *****************************************************************************
+// ***   Run scene and print result   ******************************************
+// *****************************************************************************
+static void RunScene(const Scene& s, const char* ppm_dir)
+{
+  scene = &s;
+  InitDrivers();
+  // Don't count first frame: it clears whole screen
+  DisplayDrv::GetInstance().UpdateDisplay();
+  HostRtos::Delay(1U);
+  stats = Stats();
+  scene_start_tick = HostRtos::GetTickCount();
+  try
+  {
+    s.Run();
+  }
+  catch(HostRtos::Stop&)
+  {
+  }
+  uint32_t frames = (stats.frames != 0U) ? stats.frames : 1U;
+  uint64_t lines = (stats.lines != 0U) ? stats.lines : 1U;
+  // One JSON object per line
+  printf("{\"scene\": \"%s\", \"frames\": %lu, \"virtual_ms\": %lu, "
+         "\"avg_frame_us\": %.2f, \"max_frame_us\": %.2f, "
+         "\"avg_line_ns\": %.1f, \"avg_lines\": %.1f, \"avg_pixels\": %.1f}\n",
+         s.name, (unsigned long)stats.frames,
+         (unsigned long)(HostRtos::GetTickCount() - scene_start_tick),
+         stats.total_ns / 1000.0 / frames, stats.max_ns / 1000.0,
+         (double)stats.total_ns / lines, (double)stats.lines / frames,
+         (double)stats.pixels / frames);
+  fflush(stdout);
+  // Dump last frame
+  if(ppm_dir != nullptr)
+  {
+    char file_name[256];
+    snprintf(file_name, sizeof(file_name), "%s/%s.ppm", ppm_dir, s.name);
+    if(host_display.DumpPpm(file_name).IsBad())
+    {
+      fprintf(stderr, "Can't write %s\n", file_name);
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+int main(int argc, char* argv[])
+{
+  const char* ppm_dir = nullptr;
+  const char* scene_names[NumberOf(scenes)];
+  uint32_t scenes_cnt = 0U;
+  int result = 0;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+    {
+      target_frames = strtoul(argv[++i], nullptr, 10);
+    }
+    else if((strcmp(argv[i], "--ppm") == 0) && (i + 1 < argc))
+    {
+      ppm_dir = argv[++i];
+    }
+    else if((argv[i][0] != '-') && (scenes_cnt < NumberOf(scene_names)))
+    {
+      scene_names[scenes_cnt++] = argv[i];
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [--frames N] [--ppm DIR] [scene...]\nScenes:", argv[0]);
+      for(uint32_t s = 0U; s < NumberOf(scenes); s++) fprintf(stderr, " %s", scenes[s].name);
+      fprintf(stderr, "\n");
+      return 2;
+    }
+  }
+
+  for(uint32_t s = 0U; s < NumberOf(scenes); s++)
+  {
+    bool is_selected = (scenes_cnt == 0U);
+    for(uint32_t i = 0U; i < scenes_cnt; i++)
+    {
+      if(strcmp(scene_names[i], scenes[s].name) == 0) is_selected = true;
+    }
+    if(is_selected)
+    {
+      // Drivers and applications are singletons with state, so each scene
+      // runs in own process
+      pid_t pid = fork();
+      if(pid == 0)
+      {
+        RunScene(scenes[s], ppm_dir);
+        // Singletons never destroyed on target and their destructors can't
+        // run in any order - leave without them
+        _exit(stats.frames >= target_frames ? 0 : 1);
+      }
+      int status = 1;
+      if((pid < 0) || (waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+      {
+        fprintf(stderr, "Scene %s failed\n", scenes[s].name);
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
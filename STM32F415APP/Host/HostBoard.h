@@ -0,0 +1,98 @@
+//******************************************************************************
+//  @file HostBoard.h
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Virtual board state for host build, header
+//
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef HostBoard_h
+#define HostBoard_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "InputDrv.h"
+
+// *****************************************************************************
+// ***   Host Board Class   ****************************************************
+// *****************************************************************************
+// * State of input pins read by HAL_GPIO_ReadPin() stand-in. All pins are high
+// * by default: buttons aren't pressed, touchscreen isn't touched and input
+// * driver detects buttons on both ports.
+class HostBoard
+{
+  public:
+    // *************************************************************************
+    // ***   Public: SetPin   **************************************************
+    // *************************************************************************
+    static void SetPin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state);
+
+    // *************************************************************************
+    // ***   Public: GetPin   **************************************************
+    // *************************************************************************
+    static GPIO_PinState GetPin(GPIO_TypeDef* port, uint16_t pin);
+
+    // *************************************************************************
+    // ***   Public: PressButton   *********************************************
+    // *************************************************************************
+    // * Buttons connected to EXT port pins and pull it low when pressed.
+    static void PressButton(InputDrv::PortType port, InputDrv::ButtonType button, bool is_pressed);
+
+    // *************************************************************************
+    // ***   Public: ReleaseAll   **********************************************
+    // *************************************************************************
+    static void ReleaseAll(void);
+
+  private:
+    // Max count of pins with low state
+    static const uint32_t MAX_LOW_PINS = 16U;
+
+    // Pins with low state
+    static GPIO_TypeDef* low_ports[MAX_LOW_PINS];
+    static uint16_t low_pins[MAX_LOW_PINS];
+    static uint32_t low_cnt;
+};
+
+#endif
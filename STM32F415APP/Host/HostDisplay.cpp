@@ -0,0 +1,240 @@
+//******************************************************************************
+//  @file HostDisplay.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Display stand-in for host build, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "HostDisplay.h"
+
+#include <cstdio>
+
+// *****************************************************************************
+// ***   Defines   *************************************************************
+// *****************************************************************************
+
+// ILI9341 commands decoded by host display
+#define CMD_CASET      0x2A // Column Address Set
+#define CMD_PASET      0x2B // Page Address Set
+#define CMD_RAMWR      0x2C // Memory Write
+
+// *****************************************************************************
+// ***   Public: Init   ********************************************************
+// *****************************************************************************
+Result HostDisplay::Init()
+{
+  // Clear display memory
+  for(uint32_t i = 0U; i < NumberOf(fb); i++) fb[i] = 0U;
+  // Reset scroll and statistics
+  scroll_offset = 0U;
+  ResetStats();
+  // No errors to return
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Public: SetRotation   *************************************************
+// *****************************************************************************
+void HostDisplay::SetRotation(uint8_t r)
+{
+  rotation = r % 4U;
+  // Long side is horizontal for rotation 1 and 3
+  if((rotation == 1U) || (rotation == 3U))
+  {
+    width = HOST_WIDTH;
+    height = HOST_HEIGHT;
+  }
+  else
+  {
+    width = HOST_HEIGHT;
+    height = HOST_WIDTH;
+  }
+  commands_cnt++;
+}
+
+// *****************************************************************************
+// ***   Public: SetAddrWindow   ***********************************************
+// *****************************************************************************
+void HostDisplay::SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  // Same bytes as ILI9341 sends
+  uint8_t caset[] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t paset[] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
+  ProcessCommand(CMD_CASET, caset, sizeof(caset));
+  ProcessCommand(CMD_PASET, paset, sizeof(paset));
+  ProcessCommand(CMD_RAMWR, nullptr, 0U);
+}
+
+// *****************************************************************************
+// ***   Public: WriteDataStream   *********************************************
+// *****************************************************************************
+void HostDisplay::WriteDataStream(uint8_t* data, uint32_t n)
+{
+  for(uint32_t i = 0U; i < n; i++)
+  {
+    if(has_byte_hi)
+    {
+      // Display receives MSB first
+      WritePixel((uint16_t)((byte_hi << 8) | data[i]));
+      has_byte_hi = false;
+    }
+    else
+    {
+      byte_hi = data[i];
+      has_byte_hi = true;
+    }
+  }
+  // Transfer complete
+  if(callback != nullptr)
+  {
+    callback(callback_ptr);
+  }
+}
+
+// *****************************************************************************
+// ***   Public: FillRect   ****************************************************
+// *****************************************************************************
+void HostDisplay::FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if((x >= width) || (y >= height)) return;
+  if((x + w - 1) >= width)  w = width  - x;
+  if((y + h - 1) >= height) h = height - y;
+
+  SetAddrWindow(x, y, x+w-1, y+h-1);
+
+  // Color sent in 16-bit SPI mode
+  for(int32_t i = 0; i < w * h; i++) WritePixel(color);
+}
+
+// *****************************************************************************
+// ***   Public: SetScrollOffset   *********************************************
+// *****************************************************************************
+void HostDisplay::SetScrollOffset(uint16_t offset)
+{
+  scroll_offset = offset % HOST_WIDTH;
+  commands_cnt++;
+}
+
+// *****************************************************************************
+// ***   Public: GetPixel   ****************************************************
+// *****************************************************************************
+uint16_t HostDisplay::GetPixel(int32_t x, int32_t y)
+{
+  uint16_t color = 0U;
+  if((x >= 0) && (x < width) && (y >= 0) && (y < height))
+  {
+    // Hardware scroll moves display memory along long side
+    if(width > height) x = (x + scroll_offset) % width;
+    else               y = (y + scroll_offset) % height;
+    color = fb[y * width + x];
+  }
+  return color;
+}
+
+// *****************************************************************************
+// ***   Public: DumpPpm   *****************************************************
+// *****************************************************************************
+Result HostDisplay::DumpPpm(const char* file_name)
+{
+  Result result = Result::ERR_NULL_PTR;
+
+  FILE* f = nullptr;
+  if(file_name != nullptr)
+  {
+    f = fopen(file_name, "wb");
+    result = (f != nullptr) ? Result::RESULT_OK : Result::ERR_FILE_OPEN;
+  }
+  if(f != nullptr)
+  {
+    fprintf(f, "P6\n%ld %ld\n255\n", (long)width, (long)height);
+    for(int32_t y = 0; y < height; y++)
+    {
+      for(int32_t x = 0; x < width; x++)
+      {
+        uint16_t c = GetPixel(x, y);
+        // Expand RGB565 to RGB888
+        uint8_t rgb[3] = {(uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+                          (uint8_t)(((c >>  5) & 0x3F) * 255 / 63),
+                          (uint8_t)(( c        & 0x1F) * 255 / 31)};
+        if(fwrite(rgb, sizeof(rgb), 1U, f) != 1U)
+        {
+          result = Result::ERR_FILE_WRITE;
+        }
+      }
+    }
+    fclose(f);
+  }
+
+  return result;
+}
+
+// *****************************************************************************
+// ***   Private: ProcessCommand   *********************************************
+// *****************************************************************************
+void HostDisplay::ProcessCommand(uint8_t cmd, const uint8_t* data, uint32_t n)
+{
+  switch(cmd)
+  {
+    case CMD_CASET:
+      if(n >= 4U)
+      {
+        win_x0 = (data[0] << 8) | data[1];
+        win_x1 = (data[2] << 8) | data[3];
+      }
+      break;
+
+    case CMD_PASET:
+      if(n >= 4U)
+      {
+        win_y0 = (data[0] << 8) | data[1];
+        win_y1 = (data[2] << 8) | data[3];
+      }
+      break;
+
+    case CMD_RAMWR:
+      // Start write from window corner
+      cur_x = win_x0;
+      cur_y = win_y0;
+      has_byte_hi = false;
+      break;
+
+    default:
+      break;
+  }
+  commands_cnt++;
+}
+
+// *****************************************************************************
+// ***   Private: WritePixel   *************************************************
+// *****************************************************************************
+void HostDisplay::WritePixel(uint16_t color)
+{
+  // Display ignores pixels outside memory
+  if((cur_x < width) && (cur_y < height))
+  {
+    fb[cur_y * width + cur_x] = color;
+  }
+  pixels_written++;
+  // Next pixel in window, wrap to the window start after last pixel
+  cur_x++;
+  if(cur_x > win_x1)
+  {
+    lines_written++;
+    cur_x = win_x0;
+    cur_y++;
+    if(cur_y > win_y1) cur_y = win_y0;
+  }
+}
@@ -0,0 +1,207 @@
+//******************************************************************************
+//  @file HostDisplay.h
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Display stand-in for host build, header
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef HostDisplay_h
+#define HostDisplay_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+#include "IDisplay.h"
+
+// *****************************************************************************
+// ***   Host Display Class   **************************************************
+// *****************************************************************************
+// * Stand-in for ILI9341 without hardware. It decodes CASET/PASET/RAMWR
+// * commands and pixel stream into RGB565 framebuffer, so DisplayDrv output
+// * can be checked and dumped to PPM file on PC. Transfers complete
+// * immediately and callback called from WriteDataStream().
+class HostDisplay : public IDisplay
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Constructor   *********************************************
+    // *************************************************************************
+    explicit HostDisplay() {};
+
+    // *************************************************************************
+    // ***   Public: Destructor   **********************************************
+    // *************************************************************************
+    ~HostDisplay() {};
+
+    // *************************************************************************
+    // ***   Public: Init   ****************************************************
+    // *************************************************************************
+    virtual Result Init();
+
+    // *************************************************************************
+    // ***   Public: SetRotation   *********************************************
+    // *************************************************************************
+    virtual void SetRotation(uint8_t r);
+
+    // *************************************************************************
+    // ***   Public: GetWidth   ************************************************
+    // *************************************************************************
+    virtual int32_t GetWidth(void) {return width;}
+
+    // *************************************************************************
+    // ***   Public: GetHeight   ***********************************************
+    // *************************************************************************
+    virtual int32_t GetHeight(void) {return height;}
+
+    // *************************************************************************
+    // ***   Public: GetBytesPerPixel   ****************************************
+    // *************************************************************************
+    virtual int32_t GetBytesPerPixel(void) {return HOST_BPP;}
+
+    // *************************************************************************
+    // ***   Public: SetAddrWindow   *******************************************
+    // *************************************************************************
+    virtual void SetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+    // *************************************************************************
+    // ***   Public: WriteDataStream   *****************************************
+    // *************************************************************************
+    virtual void WriteDataStream(uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Public: FillRect   ************************************************
+    // *************************************************************************
+    virtual void FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    // *************************************************************************
+    // ***   Public: SetScrollOffset   *****************************************
+    // *************************************************************************
+    virtual void SetScrollOffset(uint16_t offset);
+
+    // *************************************************************************
+    // ***   Public: GetPixel   ************************************************
+    // *************************************************************************
+    // * Return RGB565 color of pixel visible on screen(scroll offset applied).
+    uint16_t GetPixel(int32_t x, int32_t y);
+
+    // *************************************************************************
+    // ***   Public: DumpPpm   *************************************************
+    // *************************************************************************
+    // * Write visible screen content to binary PPM(P6) file.
+    Result DumpPpm(const char* file_name);
+
+    // *************************************************************************
+    // ***   Public: GetPixelsWritten   ****************************************
+    // *************************************************************************
+    // * Count of pixels written since last ResetStats() call.
+    inline uint32_t GetPixelsWritten(void) {return pixels_written;}
+
+    // *************************************************************************
+    // ***   Public: GetCommandsCnt   ******************************************
+    // *************************************************************************
+    // * Count of commands received since last ResetStats() call.
+    inline uint32_t GetCommandsCnt(void) {return commands_cnt;}
+
+    // *************************************************************************
+    // ***   Public: GetLinesWritten   *****************************************
+    // *************************************************************************
+    // * Count of window lines written since last ResetStats() call.
+    inline uint32_t GetLinesWritten(void) {return lines_written;}
+
+    // *************************************************************************
+    // ***   Public: ResetStats   **********************************************
+    // *************************************************************************
+    void ResetStats(void) {pixels_written = 0U; lines_written = 0U; commands_cnt = 0U;}
+
+  private:
+    // Display width
+    static const int32_t HOST_WIDTH = 320;
+    // Display height
+    static const int32_t HOST_HEIGHT = 240;
+    // Display byte per pixel
+    static const int32_t HOST_BPP = 2;
+
+    // Framebuffer in display memory coordinates
+    uint16_t fb[HOST_WIDTH * HOST_HEIGHT] = {0U};
+
+    // Width and height for current rotation
+    int32_t width = HOST_WIDTH;
+    int32_t height = HOST_HEIGHT;
+    // Rotation
+    uint8_t rotation = 0U;
+    // Scroll offset along long side
+    uint16_t scroll_offset = 0U;
+
+    // Address window
+    uint16_t win_x0 = 0U, win_y0 = 0U, win_x1 = 0U, win_y1 = 0U;
+    // Current write position in window
+    uint16_t cur_x = 0U, cur_y = 0U;
+    // First byte of pixel if stream was split in the middle of pixel
+    uint8_t byte_hi = 0U;
+    bool has_byte_hi = false;
+
+    // Statistics
+    uint32_t pixels_written = 0U;
+    uint32_t lines_written = 0U;
+    uint32_t commands_cnt = 0U;
+
+    // *************************************************************************
+    // ***   Private: ProcessCommand   *****************************************
+    // *************************************************************************
+    // * Decode command with data bytes the same way as ILI9341 does.
+    void ProcessCommand(uint8_t cmd, const uint8_t* data, uint32_t n);
+
+    // *************************************************************************
+    // ***   Private: WritePixel   *********************************************
+    // *************************************************************************
+    // * Write pixel to current position in window and advance position.
+    void WritePixel(uint16_t color);
+
+    // *************************************************************************
+    // ***   Private: Constructors and assign operator - prevent copying   *****
+    // *************************************************************************
+    HostDisplay(const HostDisplay&);
+};
+
+#endif
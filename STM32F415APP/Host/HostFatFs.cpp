@@ -0,0 +1,146 @@
+//******************************************************************************
+//  @file HostFatFs.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Host: FatFs stand-in for host build, files opened from current
+//           directory
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "fatfs.h"
+
+#include <cstdio>
+
+// *****************************************************************************
+// ***   FatFs objects of SD card   ********************************************
+// *****************************************************************************
+uint8_t retSD;
+char SDPath[4] = "0:/";
+FATFS SDFatFS;
+FIL SDFile;
+
+// *****************************************************************************
+// ***   Host files of FatFs file objects   ************************************
+// *****************************************************************************
+static const uint32_t MAX_FILES = 4U;
+static FIL* fils[MAX_FILES];
+static FILE* files[MAX_FILES];
+
+// *****************************************************************************
+// ***   Find host file of FatFs file object   *********************************
+// *****************************************************************************
+static FILE* GetFile(FIL* fp)
+{
+  FILE* f = nullptr;
+  for(uint32_t i = 0U; i < MAX_FILES; i++)
+  {
+    if(fils[i] == fp) f = files[i];
+  }
+  return f;
+}
+
+// *****************************************************************************
+// ***   f_mount   *************************************************************
+// *****************************************************************************
+FRESULT f_mount(FATFS* fs, const TCHAR* path, BYTE opt)
+{
+  fs->fs_type = FS_FAT32;
+  return FR_OK;
+}
+
+// *****************************************************************************
+// ***   f_open   **************************************************************
+// *****************************************************************************
+// * Only read is supported.
+FRESULT f_open(FIL* fp, const TCHAR* path, BYTE mode)
+{
+  FRESULT result = FR_TOO_MANY_OPEN_FILES;
+  uint32_t i = 0U;
+  while((i < MAX_FILES) && (fils[i] != nullptr)) i++;
+  if(i < MAX_FILES)
+  {
+    files[i] = fopen(path, "rb");
+    if(files[i] == nullptr)
+    {
+      result = FR_NO_FILE;
+    }
+    else
+    {
+      fils[i] = fp;
+      fp->fptr = 0U;
+      fp->cltbl = nullptr;
+      fseek(files[i], 0, SEEK_END);
+      fp->obj.objsize = ftell(files[i]);
+      fseek(files[i], 0, SEEK_SET);
+      result = FR_OK;
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   f_close   *************************************************************
+// *****************************************************************************
+FRESULT f_close(FIL* fp)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+  for(uint32_t i = 0U; i < MAX_FILES; i++)
+  {
+    if(fils[i] == fp)
+    {
+      fclose(files[i]);
+      fils[i] = nullptr;
+      files[i] = nullptr;
+      result = FR_OK;
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   f_read   **************************************************************
+// *****************************************************************************
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+  FILE* f = GetFile(fp);
+  if(f != nullptr)
+  {
+    *br = fread(buff, 1U, btr, f);
+    fp->fptr += *br;
+    result = ferror(f) ? FR_DISK_ERR : FR_OK;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   f_lseek   *************************************************************
+// *****************************************************************************
+FRESULT f_lseek(FIL* fp, FSIZE_t ofs)
+{
+  FRESULT result = FR_INVALID_OBJECT;
+  FILE* f = GetFile(fp);
+  // Host file doesn't need cluster link map
+  if(ofs == CREATE_LINKMAP)
+  {
+    result = FR_INT_ERR;
+  }
+  else if(f != nullptr)
+  {
+    result = (fseek(f, ofs, SEEK_SET) == 0) ? FR_OK : FR_DISK_ERR;
+    fp->fptr = ofs;
+  }
+  return result;
+}
@@ -0,0 +1,248 @@
+//******************************************************************************
+//  @file HostHal.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Host: HAL stand-ins and peripheral handles for host build
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "HostBoard.h"
+#include "HostRtos.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// *****************************************************************************
+// ***   Peripheral registers   ************************************************
+// *****************************************************************************
+// * Drivers change some registers directly, so handles point to memory.
+static SPI_TypeDef host_spi1;
+static DMA_Stream_TypeDef host_dma_spi1_tx;
+static DMA_HandleTypeDef host_hdma_spi1_tx = {&host_dma_spi1_tx};
+static TIM_TypeDef host_tim4;
+// ADC conversion always complete
+static ADC_TypeDef host_adc2 = {ADC_FLAG_JEOC};
+
+// *****************************************************************************
+// ***   Peripheral handles   **************************************************
+// *****************************************************************************
+SPI_HandleTypeDef hspi1 = {&host_spi1};
+TIM_HandleTypeDef htim4 = {&host_tim4};
+ADC_HandleTypeDef hadc2 = {&host_adc2};
+I2C_HandleTypeDef hi2c1 = {nullptr};
+
+// *****************************************************************************
+// ***   Static initialization of handles   ************************************
+// *****************************************************************************
+static struct HostHalInit
+{
+  HostHalInit()
+  {
+    hspi1.hdmatx = &host_hdma_spi1_tx;
+    hspi1.State = HAL_SPI_STATE_READY;
+  }
+} host_hal_init;
+
+// *****************************************************************************
+// ***   HostBoard: Static variables   *****************************************
+// *****************************************************************************
+GPIO_TypeDef* HostBoard::low_ports[MAX_LOW_PINS];
+uint16_t HostBoard::low_pins[MAX_LOW_PINS];
+uint32_t HostBoard::low_cnt = 0U;
+
+// *****************************************************************************
+// ***   HostBoard: SetPin   ***************************************************
+// *****************************************************************************
+void HostBoard::SetPin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state)
+{
+  uint32_t i = 0U;
+  while((i < low_cnt) && ((low_ports[i] != port) || (low_pins[i] != pin))) i++;
+  if((state == GPIO_PIN_RESET) && (i == low_cnt) && (low_cnt < MAX_LOW_PINS))
+  {
+    low_ports[low_cnt] = port;
+    low_pins[low_cnt] = pin;
+    low_cnt++;
+  }
+  if((state == GPIO_PIN_SET) && (i < low_cnt))
+  {
+    low_cnt--;
+    low_ports[i] = low_ports[low_cnt];
+    low_pins[i] = low_pins[low_cnt];
+  }
+}
+
+// *****************************************************************************
+// ***   HostBoard: GetPin   ***************************************************
+// *****************************************************************************
+GPIO_PinState HostBoard::GetPin(GPIO_TypeDef* port, uint16_t pin)
+{
+  GPIO_PinState state = GPIO_PIN_SET;
+  for(uint32_t i = 0U; i < low_cnt; i++)
+  {
+    if((low_ports[i] == port) && ((low_pins[i] & pin) != 0U)) state = GPIO_PIN_RESET;
+  }
+  return state;
+}
+
+// *****************************************************************************
+// ***   HostBoard: PressButton   **********************************************
+// *****************************************************************************
+void HostBoard::PressButton(InputDrv::PortType port, InputDrv::ButtonType button, bool is_pressed)
+{
+  // Same pins as in InputDrv buttons profile
+  static GPIO_TypeDef* const ports[InputDrv::EXT_MAX][InputDrv::BTN_MAX] =
+  {
+    {EXT_L1_GPIO_Port, EXT_L2_GPIO_Port, EXT_L3_GPIO_Port, EXT_L4_GPIO_Port},
+    {EXT_R1_GPIO_Port, EXT_R2_GPIO_Port, EXT_R3_GPIO_Port, EXT_R4_GPIO_Port}
+  };
+  static const uint16_t pins[InputDrv::EXT_MAX][InputDrv::BTN_MAX] =
+  {
+    {EXT_L1_Pin, EXT_L2_Pin, EXT_L3_Pin, EXT_L4_Pin},
+    {EXT_R1_Pin, EXT_R2_Pin, EXT_R3_Pin, EXT_R4_Pin}
+  };
+  SetPin(ports[port][button], pins[port][button], is_pressed ? GPIO_PIN_RESET : GPIO_PIN_SET);
+}
+
+// *****************************************************************************
+// ***   HostBoard: ReleaseAll   ***********************************************
+// *****************************************************************************
+void HostBoard::ReleaseAll(void)
+{
+  low_cnt = 0U;
+}
+
+// *****************************************************************************
+// ***   HAL: Ticks   **********************************************************
+// *****************************************************************************
+extern "C" uint32_t HAL_GetTick(void)
+{
+  return HostRtos::GetTickCount();
+}
+
+extern "C" void HAL_Delay(uint32_t delay)
+{
+  HostRtos::Delay(delay);
+}
+
+extern "C" void _Error_Handler(char* file, int line)
+{
+  fprintf(stderr, "Error_Handler: %s:%d\n", file, line);
+  abort();
+}
+
+// *****************************************************************************
+// ***   HAL: GPIO   ***********************************************************
+// *****************************************************************************
+extern "C" void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init)
+{
+}
+
+extern "C" GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+  return HostBoard::GetPin(GPIOx, GPIO_Pin);
+}
+
+extern "C" void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+}
+
+// *****************************************************************************
+// ***   HAL: SPI   ************************************************************
+// *****************************************************************************
+// * Only touchscreen and ILI9341 use SPI. Host display doesn't need it and
+// * touchscreen isn't touched, so transfers complete immediately.
+extern "C" HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout)
+{
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout)
+{
+  memset(pData, 0, Size);
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef* hspi, uint8_t* pTxData, uint8_t* pRxData, uint16_t Size, uint32_t Timeout)
+{
+  memset(pRxData, 0, Size);
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size)
+{
+  HAL_SPI_TxCpltCallback(hspi);
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef* hspi)
+{
+  return HAL_OK;
+}
+
+// *****************************************************************************
+// ***   HAL: TIM   ************************************************************
+// *****************************************************************************
+extern "C" HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef* htim)
+{
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_TIM_OC_Start(TIM_HandleTypeDef* htim, uint32_t Channel)
+{
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_TIM_OC_Stop(TIM_HandleTypeDef* htim, uint32_t Channel)
+{
+  return HAL_OK;
+}
+
+// *****************************************************************************
+// ***   HAL: RCC   ************************************************************
+// *****************************************************************************
+extern "C" uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+  return 168000000U;
+}
+
+// *****************************************************************************
+// ***   HAL: ADC   ************************************************************
+// *****************************************************************************
+// * Joysticks aren't connected: ADC returns zero.
+extern "C" HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef* hadc)
+{
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_ADCEx_InjectedStart(ADC_HandleTypeDef* hadc)
+{
+  return HAL_OK;
+}
+
+extern "C" HAL_StatusTypeDef HAL_ADCEx_InjectedStop(ADC_HandleTypeDef* hadc)
+{
+  return HAL_OK;
+}
+
+extern "C" uint32_t HAL_ADCEx_InjectedGetValue(ADC_HandleTypeDef* hadc, uint32_t InjectedRank)
+{
+  return 0U;
+}
+
+extern "C" HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef* hadc, ADC_InjectionConfTypeDef* sConfigInjected)
+{
+  return HAL_OK;
+}
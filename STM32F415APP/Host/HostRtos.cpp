@@ -0,0 +1,561 @@
+//******************************************************************************
+//  @file HostRtos.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Cooperative scheduler and FreeRTOS wrapper classes for host
+//           build, implementation
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+// Standard headers first: DevCfg.h declares allocation operators without
+// exception specification
+#include <cstring>
+#include <stdexcept>
+
+#include "HostRtos.h"
+#include "Rtos.h"
+
+// *****************************************************************************
+// ***   Static variables   ****************************************************
+// *****************************************************************************
+HostRtos::BackgroundFunction* HostRtos::functions[MAX_BACKGROUND];
+void* HostRtos::function_ptrs[MAX_BACKGROUND];
+uint32_t HostRtos::functions_cnt = 0U;
+TickType_t HostRtos::tick_cnt = 0U;
+bool HostRtos::in_background = false;
+bool HostRtos::is_stop = false;
+uint32_t HostRtos::app_mutex_cnt = 0U;
+
+// *****************************************************************************
+// ***   Host objects behind FreeRTOS handles   ********************************
+// *****************************************************************************
+struct HostSemaphore
+{
+  bool is_given;
+  bool is_locked;
+  bool is_app_owner;
+};
+
+struct HostQueue
+{
+  uint8_t* buf;
+  uint32_t len;
+  uint32_t item_size;
+  uint32_t head;
+  uint32_t cnt;
+};
+
+struct HostTimer
+{
+  bool is_active;
+};
+
+// *****************************************************************************
+// ***   Public: AddBackground   ***********************************************
+// *****************************************************************************
+void HostRtos::AddBackground(BackgroundFunction& function, void* ptr)
+{
+  if(functions_cnt < MAX_BACKGROUND)
+  {
+    functions[functions_cnt] = &function;
+    function_ptrs[functions_cnt] = ptr;
+    functions_cnt++;
+  }
+}
+
+// *****************************************************************************
+// ***   Public: ClearBackground   *********************************************
+// *****************************************************************************
+void HostRtos::ClearBackground(void)
+{
+  functions_cnt = 0U;
+  is_stop = false;
+}
+
+// *****************************************************************************
+// ***   Public: RequestStop   *************************************************
+// *****************************************************************************
+void HostRtos::RequestStop(void)
+{
+  is_stop = true;
+}
+
+// *****************************************************************************
+// ***   Public: Tick   ********************************************************
+// *****************************************************************************
+void HostRtos::Tick(void)
+{
+  // Background functions called once per tick, so delays in them ignored
+  if(in_background == false)
+  {
+    in_background = true;
+    for(uint32_t i = 0U; i < functions_cnt; i++)
+    {
+      functions[i](function_ptrs[i]);
+    }
+    in_background = false;
+    tick_cnt++;
+    // Unwind application task. Mutexes locked by application task would
+    // stay locked, so wait until they released.
+    if(is_stop && (app_mutex_cnt == 0U))
+    {
+      is_stop = false;
+      throw Stop();
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Public: Wait   ********************************************************
+// *****************************************************************************
+bool HostRtos::Wait(ReadyFunction& ready, void* ptr, TickType_t ticks)
+{
+  TickType_t start = tick_cnt;
+  bool result = ready(ptr);
+  // Background function can't wait
+  if(in_background == false)
+  {
+    while((result == false) && ((ticks == portMAX_DELAY) || (tick_cnt - start < ticks)))
+    {
+      Tick();
+      result = ready(ptr);
+    }
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Public: Delay   *******************************************************
+// *****************************************************************************
+void HostRtos::Delay(TickType_t ticks)
+{
+  for(TickType_t i = 0U; i < ticks; i++)
+  {
+    Tick();
+  }
+}
+
+// *****************************************************************************
+// ***   Rtos: TaskCreate   ****************************************************
+// *****************************************************************************
+Result Rtos::TaskCreate(TaskFunction& function, const char* task_name,
+                        const uint16_t stack_depth, void* param_ptr,
+                        uint8_t priority)
+{
+  // Host build can't run task function with endless loop, so task only
+  // accepted. Task Loop() should be added by HostRtos::AddBackground().
+  return Result::RESULT_OK;
+}
+
+// *****************************************************************************
+// ***   Rtos: TaskDelete   ****************************************************
+// *****************************************************************************
+void Rtos::TaskDelete(TaskHandle_t task)
+{
+}
+
+// *****************************************************************************
+// ***   Rtos: Task notifications   ********************************************
+// *****************************************************************************
+// * Only application task can block, so only it can wait for notification.
+static uint32_t app_notify_value = 0U;
+
+static bool IsNotified(void* ptr)
+{
+  return *(uint32_t*)ptr != 0U;
+}
+
+TaskHandle_t Rtos::GetCurrentTask()
+{
+  return &app_notify_value;
+}
+
+void Rtos::TaskNotifyGive(TaskHandle_t task)
+{
+  (*(uint32_t*)task)++;
+}
+
+Result Rtos::TaskNotifyTake(TickType_t ticks_to_wait)
+{
+  Result result = Result::ERR_TASK_NOTIFY_TAKE;
+  if(HostRtos::Wait(IsNotified, &app_notify_value, ticks_to_wait))
+  {
+    app_notify_value = 0U;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   Rtos: Determine whether we are in thread mode or handler mode   *******
+// *****************************************************************************
+bool Rtos::IsInHandlerMode(void)
+{
+  return false;
+}
+
+// *****************************************************************************
+// ***   Rtos: Scheduler and critical sections   *******************************
+// *****************************************************************************
+// * Only one thread - nothing to protect.
+void Rtos::SuspendScheduler() {}
+void Rtos::ResumeScheduler() {}
+void Rtos::EnterCriticalSection() {}
+void Rtos::ExitCriticalSection() {}
+void Rtos::DisableInterrupts() {}
+void Rtos::EnableInterrupts() {}
+
+// *****************************************************************************
+// ***   RtosTick: Ticks and time   ********************************************
+// *****************************************************************************
+uint32_t RtosTick::GetTickCount()
+{
+  return HostRtos::GetTickCount();
+}
+
+uint32_t RtosTick::GetTimeMs()
+{
+  return TicksToMs(HostRtos::GetTickCount());
+}
+
+uint32_t RtosTick::MsToTicks(uint32_t time_ms)
+{
+  return(time_ms * portTICK_PERIOD_MS);
+}
+
+uint32_t RtosTick::TicksToMs(uint32_t ticks)
+{
+  return(ticks / portTICK_PERIOD_MS);
+}
+
+// *****************************************************************************
+// ***   RtosTick: Delays   ****************************************************
+// *****************************************************************************
+void RtosTick::DelayTicks(uint32_t ticks)
+{
+  HostRtos::Delay(ticks);
+}
+
+void RtosTick::DelayMs(uint32_t time_ms)
+{
+  HostRtos::Delay(MsToTicks(time_ms));
+}
+
+void RtosTick::DelayUntilTicks(uint32_t& last_wake_ticks, uint32_t ticks)
+{
+  // Same as vTaskDelayUntil(): don't wait if wake time already passed
+  uint32_t wake_ticks = last_wake_ticks + ticks;
+  int32_t left = (int32_t)(wake_ticks - HostRtos::GetTickCount());
+  if(left > 0)
+  {
+    HostRtos::Delay(left);
+  }
+  last_wake_ticks = wake_ticks;
+}
+
+void RtosTick::DelayUntilMs(uint32_t& last_wake_ticks, uint32_t time_ms)
+{
+  DelayUntilTicks(last_wake_ticks, MsToTicks(time_ms));
+}
+
+// *****************************************************************************
+// ***   RtosSemaphore   *******************************************************
+// *****************************************************************************
+static bool IsSemaphoreGiven(void* ptr)
+{
+  return ((HostSemaphore*)ptr)->is_given;
+}
+
+RtosSemaphore::RtosSemaphore()
+{
+  // Binary semaphore created empty
+  semaphore = new HostSemaphore {false, false, false};
+}
+
+RtosSemaphore::~RtosSemaphore()
+{
+  delete (HostSemaphore*)semaphore;
+}
+
+Result RtosSemaphore::Take(TickType_t ticks_to_wait)
+{
+  Result result = Result::ERR_SEMAPHORE_TAKE;
+  HostSemaphore* sem = (HostSemaphore*)semaphore;
+  if(HostRtos::Wait(IsSemaphoreGiven, sem, ticks_to_wait))
+  {
+    sem->is_given = false;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosSemaphore::Give()
+{
+  Result result = Result::ERR_SEMAPHORE_GIVE;
+  HostSemaphore* sem = (HostSemaphore*)semaphore;
+  if(sem->is_given == false)
+  {
+    sem->is_given = true;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   RtosMutex   ***********************************************************
+// *****************************************************************************
+static bool IsMutexFree(void* ptr)
+{
+  return !((HostSemaphore*)ptr)->is_locked;
+}
+
+RtosMutex::RtosMutex()
+{
+  mutex = new HostSemaphore {false, false, false};
+}
+
+RtosMutex::~RtosMutex()
+{
+  delete (HostSemaphore*)mutex;
+}
+
+Result RtosMutex::Lock(TickType_t ticks_to_wait)
+{
+  Result result = Result::ERR_MUTEX_LOCK;
+  HostSemaphore* mtx = (HostSemaphore*)mutex;
+  // Only background functions run while application task waits, but they
+  // can't release mutex locked by application task
+  if(mtx->is_locked && mtx->is_app_owner && !HostRtos::IsInBackground())
+  {
+    throw std::logic_error("RtosMutex: deadlock");
+  }
+  if(HostRtos::Wait(IsMutexFree, mtx, ticks_to_wait))
+  {
+    mtx->is_locked = true;
+    mtx->is_app_owner = !HostRtos::IsInBackground();
+    if(mtx->is_app_owner) HostRtos::MutexLocked();
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosMutex::Release()
+{
+  Result result = Result::ERR_MUTEX_RELEASE;
+  HostSemaphore* mtx = (HostSemaphore*)mutex;
+  if(mtx->is_locked)
+  {
+    if(mtx->is_app_owner) HostRtos::MutexReleased();
+    mtx->is_locked = false;
+    mtx->is_app_owner = false;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   RtosQueue   ***********************************************************
+// *****************************************************************************
+static bool IsQueueNotEmpty(void* ptr)
+{
+  return ((HostQueue*)ptr)->cnt != 0U;
+}
+
+static bool IsQueueNotFull(void* ptr)
+{
+  return ((HostQueue*)ptr)->cnt < ((HostQueue*)ptr)->len;
+}
+
+RtosQueue::RtosQueue(uint32_t q_len, uint32_t itm_size, const char* queue_name)
+   : queue(nullptr), queue_len(q_len), item_size(itm_size)
+{
+  SetName(queue_name);
+}
+
+RtosQueue::~RtosQueue()
+{
+  if(queue != nullptr)
+  {
+    delete[] ((HostQueue*)queue)->buf;
+    delete (HostQueue*)queue;
+  }
+}
+
+void RtosQueue::SetName(const char* name, const char* add_name)
+{
+  queue_name[0] = '\0';
+  if(name != nullptr) strncat(queue_name, name, MAX_QUEUE_NAME_LEN - 1U);
+  if(add_name != nullptr) strncat(queue_name, add_name, MAX_QUEUE_NAME_LEN - 1U - strlen(queue_name));
+}
+
+Result RtosQueue::Create()
+{
+  Result result = Result::ERR_QUEUE_CREATE;
+  if(queue == nullptr)
+  {
+    queue = new HostQueue {new uint8_t[queue_len * item_size], queue_len, item_size, 0U, 0U};
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosQueue::Reset()
+{
+  Result result = Result::ERR_QUEUE_RESET;
+  if(queue != nullptr)
+  {
+    ((HostQueue*)queue)->cnt = 0U;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+bool RtosQueue::IsEmpty() const
+{
+  return (queue != nullptr) && (((HostQueue*)queue)->cnt == 0U);
+}
+
+bool RtosQueue::IsFull() const
+{
+  return (queue != nullptr) && (((HostQueue*)queue)->cnt >= queue_len);
+}
+
+Result RtosQueue::GetMessagesWaiting(uint32_t& msg_cnt) const
+{
+  Result result = Result::ERR_QUEUE_GENERAL;
+  if(queue != nullptr)
+  {
+    msg_cnt = ((HostQueue*)queue)->cnt;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosQueue::SendToBack(const void* item, uint32_t timeout_ms)
+{
+  Result result = Result::ERR_QUEUE_WRITE;
+  HostQueue* q = (HostQueue*)queue;
+  if((q != nullptr) && (item != nullptr) && HostRtos::Wait(IsQueueNotFull, q, RtosTick::MsToTicks(timeout_ms)))
+  {
+    memcpy(&q->buf[((q->head + q->cnt) % q->len) * q->item_size], item, q->item_size);
+    q->cnt++;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosQueue::SendToFront(const void* item, uint32_t timeout_ms)
+{
+  Result result = Result::ERR_QUEUE_WRITE;
+  HostQueue* q = (HostQueue*)queue;
+  if((q != nullptr) && (item != nullptr) && HostRtos::Wait(IsQueueNotFull, q, RtosTick::MsToTicks(timeout_ms)))
+  {
+    q->head = (q->head + q->len - 1U) % q->len;
+    memcpy(&q->buf[q->head * q->item_size], item, q->item_size);
+    q->cnt++;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosQueue::Receive(void* item, uint32_t timeout_ms)
+{
+  Result result = Result::ERR_QUEUE_READ;
+  HostQueue* q = (HostQueue*)queue;
+  if((q != nullptr) && (item != nullptr) && HostRtos::Wait(IsQueueNotEmpty, q, RtosTick::MsToTicks(timeout_ms)))
+  {
+    memcpy(item, &q->buf[q->head * q->item_size], q->item_size);
+    q->head = (q->head + 1U) % q->len;
+    q->cnt--;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosQueue::Peek(void* item, uint32_t timeout_ms) const
+{
+  Result result = Result::ERR_QUEUE_READ;
+  HostQueue* q = (HostQueue*)queue;
+  if((q != nullptr) && (item != nullptr) && HostRtos::Wait(IsQueueNotEmpty, q, RtosTick::MsToTicks(timeout_ms)))
+  {
+    memcpy(item, &q->buf[q->head * q->item_size], q->item_size);
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+// *****************************************************************************
+// ***   RtosTimer   ***********************************************************
+// *****************************************************************************
+// * Timers only keep state - host build doesn't run tasks which use them.
+RtosTimer::~RtosTimer()
+{
+  delete (HostTimer*)timer;
+}
+
+Result RtosTimer::Create()
+{
+  if(timer == nullptr) timer = new HostTimer {false};
+  return Result::RESULT_OK;
+}
+
+bool RtosTimer::IsActive() const
+{
+  return (timer != nullptr) && ((HostTimer*)timer)->is_active;
+}
+
+Result RtosTimer::Start(uint32_t timeout_ms)
+{
+  Result result = Result::ERR_TIMER_START;
+  if(timer != nullptr)
+  {
+    ((HostTimer*)timer)->is_active = true;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosTimer::Stop(uint32_t timeout_ms)
+{
+  Result result = Result::ERR_TIMER_STOP;
+  if(timer != nullptr)
+  {
+    ((HostTimer*)timer)->is_active = false;
+    result = Result::RESULT_OK;
+  }
+  return result;
+}
+
+Result RtosTimer::UpdatePeriod(uint32_t new_period_ms, uint32_t timeout_ms)
+{
+  timer_period_ms = new_period_ms;
+  return (timer != nullptr) ? Result::RESULT_OK : Result::ERR_TIMER_UPDATE;
+}
+
+Result RtosTimer::StartWithNewPeriod(uint32_t new_period_ms, uint32_t timeout_ms)
+{
+  Result result = UpdatePeriod(new_period_ms, timeout_ms);
+  if(result.IsGood()) result = Start(timeout_ms);
+  return result;
+}
+
+Result RtosTimer::Reset(uint32_t timeout_ms)
+{
+  return Start(timeout_ms);
+}
+
+void RtosTimer::CallbackFunction(TimerHandle_t timer_handle)
+{
+}
@@ -0,0 +1,151 @@
+//******************************************************************************
+//  @file HostRtos.h
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Cooperative scheduler for host build, header
+//
+//
+//  @section LICENSE
+//
+//   Software License Agreement (Modified BSD License)
+//
+//   Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//   All rights reserved.
+//
+//   Redistribution and use in source and binary forms, with or without
+//   modification, are permitted provided that the following conditions are met:
+//
+//   1. Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//   2. Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//   3. Neither the name of the Devtronic nor the names of its contributors
+//      may be used to endorse or promote products derived from this software
+//      without specific prior written permission.
+//   4. Redistribution and use of this software other than as permitted under
+//      this license is void and will automatically terminate your rights under
+//      this license.
+//
+//   THIS SOFTWARE IS PROVIDED BY DEVTRONIC ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+//   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//   IN NO EVENT SHALL DEVTRONIC BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+//   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+//   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+#ifndef HostRtos_h
+#define HostRtos_h
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+#include "DevCfg.h"
+
+// *****************************************************************************
+// ***   Host Rtos Class   *****************************************************
+// *****************************************************************************
+// * Host build runs application in one thread. Tick is virtual and advanced
+// * only when application task blocks: each tick all background functions
+// * (Loop() of driver tasks) are called once. Background functions can't
+// * block - any wait which can't be satisfied immediately fails and delays
+// * are ignored.
+class HostRtos
+{
+  public:
+    // *************************************************************************
+    // ***   Public: Function types   ******************************************
+    // *************************************************************************
+    typedef void (BackgroundFunction)(void* ptr);
+    typedef bool (ReadyFunction)(void* ptr);
+
+    // *************************************************************************
+    // ***   Public: Stop exception   ******************************************
+    // *************************************************************************
+    // * Thrown from blocking call of application task after RequestStop().
+    struct Stop {};
+
+    // *************************************************************************
+    // ***   Public: AddBackground   *******************************************
+    // *************************************************************************
+    static void AddBackground(BackgroundFunction& function, void* ptr);
+
+    // *************************************************************************
+    // ***   Public: ClearBackground   *****************************************
+    // *************************************************************************
+    static void ClearBackground(void);
+
+    // *************************************************************************
+    // ***   Public: RequestStop   *********************************************
+    // *************************************************************************
+    // * Stop exception will be thrown when application task blocks next time
+    // * and doesn't hold any mutex.
+    static void RequestStop(void);
+
+    // *************************************************************************
+    // ***   Public: Tick   ****************************************************
+    // *************************************************************************
+    // * Call background functions and advance tick counter.
+    static void Tick(void);
+
+    // *************************************************************************
+    // ***   Public: Wait   ****************************************************
+    // *************************************************************************
+    // * Run ticks until ready() returns true or timeout expired. Returns
+    // * result of last ready() call.
+    static bool Wait(ReadyFunction& ready, void* ptr, TickType_t ticks);
+
+    // *************************************************************************
+    // ***   Public: Delay   ***************************************************
+    // *************************************************************************
+    static void Delay(TickType_t ticks);
+
+    // *************************************************************************
+    // ***   Public: GetTickCount   ********************************************
+    // *************************************************************************
+    static inline TickType_t GetTickCount(void) {return tick_cnt;}
+
+    // *************************************************************************
+    // ***   Public: IsInBackground   ******************************************
+    // *************************************************************************
+    static inline bool IsInBackground(void) {return in_background;}
+
+    // *************************************************************************
+    // ***   Public: Mutex locked by application task   ************************
+    // *************************************************************************
+    static void MutexLocked(void) {app_mutex_cnt++;}
+    static void MutexReleased(void) {app_mutex_cnt--;}
+    static inline uint32_t GetAppMutexCnt(void) {return app_mutex_cnt;}
+
+  private:
+    // Max count of background functions
+    static const uint32_t MAX_BACKGROUND = 8U;
+
+    // Background functions
+    static BackgroundFunction* functions[MAX_BACKGROUND];
+    static void* function_ptrs[MAX_BACKGROUND];
+    static uint32_t functions_cnt;
+
+    // Virtual tick counter
+    static TickType_t tick_cnt;
+    // Background functions are running
+    static bool in_background;
+    // Stop requested
+    static bool is_stop;
+    // Count of mutexes locked by application task
+    static uint32_t app_mutex_cnt;
+};
+
+#endif
@@ -0,0 +1,146 @@
+//******************************************************************************
+//  @file LzTestImage.h
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Raw images for LZ round-trip test. Build compresses them by
+//           Tools/LzConverter.py, test decodes rows by LzDecoder.
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// 40x12 16-bit image: gradients, runs, repeated pattern and noise
+const uint16_t lz_test_image16[] = {
+  0x0000, 0x1001, 0x2002, 0x3003, 0x4004, 0x5005, 0x6006, 0x7007, 0x8008, 0x9009,
+  0xA00A, 0xB00B, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0,
+  0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0xA5CD, 0x4D3C, 0xCA26, 0x18B8, 0x2516, 0x3031, 0xBB3B, 0x1DB2,
+  0x00A1, 0x10A2, 0x20A3, 0x30A4, 0x40A5, 0x50A6, 0x60A7, 0x70A8, 0x80A9, 0x90AA,
+  0xA0AB, 0xB0AC, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x6DEC, 0x1332, 0x2C01, 0xDE06, 0xD61A, 0x23C4, 0x7B38, 0x2E71,
+  0x0142, 0x1143, 0x2144, 0x3145, 0x4146, 0x5147, 0x6148, 0x7149, 0x814A, 0x914B,
+  0xA14C, 0xB14D, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0,
+  0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0xD95A, 0x1E43, 0x3F62, 0x724C, 0x1FAC, 0xCB19, 0x1963, 0x7131,
+  0x01E3, 0x11E4, 0x21E5, 0x31E6, 0x41E7, 0x51E8, 0x61E9, 0x71EA, 0x81EB, 0x91EC,
+  0xA1ED, 0xB1EE, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x17D9, 0x442F, 0x9447, 0xD699, 0x49DB, 0x3C4F, 0x9DF1, 0x5C88,
+  0x0284, 0x1285, 0x2286, 0x3287, 0x4288, 0x5289, 0x628A, 0x728B, 0x828C, 0x928D,
+  0xA28E, 0xB28F, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0,
+  0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x34C3, 0x6030, 0xBEAA, 0x31E2, 0x2025, 0x1E84, 0x6973, 0xFE2A,
+  0x0325, 0x1326, 0x2327, 0x3328, 0x4329, 0x532A, 0x632B, 0x732C, 0x832D, 0x932E,
+  0xA32F, 0xB330, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0xDAED, 0xA0D7, 0xEE63, 0xE807, 0xB921, 0x997B, 0x7F31, 0x5C0A,
+  0x03C6, 0x13C7, 0x23C8, 0x33C9, 0x43CA, 0x53CB, 0x63CC, 0x73CD, 0x83CE, 0x93CF,
+  0xA3D0, 0xB3D1, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0,
+  0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x7CFA, 0x29E8, 0x99BA, 0xFD7F, 0xAFDC, 0xE5CD, 0x936C, 0x257A,
+  0x0467, 0x1468, 0x2469, 0x346A, 0x446B, 0x546C, 0x646D, 0x746E, 0x846F, 0x9470,
+  0xA471, 0xB472, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x3C73, 0xD614, 0x5475, 0xAF21, 0x4DD0, 0xFA59, 0xD7E8, 0x1412,
+  0x0508, 0x1509, 0x250A, 0x350B, 0x450C, 0x550D, 0x650E, 0x750F, 0x8510, 0x9511,
+  0xA512, 0xB513, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0,
+  0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x27BD, 0xA0A3, 0xAE24, 0xB34A, 0xFE4C, 0xE993, 0x2334, 0x2FEB,
+  0x05A9, 0x15AA, 0x25AB, 0x35AC, 0x45AD, 0x55AE, 0x65AF, 0x75B0, 0x85B1, 0x95B2,
+  0xA5B3, 0xB5B4, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x8A35, 0xF2BD, 0x2147, 0x1F10, 0x9E84, 0xE42B, 0x91B6, 0xC586,
+  0x064A, 0x164B, 0x264C, 0x364D, 0x464E, 0x564F, 0x6650, 0x7651, 0x8652, 0x9653,
+  0xA654, 0xB655, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x07E0,
+  0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0xB1AA, 0x0B8D, 0xEC63, 0xB5FF, 0x560A, 0x3BF3, 0xFCC5, 0x1E2F,
+  0x06EB, 0x16EC, 0x26ED, 0x36EE, 0x46EF, 0x56F0, 0x66F1, 0x76F2, 0x86F3, 0x96F4,
+  0xA6F5, 0xB6F6, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0xF800, 0xF800, 0xF800, 0x001F, 0xFFFF, 0x1234, 0x001F, 0xFFFF, 0x1234,
+  0x001F, 0xFFFF, 0x6FB8, 0x932A, 0x4238, 0x7EC7, 0xCBB9, 0xC82A, 0xFE36, 0x2941};
+
+// 300x4 8-bit image: literals, long runs and matches with distance > 256
+const uint8_t lz_test_image8[] = {
+  0xE7, 0xEE, 0xE7, 0x61, 0x5E, 0xF3, 0x5F, 0x30, 0xE4, 0x9B, 0x48, 0x2E, 0x15, 0xCA, 0xE7, 0x50,
+  0x07, 0x20, 0x1E, 0x12, 0x61, 0x7B, 0x0F, 0xED, 0xA7, 0xE1, 0x64, 0x77, 0x96, 0xFF, 0x02, 0x2B,
+  0xEA, 0x8E, 0xD0, 0x2A, 0x82, 0xA1, 0x75, 0x93, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6, 0xED, 0xF4, 0xFB, 0x02, 0x09,
+  0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56, 0x5D, 0x64, 0x6B, 0x72, 0x79,
+  0x80, 0x87, 0x8E, 0x95, 0x9C, 0xA3, 0xAA, 0xB1, 0xB8, 0xBF, 0xC6, 0xCD, 0xD4, 0xDB, 0xE2, 0xE9,
+  0xF0, 0xF7, 0xFE, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59,
+  0x60, 0x67, 0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9,
+  0xD0, 0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39,
+  0x40, 0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x5F, 0x30, 0xE4, 0x9B, 0x48, 0x2E, 0x15,
+  0xCA, 0xE7, 0x50, 0x07, 0x20, 0x1E, 0x12, 0x61, 0x7B, 0x0F, 0xED, 0xA7, 0x0F, 0x23, 0x37, 0xCD,
+  0x37, 0x94, 0xC5, 0x22, 0x08, 0x00, 0x6D, 0x6B, 0x1A, 0xF0, 0xC0, 0xCB, 0xD6, 0x25, 0x65, 0x8A,
+  0xAC, 0x2C, 0x9F, 0xAA, 0x07, 0xD1, 0x3C, 0x44, 0x7E, 0x33, 0x05, 0x1E, 0xEE, 0xF9, 0x5A, 0x60,
+  0xE5, 0x61, 0x43, 0xD6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03, 0x0A, 0x11, 0x18, 0x1F, 0x26,
+  0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73, 0x7A, 0x81, 0x88, 0x8F, 0x96,
+  0x9D, 0xA4, 0xAB, 0xB2, 0xB9, 0xC0, 0xC7, 0xCE, 0xD5, 0xDC, 0xE3, 0xEA, 0xF1, 0xF8, 0xFF, 0x06,
+  0x0D, 0x14, 0x1B, 0x22, 0x29, 0x30, 0x37, 0x3E, 0x45, 0x4C, 0x53, 0x5A, 0x61, 0x68, 0x6F, 0x76,
+  0x7D, 0x84, 0x8B, 0x92, 0x99, 0xA0, 0xA7, 0xAE, 0xB5, 0xBC, 0xC3, 0xCA, 0xD1, 0xD8, 0xDF, 0xE6,
+  0xED, 0xF4, 0xFB, 0x02, 0x09, 0x10, 0x17, 0x1E, 0x25, 0x2C, 0x33, 0x3A, 0x41, 0x48, 0x4F, 0x56,
+  0x5D, 0x64, 0x6B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x94, 0xC5, 0x22, 0x08, 0x00, 0x6D, 0x6B, 0x1A, 0xF0, 0xC0, 0xCB, 0xD6,
+  0x25, 0x65, 0x8A, 0xAC, 0x2C, 0x9F, 0xAA, 0x07, 0xC4, 0x3B, 0xCA, 0xD7, 0x6C, 0x00, 0x8A, 0x9B,
+  0x0A, 0x6B, 0x5F, 0xC9, 0x33, 0x15, 0x4A, 0x6D, 0xE2, 0x84, 0x04, 0xA8, 0x97, 0xC5, 0x25, 0x26,
+  0x2E, 0x6A, 0x7C, 0x07, 0xBC, 0xBE, 0xE8, 0x41, 0xF7, 0x45, 0xC5, 0x5D, 0x4E, 0x9F, 0x74, 0x7F,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xBE, 0xC5, 0xCC, 0xD3,
+  0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B, 0x12, 0x19, 0x20, 0x27, 0x2E, 0x35, 0x3C, 0x43,
+  0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x7B, 0x82, 0x89, 0x90, 0x97, 0x9E, 0xA5, 0xAC, 0xB3,
+  0xBA, 0xC1, 0xC8, 0xCF, 0xD6, 0xDD, 0xE4, 0xEB, 0xF2, 0xF9, 0x00, 0x07, 0x0E, 0x15, 0x1C, 0x23,
+  0x2A, 0x31, 0x38, 0x3F, 0x46, 0x4D, 0x54, 0x5B, 0x62, 0x69, 0x70, 0x77, 0x7E, 0x85, 0x8C, 0x93,
+  0x9A, 0xA1, 0xA8, 0xAF, 0xB6, 0xBD, 0xC4, 0xCB, 0xD2, 0xD9, 0xE0, 0xE7, 0xEE, 0xF5, 0xFC, 0x03,
+  0x0A, 0x11, 0x18, 0x1F, 0x26, 0x2D, 0x34, 0x3B, 0x42, 0x49, 0x50, 0x57, 0x5E, 0x65, 0x6C, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8A, 0x9B, 0x0A, 0x6B, 0x5F, 0xC9, 0x33, 0x15, 0x4A, 0x6D, 0xE2, 0x84, 0x04, 0xA8, 0x97,
+  0xC5, 0x25, 0x26, 0x2E, 0x61, 0x51, 0x64, 0xC6, 0xF7, 0x28, 0xD7, 0x18, 0x35, 0x37, 0x13, 0x82,
+  0x7A, 0xC8, 0x83, 0xD7, 0xFB, 0x96, 0x59, 0x23, 0x40, 0x74, 0xF5, 0x25, 0x8F, 0x6C, 0x68, 0x08,
+  0x23, 0x89, 0xD2, 0xE4, 0x7F, 0x1E, 0x17, 0x5A, 0x90, 0xBC, 0x43, 0x2F, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xBF, 0xC6, 0xCD, 0xD4, 0xDB, 0xE2, 0xE9, 0xF0,
+  0xF7, 0xFE, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60,
+  0x67, 0x6E, 0x75, 0x7C, 0x83, 0x8A, 0x91, 0x98, 0x9F, 0xA6, 0xAD, 0xB4, 0xBB, 0xC2, 0xC9, 0xD0,
+  0xD7, 0xDE, 0xE5, 0xEC, 0xF3, 0xFA, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x24, 0x2B, 0x32, 0x39, 0x40,
+  0x47, 0x4E, 0x55, 0x5C, 0x63, 0x6A, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x94, 0x9B, 0xA2, 0xA9, 0xB0,
+  0xB7, 0xBE, 0xC5, 0xCC, 0xD3, 0xDA, 0xE1, 0xE8, 0xEF, 0xF6, 0xFD, 0x04, 0x0B, 0x12, 0x19, 0x20,
+  0x27, 0x2E, 0x35, 0x3C, 0x43, 0x4A, 0x51, 0x58, 0x5F, 0x66, 0x6D, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xD7, 0x18, 0x35,
+  0x37, 0x13, 0x82, 0x7A, 0xC8, 0x83, 0xD7, 0xFB, 0x96, 0x59, 0x23, 0x40, 0x74, 0xF5, 0x25, 0x8F};
@@ -0,0 +1,987 @@
+//******************************************************************************
+//  @file Tests.cpp
+//  @author Nicolai Shlapunov
+//
+//  @details Host: Tests of LZ decoder, primitives spans, SpriteBatch,
+//           frame done wait, StreamImage, TiledMap tiles from pack, glyph
+//           cache, blend of line and MsgBox fade
+//
+//  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+//             All rights reserved.
+//
+//  @section SUPPORT
+//
+//   Devtronic invests time and resources providing this open source code,
+//   please support Devtronic and open-source hardware/software by
+//   donations and/or purchasing products from Devtronic.
+//
+//******************************************************************************
+
+// *****************************************************************************
+// ***   Includes   ************************************************************
+// *****************************************************************************
+// Standard headers first: DevCfg.h declares allocation operators without
+// exception specification
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include "HostDisplay.h"
+#include "HostRtos.h"
+#include "DisplayDrv.h"
+#include "LzDecoder.h"
+#include "StreamImage.h"
+#include "TiledMap.h"
+#include "PropString.h"
+#include "UiEngine.h"
+
+// Raw images and the same images compressed by Tools/LzConverter.py
+namespace raw
+{
+  #include "LzTestImage.h"
+}
+namespace lz
+{
+  #include "LzTestImage16.h"
+  #include "LzTestImage8.h"
+}
+
+// *****************************************************************************
+// ***   Test helpers   ********************************************************
+// *****************************************************************************
+// Screen size used by span tests
+static const int32_t W = 320;
+static const int32_t H = 240;
+// Colors of background and drawn pixels in span tests
+static const uint16_t BG = 0x0000U;
+static const uint16_t FG = 0xFFFFU;
+
+// Count of failed checks
+static uint32_t errors = 0U;
+
+// Report failed check. Only first failures printed for each test.
+#define CHECK(cond, ...)                                    \
+  do                                                        \
+  {                                                         \
+    if(!(cond))                                             \
+    {                                                       \
+      if(errors < 20U)                                      \
+      {                                                     \
+        printf("  %s:%d: ", __FILE__, __LINE__);            \
+        printf(__VA_ARGS__);                                \
+        printf("\n");                                       \
+      }                                                     \
+      errors++;                                             \
+    }                                                       \
+  } while(0)
+
+// *****************************************************************************
+// ***   Draw object to screen buffer line by line   ***************************
+// *****************************************************************************
+// * Lines drawn from first to last like DisplayDrv draws area.
+static void DrawObject(VisObject& obj, uint16_t* scr, int32_t first = 0, int32_t last = H - 1)
+{
+  for(int32_t y = 0; y < W * H; y++) scr[y] = BG;
+  for(int32_t y = first; y <= last; y++)
+  {
+    obj.DrawInBufW(&scr[y * W], W, y, 0);
+  }
+}
+
+// *****************************************************************************
+// ***   Check that lines are single spans   ***********************************
+// *****************************************************************************
+static void CheckContiguous(const uint16_t* scr, const char* name)
+{
+  for(int32_t y = 0; y < H; y++)
+  {
+    int32_t runs = 0;
+    for(int32_t x = 0; x < W; x++)
+    {
+      if((scr[y * W + x] != BG) && ((x == 0) || (scr[y * W + x - 1] == BG))) runs++;
+    }
+    CHECK(runs <= 1, "%s: line %ld has %ld spans", name, (long)y, (long)runs);
+  }
+}
+
+// *****************************************************************************
+// ***   LZ round trip   *******************************************************
+// *****************************************************************************
+// * Every row decoded separately must be equal to row of raw image.
+static void CheckLzImage(const uint8_t* raw_data, const uint8_t* lz_data, uint32_t w, uint32_t h, uint32_t bpp)
+{
+  const uint32_t line_size = (w * bpp + 7U) / 8U;
+  for(uint32_t y = 0U; y < h; y++)
+  {
+    const uint8_t* p = lz_data + y * 4U;
+    uint32_t offset = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    const uint8_t* row = LzDecoder::DecodeRow(lz_data + offset, line_size);
+    CHECK(memcmp(row, raw_data + y * line_size, line_size) == 0, "%lu bpp image: row %lu differs", (unsigned long)bpp, (unsigned long)y);
+  }
+}
+
+static void TestLzRoundTrip(void)
+{
+  CheckLzImage((const uint8_t*)raw::lz_test_image16, lz::lz_test_image16, 40U, 12U, 16U);
+  CheckLzImage(raw::lz_test_image8, lz::lz_test_image8, 300U, 4U, 8U);
+}
+
+// *****************************************************************************
+// ***   Polygon spans   *******************************************************
+// *****************************************************************************
+// * Reference is even-odd rule for each pixel center with the same half-open
+// * rules as Polygon: edge crosses lines from top vertex to bottom vertex
+// * excluding it, pixel filled if its center is from left edge to right edge
+// * excluding it. Pixels closer than 1/256 pixel to edge skipped: Polygon
+// * calculates X of edges in fixed point.
+static void CheckPolygon(const char* name, int32_t px, int32_t py, const Point* pts, uint32_t cnt)
+{
+  static uint16_t scr[W * H];
+  Polygon polygon(px, py, pts, cnt, FG, true);
+  // Whole area and area which starts from middle of polygon
+  for(uint32_t pass = 0U; pass < 2U; pass++)
+  {
+    const int32_t first = (pass == 0U) ? 0 : (polygon.GetStartY() + polygon.GetEndY()) / 2;
+    DrawObject(polygon, scr, first);
+    uint32_t skipped = 0U;
+    for(int32_t y = first; y < H; y++)
+    {
+      for(int32_t x = 0; x < W; x++)
+      {
+        // Pixel center in fixed point relative to polygon position
+        const int64_t cx = (int64_t)(x - px) << Polygon::FRAC_BITS;
+        const int64_t cy = (int64_t)(y - py) << Polygon::FRAC_BITS;
+        uint32_t crossings = 0U;
+        bool is_near = false;
+        for(uint32_t i = 0U; i < cnt; i++)
+        {
+          Point v0 = pts[i];
+          Point v1 = pts[(i + 1U) % cnt];
+          if(v0.y > v1.y) {Point t = v0; v0 = v1; v1 = t;}
+          if((cy >= v0.y) && (cy < v1.y))
+          {
+            // Sign of (edge X - center X) * dy
+            const int64_t dy = v1.y - v0.y;
+            const int64_t d = (int64_t)v0.x * dy + (int64_t)(v1.x - v0.x) * (cy - v0.y) - cx * dy;
+            if(d <= 0) crossings++;
+            if(llabs(d) * 256 < (dy << Polygon::FRAC_BITS)) is_near = true;
+          }
+        }
+        if(is_near)
+        {
+          skipped++;
+          continue;
+        }
+        const uint16_t expected = (crossings & 1U) ? FG : BG;
+        CHECK(scr[y * W + x] == expected, "%s: pass %lu pixel (%ld, %ld) is %s", name,
+              (unsigned long)pass, (long)x, (long)y, (expected == FG) ? "empty" : "filled");
+      }
+    }
+    CHECK(skipped < 16U, "%s: %lu pixels on edges", name, (unsigned long)skipped);
+  }
+}
+
+static void TestPolygonSpans(void)
+{
+  // Convex: fast path with two active edges
+  static const Point triangle[] = {{5, -300}, {413, 170}, {-250, 411}};
+  CheckPolygon("triangle", 100, 100, triangle, NumberOf(triangle));
+  // Concave: four edges cross lines below the notch
+  static const Point ship[] = {{0, -320}, {224, 256}, {0, 128}, {-224, 256}};
+  CheckPolygon("ship", 60, 60, ship, NumberOf(ship));
+  // Self-intersecting: center of star isn't filled by even-odd rule
+  static const Point star[] = {{0, -800}, {470, 647}, {-761, -247}, {761, -247}, {-470, 647}};
+  CheckPolygon("star", 160, 120, star, NumberOf(star));
+  // Partially outside of screen
+  static const Point quad[] = {{-400, -200}, {600, -150}, {700, 500}, {-300, 600}};
+  CheckPolygon("clipped", 10, 10, quad, NumberOf(quad));
+}
+
+// *****************************************************************************
+// ***   Line spans   **********************************************************
+// *****************************************************************************
+// * Thin line has one pixel for each step along major axis and pixel is not
+// * further than half pixel from line along minor axis.
+static void CheckThinLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+  static uint16_t scr[W * H];
+  Line line(x1, y1, x2, y2, FG);
+  DrawObject(line, scr);
+  const int32_t dx = x2 - x1;
+  const int32_t dy = y2 - y1;
+  const bool x_major = abs(dx) > abs(dy);
+  const int32_t steps = x_major ? abs(dx) : abs(dy);
+  uint32_t cnt = 0U;
+  for(int32_t y = 0; y < H; y++)
+  {
+    for(int32_t x = 0; x < W; x++)
+    {
+      if(scr[y * W + x] == FG)
+      {
+        cnt++;
+        // Distance along major axis from first point and minor axis error
+        // multiplied by steps
+        const int32_t t = x_major ? (x - x1) * (dx > 0 ? 1 : -1) : (y - y1) * (dy > 0 ? 1 : -1);
+        const int32_t err = x_major ? ((y - y1) * steps - t * dy) : ((x - x1) * steps - t * dx);
+        CHECK((t >= 0) && (t <= steps) && (2 * abs(err) <= steps),
+              "line (%ld,%ld)-(%ld,%ld): pixel (%ld, %ld) off line", (long)x1, (long)y1, (long)x2, (long)y2, (long)x, (long)y);
+      }
+    }
+  }
+  CHECK(cnt == (uint32_t)steps + 1U, "line (%ld,%ld)-(%ld,%ld): %lu pixels instead of %ld",
+        (long)x1, (long)y1, (long)x2, (long)y2, (unsigned long)cnt, (long)steps + 1);
+  CHECK((scr[y1 * W + x1] == FG) && (scr[y2 * W + x2] == FG), "line (%ld,%ld)-(%ld,%ld): end point missed",
+        (long)x1, (long)y1, (long)x2, (long)y2);
+}
+
+// *****************************************************************************
+// ***   Thick line spans   ****************************************************
+// *****************************************************************************
+// * Thick line is rectangle around line with square caps: pixels deeper than
+// * one pixel inside must be drawn, pixels further than one pixel outside
+// * must not.
+static void CheckThickLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t w)
+{
+  static uint16_t scr[W * H];
+  Line line(x1, y1, x2, y2, FG, w);
+  DrawObject(line, scr);
+  const double len = sqrt((double)(x2 - x1) * (x2 - x1) + (double)(y2 - y1) * (y2 - y1));
+  const double ux = (x2 - x1) / len;
+  const double uy = (y2 - y1) / len;
+  const double hw = w * 0.5;
+  for(int32_t y = 0; y < H; y++)
+  {
+    for(int32_t x = 0; x < W; x++)
+    {
+      // Distance along line from first point and distance to line
+      const double a = (x - x1) * ux + (y - y1) * uy;
+      const double b = fabs(-(x - x1) * uy + (y - y1) * ux);
+      const bool inside = (a >= -hw + 1.0) && (a <= len + hw - 1.0) && (b <= hw - 1.0);
+      const bool outside = (a < -hw - 1.0) || (a > len + hw + 1.0) || (b > hw + 1.0);
+      if(inside)  CHECK(scr[y * W + x] == FG, "thick line: pixel (%ld, %ld) is empty", (long)x, (long)y);
+      if(outside) CHECK(scr[y * W + x] == BG, "thick line: pixel (%ld, %ld) is filled", (long)x, (long)y);
+    }
+  }
+}
+
+static void TestLineSpans(void)
+{
+  // All octants, horizontal, vertical and diagonal lines
+  CheckThinLine(10, 10, 200, 60);
+  CheckThinLine(200, 60, 10, 10);
+  CheckThinLine(10, 200, 200, 150);
+  CheckThinLine(50, 10, 80, 230);
+  CheckThinLine(80, 10, 50, 230);
+  CheckThinLine(5, 100, 315, 100);
+  CheckThinLine(100, 5, 100, 235);
+  CheckThinLine(20, 20, 220, 220);
+  CheckThinLine(220, 20, 20, 220);
+  CheckThinLine(7, 3, 9, 200);
+  CheckThinLine(3, 7, 300, 9);
+  CheckThickLine(20, 220, 180, 150, 5U);
+  CheckThickLine(30, 40, 290, 40, 8U);
+  CheckThickLine(160, 20, 170, 220, 3U);
+}
+
+// *****************************************************************************
+// ***   Round shape spans   ***************************************************
+// *****************************************************************************
+// * Shape is rectangle with corners cut by ellipse quarters. Pixels deeper
+// * than one pixel inside must be drawn, pixels further than one pixel outside
+// * must not. For outline inner shape reduced by thickness.
+static double ShapeDistance(int32_t x, int32_t y, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t rx, int32_t ry)
+{
+  // Normalized distance to ellipse of corner, negative inside shape
+  const double cx = (x < x1 + rx) ? (x1 + rx) : ((x > x2 - rx) ? (x2 - rx) : x);
+  const double cy = (y < y1 + ry) ? (y1 + ry) : ((y > y2 - ry) ? (y2 - ry) : y);
+  double dx = x - cx;
+  double dy = y - cy;
+  double d;
+  if((dx == 0.0) || (dy == 0.0) || (rx == 0) || (ry == 0))
+  {
+    // Straight part: distance to side
+    d = std::max(std::max(x1 - x, x - x2), std::max(y1 - y, y - y2));
+  }
+  else
+  {
+    // Corner: radial distance scaled to pixels
+    const double r = sqrt((dx * dx) / ((double)rx * rx) + (dy * dy) / ((double)ry * ry));
+    d = (r - 1.0) * std::min(rx, ry);
+  }
+  return d;
+}
+
+static void CheckRoundShape(const char* name, VisObject& obj, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                            int32_t rx, int32_t ry, bool fill, int32_t t)
+{
+  static uint16_t scr[W * H];
+  DrawObject(obj, scr);
+  for(int32_t y = 0; y < H; y++)
+  {
+    for(int32_t x = 0; x < W; x++)
+    {
+      const double d = ShapeDistance(x, y, x1, y1, x2, y2, rx, ry);
+      bool inside = (d <= -1.0);
+      bool outside = (d >= 1.0);
+      if(!fill)
+      {
+        // Outline is shape without the same shape reduced by thickness
+        const double di = ShapeDistance(x, y, x1 + t, y1 + t, x2 - t, y2 - t,
+                                        std::max(rx - t, 0), std::max(ry - t, 0));
+        inside = inside && (di >= 1.0);
+        outside = outside || (di <= -1.0);
+      }
+      if(inside)  CHECK(scr[y * W + x] == FG, "%s: pixel (%ld, %ld) is empty", name, (long)x, (long)y);
+      if(outside) CHECK(scr[y * W + x] == BG, "%s: pixel (%ld, %ld) is filled", name, (long)x, (long)y);
+      // Shapes are symmetric
+      const int32_t mx = x1 + x2 - x;
+      const int32_t my = y1 + y2 - y;
+      if((mx >= 0) && (mx < W) && (my >= 0) && (my < H))
+      {
+        CHECK(scr[y * W + x] == scr[y * W + mx], "%s: pixels (%ld, %ld) and (%ld, %ld) differ", name, (long)x, (long)y, (long)mx, (long)y);
+        CHECK(scr[y * W + x] == scr[my * W + x], "%s: pixels (%ld, %ld) and (%ld, %ld) differ", name, (long)x, (long)y, (long)x, (long)my);
+      }
+    }
+  }
+  if(fill) CheckContiguous(scr, name);
+}
+
+static void TestRoundShapeSpans(void)
+{
+  Circle circle1(120, 150, 30, FG, true);
+  CheckRoundShape("filled circle", circle1, 90, 120, 150, 180, 30, 30, true, 1);
+  Circle circle2(150, 120, 60, FG, false, 4);
+  CheckRoundShape("circle", circle2, 90, 60, 210, 180, 60, 60, false, 4);
+  Ellipse ellipse1(60, 160, 40, 20, FG, false, 3);
+  CheckRoundShape("ellipse", ellipse1, 20, 140, 100, 180, 40, 20, false, 3);
+  Ellipse ellipse2(200, 100, 15, 70, FG, true);
+  CheckRoundShape("filled ellipse", ellipse2, 185, 30, 215, 170, 15, 70, true, 1);
+  RoundRect rrect1(220, 40, 81, 51, 12, FG, true);
+  CheckRoundShape("filled round rect", rrect1, 220, 40, 300, 90, 12, 12, true, 1);
+  RoundRect rrect2(20, 20, 201, 151, 25, FG, false, 2);
+  CheckRoundShape("round rect", rrect2, 20, 20, 220, 170, 25, 25, false, 2);
+}
+
+// *****************************************************************************
+// ***   SpriteBatch order   ***************************************************
+// *****************************************************************************
+// * Batch compared with reference which draws each pixel by sprite with the
+// * biggest Z and then the biggest index after random adds, moves and deletes.
+static void TestSpriteBatchOrder(void)
+{
+  static const int32_t BW = 160;
+  static const int32_t BH = 120;
+  static const uint32_t CNT = 64U;
+  static const uint32_t IMG_CNT = 4U;
+  static const int32_t sizes[IMG_CNT][2] = {{8, 8}, {16, 4}, {3, 21}, {12, 12}};
+  static uint16_t img_data[IMG_CNT][21 * 16];
+  static ImageDesc images[IMG_CNT];
+  static SpriteBatch::Sprite sprites[CNT];
+  static uint16_t scr[W * H];
+  // Position, image and Z of sprites, image is -1 for free record
+  int32_t sx[CNT], sy[CNT], simg[CNT];
+  uint8_t sz[CNT];
+  // Each pixel of image has own color: image and position in it, so
+  // reference finds which sprite should be drawn
+  for(uint32_t i = 0U; i < IMG_CNT; i++)
+  {
+    for(int32_t p = 0; p < sizes[i][0] * sizes[i][1]; p++)
+    {
+      img_data[i][p] = (uint16_t)(0x8000U | (i << 10) | p);
+    }
+    images[i].width = sizes[i][0];
+    images[i].height = sizes[i][1];
+    images[i].bits_per_pixel = 16U;
+    images[i].img16 = img_data[i];
+    images[i].palette = nullptr;
+    images[i].transparent_color = -1;
+  }
+  SpriteBatch batch(20, 10, BW, BH, sprites, CNT);
+  srand(1);
+  for(uint32_t i = 0U; i < CNT; i++) simg[i] = -1;
+
+  for(uint32_t step = 0U; step < 50U; step++)
+  {
+    // Random changes
+    for(uint32_t n = 0U; n < 40U; n++)
+    {
+      const uint32_t r = rand() % 4U;
+      if(r == 0U)
+      {
+        // Add sprite, position can be partially outside of batch
+        const uint32_t img = rand() % IMG_CNT;
+        const int32_t x = 20 - 10 + rand() % (BW + 10);
+        const int32_t y = 10 - 10 + rand() % (BH + 10);
+        const uint8_t z = rand() % 3U;
+        const int32_t id = batch.AddSprite(images[img], x, y, z);
+        if(id >= 0)
+        {
+          CHECK(simg[id] < 0, "sprite %ld allocated twice", (long)id);
+          sx[id] = x; sy[id] = y; simg[id] = img; sz[id] = z;
+        }
+      }
+      else
+      {
+        const uint32_t id = rand() % CNT;
+        if(simg[id] < 0) continue;
+        if(r == 1U)
+        {
+          batch.DelSprite(id);
+          simg[id] = -1;
+        }
+        else if(r == 2U)
+        {
+          // Small move like in games
+          sx[id] += rand() % 9 - 4;
+          sy[id] += rand() % 9 - 4;
+          batch.MoveSprite(id, sx[id], sy[id]);
+        }
+        else
+        {
+          simg[id] = rand() % IMG_CNT;
+          batch.SetSpriteImage(id, images[simg[id]]);
+        }
+      }
+    }
+    // Count of used records
+    uint32_t used = 0U;
+    for(uint32_t i = 0U; i < CNT; i++)
+    {
+      if(simg[i] >= 0) used++;
+    }
+    CHECK(batch.GetSpritesCnt() == used, "step %lu: %lu sprites instead of %lu", (unsigned long)step,
+          (unsigned long)batch.GetSpritesCnt(), (unsigned long)used);
+    // Draw batch and compare with reference
+    DrawObject(batch, scr);
+    for(int32_t y = 0; y < H; y++)
+    {
+      for(int32_t x = 0; x < W; x++)
+      {
+        // Reference: sprite with biggest Z, then biggest index
+        int32_t top = -1;
+        for(uint32_t i = 0U; i < CNT; i++)
+        {
+          if(simg[i] < 0) continue;
+          if((x < sx[i]) || (x >= sx[i] + sizes[simg[i]][0])) continue;
+          if((y < sy[i]) || (y >= sy[i] + sizes[simg[i]][1])) continue;
+          if((top < 0) || (sz[i] > sz[top]) || ((sz[i] == sz[top]) && (i > (uint32_t)top))) top = i;
+        }
+        uint16_t expected = BG;
+        if((top >= 0) && (x >= 20) && (x < 20 + BW) && (y >= 10) && (y < 10 + BH))
+        {
+          expected = (uint16_t)(0x8000U | (simg[top] << 10) | ((y - sy[top]) * sizes[simg[top]][0] + (x - sx[top])));
+        }
+        CHECK(scr[y * W + x] == expected, "step %lu: pixel (%ld, %ld) is 0x%04X instead of 0x%04X",
+              (unsigned long)step, (long)x, (long)y, scr[y * W + x], expected);
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   SpriteBatch invalidation   ********************************************
+// *****************************************************************************
+// * Batch which is the only object in DisplayDrv list has no neighbours, but
+// * it is shown. Shown batch must invalidate old and new areas of changed
+// * sprites.
+static void TestSpriteBatchInvalidate(void)
+{
+  static HostDisplay host_display;
+  static const uint16_t red[8 * 8] = {COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED,
+                                      COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED, COLOR_RED};
+  static const ImageDesc red_img = {8, 8, 16, {.img16 = red}, nullptr, -1};
+  static SpriteBatch::Sprite sprites[4];
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  display_drv.SetDisplay(host_display);
+  display_drv.InitTask();
+
+  SpriteBatch batch(0, 0, W, H, sprites, NumberOf(sprites));
+  int32_t id = batch.AddSprite(red_img, 10, 10);
+  // FPS string shown by Setup(), so batch is the only object before it
+  batch.Show(1);
+  CHECK(batch.IsShow(), "only object in list isn't shown");
+  batch.Hide();
+  CHECK(!batch.IsShow(), "hidden object is shown");
+  display_drv.Setup();
+  batch.Show(1);
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  const uint16_t bg = host_display.GetPixel(100, 100);
+  const uint16_t fg = host_display.GetPixel(12, 12);
+  CHECK(fg != bg, "sprite isn't drawn");
+
+  // Move and draw next frame: old place cleared, new place drawn
+  batch.MoveSprite(id, 50, 60);
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  CHECK(host_display.GetPixel(12, 12) == bg, "old area of sprite isn't redrawn");
+  CHECK(host_display.GetPixel(52, 62) == fg, "new area of sprite isn't drawn");
+
+  // Delete sprite
+  batch.DelSprite(id);
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  CHECK(host_display.GetPixel(52, 62) == bg, "deleted sprite isn't cleared");
+  batch.Hide();
+}
+
+// *****************************************************************************
+// ***   Test: wait for frame done   *******************************************
+// *****************************************************************************
+// * Display task runs in background. Tick when background task wakes waiting
+// * application task without frame done, 0 - never.
+static uint32_t spurious_wake_tick = 0U;
+
+static void FrameDoneDisplayTask(void* ptr)
+{
+  if(HostRtos::GetTickCount() == spurious_wake_tick)
+  {
+    Rtos::TaskNotifyGive(Rtos::GetCurrentTask());
+  }
+  DisplayDrv::GetInstance().Loop();
+}
+
+// * Frame done before wait can't be missed and wake up before frame done
+// * doesn't restart timeout.
+static void TestFrameDoneWait(void)
+{
+  static HostDisplay host_display;
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  display_drv.SetDisplay(host_display);
+  display_drv.InitTask();
+  display_drv.Setup();
+  HostRtos::AddBackground(FrameDoneDisplayTask, nullptr);
+
+  // Frame requested before wait is drawn during wait
+  uint32_t frame = display_drv.GetFrameCnt();
+  display_drv.UpdateDisplay();
+  Result result = display_drv.WaitForFrameDone(100U);
+  CHECK(result.IsGood(), "requested frame isn't done");
+  CHECK(display_drv.GetFrameCnt() != frame, "wait returned before frame done");
+
+  // No frame requested: wait times out once for whole timeout
+  uint32_t start = HostRtos::GetTickCount();
+  spurious_wake_tick = start + 20U;
+  result = display_drv.WaitForFrameDone(50U);
+  uint32_t elapsed = HostRtos::GetTickCount() - start;
+  CHECK(result.IsBad(), "wait without frame doesn't time out");
+  CHECK(elapsed == 50U, "timeout %u ms instead of 50 ms", (unsigned)elapsed);
+
+  // Next frame wakes up waiter again
+  frame = display_drv.GetFrameCnt();
+  display_drv.UpdateDisplay();
+  result = display_drv.WaitForFrameDone(100U);
+  CHECK(result.IsGood(), "frame after timeout isn't done");
+  CHECK(display_drv.GetFrameCnt() != frame, "wait after timeout returned before frame done");
+
+  HostRtos::ClearBackground();
+}
+
+// *****************************************************************************
+// ***   Test: rows of LZ compressed stream image   ****************************
+// *****************************************************************************
+// * Pack with two LZ images: row of "big" image doesn't fit in cache row, so
+// * it can't be drawn and image must be rejected.
+static uint32_t PutU32(uint8_t* buf, uint32_t pos, uint32_t val)
+{
+  for(uint32_t i = 0U; i < 4U; i++) buf[pos + i] = (val >> (i * 8U)) & 0xFFU;
+  return pos + 4U;
+}
+
+static uint32_t PutLzImage(uint8_t* buf, uint32_t pos, uint32_t row_size)
+{
+  AssetDrv::ImageHeader hdr = {ASSET_CACHE_ROW_SIZE, 2U, 8U | IMAGE_LZ, 0U, 0U, -1};
+  memcpy(&buf[pos], &hdr, sizeof(hdr));
+  pos += sizeof(hdr);
+  // Offsets table of two rows, rows data is zeros
+  pos = PutU32(buf, pos, 3U * 4U);
+  pos = PutU32(buf, pos, 3U * 4U + row_size);
+  pos = PutU32(buf, pos, 3U * 4U + row_size + 10U);
+  return pos + row_size + 10U;
+}
+
+static void WriteLzPack(void)
+{
+  static const char* names[] = {"ok", "big"};
+  static const uint32_t row_sizes[] = {ASSET_CACHE_ROW_SIZE, ASSET_CACHE_ROW_SIZE + 1U};
+  static uint8_t pack[2048] = {'D', 'B', 'P', 'K', 2U};
+  // Header and table of assets
+  uint32_t pos = 8U + 2U * 24U;
+  for(uint32_t i = 0U; i < 2U; i++)
+  {
+    uint32_t start = pos;
+    pos = PutLzImage(pack, pos, row_sizes[i]);
+    strcpy((char*)&pack[8U + i * 24U], names[i]);
+    PutU32(pack, 8U + i * 24U + 16U, start);
+    PutU32(pack, 8U + i * 24U + 20U, pos - start);
+  }
+  FILE* f = fopen("lz_rows.pak", "wb");
+  CHECK((f != nullptr) && (fwrite(pack, 1U, pos, f) == pos), "can't write pack");
+  if(f != nullptr) fclose(f);
+}
+
+static void TestStreamImageLzRows(void)
+{
+  WriteLzPack();
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  CHECK(asset_drv.Open("lz_rows.pak").IsGood(), "can't open pack");
+  StreamImage ok_img(0, 0);
+  StreamImage big_img(0, 0);
+  CHECK(ok_img.Load("ok") == Result::RESULT_OK, "image with rows fit in cache isn't loaded");
+  CHECK(big_img.Load("big") == Result::ERR_NOT_IMPLEMENTED, "image with row bigger than cache row is loaded");
+  asset_drv.Close();
+}
+
+// *****************************************************************************
+// ***   Test: load of stream image   ******************************************
+// *****************************************************************************
+// * Hidden image applies loaded image immediately, shown image - before next
+// * frame. Next load has to wait until previous one applied.
+static void TestStreamImageLoad(void)
+{
+  static HostDisplay host_display;
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  display_drv.SetDisplay(host_display);
+  display_drv.InitTask();
+  display_drv.Setup();
+  WriteLzPack();
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  CHECK(asset_drv.Open("lz_rows.pak").IsGood(), "can't open pack");
+
+  StreamImage img(0, 0);
+  CHECK(img.Load("ok") == Result::RESULT_OK, "hidden image isn't loaded");
+  CHECK(img.GetWidth() == ASSET_CACHE_ROW_SIZE, "hidden image isn't applied immediately");
+  CHECK(img.Load("ok") == Result::RESULT_OK, "hidden image can't be loaded again");
+
+  img.Show(1);
+  CHECK(img.Load("ok") == Result::RESULT_OK, "shown image isn't loaded");
+  CHECK(img.Load("ok") == Result::ERR_BUSY, "second load before frame isn't rejected");
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  CHECK(img.Load("ok") == Result::RESULT_OK, "load after frame is rejected");
+  // Rows weren't read yet: misses saved in statistic of frame by callback
+  AssetDrv::Stats stats;
+  asset_drv.GetFrameStats(stats);
+  CHECK(stats.misses != 0U, "asset statistic of frame isn't saved");
+  img.Hide();
+  asset_drv.Close();
+}
+
+// *****************************************************************************
+// ***   Test: tiles of map from pack file   ***********************************
+// *****************************************************************************
+// * Map with two tiles in flash replaces them by two tiles from pack file. Tiles
+// * read by asset task in background and drawn after read.
+static void AssetTask(void* ptr)
+{
+  AssetDrv::GetInstance().Loop();
+}
+
+static void DisplayTask(void* ptr)
+{
+  DisplayDrv::GetInstance().Loop();
+}
+
+// Colors in display byte order, HostDisplay returns RGB565
+static uint16_t Rgb565(uint16_t color)
+{
+  return (uint16_t)((color >> 8) | (color << 8));
+}
+
+static void WriteTilesPack(void)
+{
+  static uint8_t pack[512] = {'D', 'B', 'P', 'K', 1U};
+  // Header and table of assets
+  uint32_t pos = 8U + 24U;
+  strcpy((char*)&pack[8U], "tiles");
+  PutU32(pack, 8U + 16U, pos);
+  // Two 16x16 tiles at 4 bits per pixel: first is red, second is green
+  AssetDrv::ImageHeader hdr = {16U, 32U, 4U, 0U, 2U, -1};
+  memcpy(&pack[pos], &hdr, sizeof(hdr));
+  pos += sizeof(hdr);
+  static const uint16_t palette[] = {COLOR_RED, COLOR_GREEN};
+  memcpy(&pack[pos], palette, sizeof(palette));
+  pos += sizeof(palette);
+  memset(&pack[pos], 0x00, 16U * 8U);
+  pos += 16U * 8U;
+  memset(&pack[pos], 0x11, 16U * 8U);
+  pos += 16U * 8U;
+  PutU32(pack, 8U + 20U, pos - (8U + 24U));
+  FILE* f = fopen("tiles.pak", "wb");
+  CHECK((f != nullptr) && (fwrite(pack, 1U, pos, f) == pos), "can't write pack");
+  if(f != nullptr) fclose(f);
+}
+
+static void TestTiledMapStream(void)
+{
+  static HostDisplay host_display;
+  static uint16_t blue[16 * 16];
+  for(uint32_t i = 0U; i < 16U * 16U; i++) blue[i] = COLOR_BLUE;
+  static const ImageDesc tiles[] = {{16, 16, 16, {.img16 = blue}, nullptr, -1},
+                                    {16, 16, 16, {.img16 = blue}, nullptr, -1}};
+  static uint8_t map[] = {0U, 1U};
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  display_drv.SetDisplay(host_display);
+  display_drv.InitTask();
+  display_drv.Setup();
+  WriteTilesPack();
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  CHECK(asset_drv.Open("tiles.pak").IsGood(), "can't open pack");
+
+  TiledMap tiled_map(100, 100, 32, 16, map, 2U, 1U, 0xFFU, tiles, 2U, COLOR_BLACK);
+  tiled_map.Show(1);
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  CHECK(host_display.GetPixel(100, 100) == Rgb565(COLOR_BLUE), "tile from flash isn't drawn");
+
+  CHECK(tiled_map.LoadTiles("tiles", 0U).IsBad(), "tiles with zero height are loaded");
+  CHECK(tiled_map.LoadTiles("tiles", 16U).IsGood(), "tiles aren't loaded");
+  CHECK(tiled_map.LoadTiles("tiles", 16U) == Result::ERR_BUSY, "second load before frame isn't rejected");
+
+  HostRtos::AddBackground(AssetTask, nullptr);
+  HostRtos::AddBackground(DisplayTask, nullptr);
+  display_drv.UpdateDisplay();
+  HostRtos::Delay(20U);
+  CHECK(host_display.GetPixel(100, 100) == Rgb565(COLOR_RED), "first tile from pack isn't drawn");
+  CHECK(host_display.GetPixel(131, 115) == Rgb565(COLOR_GREEN), "second tile from pack isn't drawn");
+  HostRtos::ClearBackground();
+
+  tiled_map.Hide();
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  asset_drv.Close();
+}
+
+// *****************************************************************************
+// ***   Test: glyph cache   ***************************************************
+// *****************************************************************************
+// * Font in pack file with GLYPHS_CNT 8x8 glyphs. Glyphs of string requested
+// * on each line of string, so after they read all of them must stay in glyph
+// * cache and next frame mustn't request any glyph from AssetDrv.
+static void WriteFontPack(void)
+{
+  static const uint32_t GLYPHS_CNT = 25U;
+  static uint8_t pack[1024] = {'D', 'B', 'P', 'K', 1U};
+  // Header and table of assets
+  uint32_t pos = 8U + 24U;
+  strcpy((char*)&pack[8U], "font");
+  PutU32(pack, 8U + 16U, pos);
+  PropFont::Header hdr = {{'D', 'B', 'F', 'N'}, 1U, 8U, 8U, 0U, GLYPHS_CNT, 0U};
+  memcpy(&pack[pos], &hdr, sizeof(hdr));
+  // Glyphs 'A'.. with bitmaps after glyphs table
+  const uint32_t data_offset = sizeof(hdr) + GLYPHS_CNT * sizeof(PropFont::Glyph);
+  for(uint32_t i = 0U; i < GLYPHS_CNT; i++)
+  {
+    PropFont::Glyph g = {'A' + i, data_offset + i * 8U, 8U, 8U, 8U, 0, 0, 9U, 0U};
+    memcpy(&pack[pos + sizeof(hdr) + i * sizeof(g)], &g, sizeof(g));
+  }
+  memset(&pack[pos + data_offset], 0xFF, GLYPHS_CNT * 8U);
+  pos += data_offset + GLYPHS_CNT * 8U;
+  PutU32(pack, 8U + 20U, pos - (8U + 24U));
+  FILE* f = fopen("font.pak", "wb");
+  CHECK((f != nullptr) && (fwrite(pack, 1U, pos, f) == pos), "can't write pack");
+  if(f != nullptr) fclose(f);
+}
+
+static void TestGlyphCache(void)
+{
+  static HostDisplay host_display;
+  static uint32_t tables[128];
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  display_drv.SetDisplay(host_display);
+  display_drv.InitTask();
+  display_drv.Setup();
+  WriteFontPack();
+  AssetDrv& asset_drv = AssetDrv::GetInstance();
+  CHECK(asset_drv.Open("font.pak").IsGood(), "can't open pack");
+  PropFont font;
+  CHECK(font.Load("font", tables, sizeof(tables)).IsGood(), "font isn't loaded");
+
+  // Glyphs with indexes which differ by 6
+  PropString str("AGMSY", 100, 150, COLOR_WHITE, font);
+  str.Show(1);
+  HostRtos::AddBackground(AssetTask, nullptr);
+  HostRtos::AddBackground(DisplayTask, nullptr);
+  display_drv.UpdateDisplay();
+  HostRtos::Delay(20U);
+  CHECK(host_display.GetPixel(100 + 4U * 9U, 150) == Rgb565(COLOR_WHITE), "glyphs aren't drawn");
+
+  // Redraw string from glyph cache
+  str.SetColor(COLOR_RED);
+  display_drv.UpdateDisplay();
+  HostRtos::Delay(20U);
+  AssetDrv::Stats stats;
+  asset_drv.GetFrameStats(stats);
+  CHECK(host_display.GetPixel(100 + 4U * 9U, 150) == Rgb565(COLOR_RED), "string isn't redrawn");
+  CHECK(stats.hits + stats.misses == 0U, "%u glyphs requested from cached string",
+        (unsigned)(stats.hits + stats.misses));
+  HostRtos::ClearBackground();
+
+  str.Hide();
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+  asset_drv.Close();
+}
+
+// *****************************************************************************
+// ***   Test: blend of line   *************************************************
+// *****************************************************************************
+// * Two pixels blended by one 32-bit operation must give the same result as
+// * each component blended separately for any alignment of src and dst.
+static uint16_t BlendRef(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+  // Colors in line buffer have swapped bytes
+  fg = (uint16_t)((fg >> 8) | (fg << 8));
+  bg = (uint16_t)((bg >> 8) | (bg << 8));
+  uint32_t result = 0U;
+  static const uint32_t masks[] = {0xF800U, 0x07E0U, 0x001FU};
+  for(uint32_t mask : masks)
+  {
+    result |= (((fg & mask) * alpha + (bg & mask) * (Blitter::ALPHA_MAX - alpha)) / Blitter::ALPHA_MAX) & mask;
+  }
+  return (uint16_t)((result >> 8) | (result << 8));
+}
+
+static void TestBlendLine(void)
+{
+  static uint16_t src[16];
+  static uint16_t dst[16];
+  static uint16_t bg[16];
+  srand(14);
+  for(uint32_t alpha = 0U; alpha <= Blitter::ALPHA_MAX; alpha++)
+  {
+    for(uint32_t i = 0U; i < NumberOf(src); i++)
+    {
+      src[i] = rand() & 0xFFFFU;
+      bg[i] = rand() & 0xFFFFU;
+    }
+    // Black and white pixels give max differences of components
+    src[0] = 0xFFFFU;
+    bg[0] = 0x0000U;
+    src[3] = 0x0000U;
+    bg[3] = 0xFFFFU;
+    for(int32_t n = 0; n <= 9; n++)
+    {
+      for(uint32_t s = 0U; s < 2U; s++)
+      {
+        for(uint32_t d = 0U; d < 2U; d++)
+        {
+          memcpy(dst, bg, sizeof(dst));
+          Blitter::BlendLine(&dst[d], &src[s], n, alpha);
+          for(int32_t i = 0; i < 12; i++)
+          {
+            uint16_t expected = ((i >= (int32_t)d) && (i < n + (int32_t)d)) ? BlendRef(src[i - d + s], bg[i], alpha) : bg[i];
+            CHECK(dst[i] == expected, "alpha %u n %d src %u dst %u pixel %d: 0x%04X instead of 0x%04X",
+                  (unsigned)alpha, (int)n, (unsigned)s, (unsigned)d, (int)i, dst[i], expected);
+            if((i >= (int32_t)d) && (i < n + (int32_t)d))
+            {
+              CHECK(dst[i] == Blitter::Blend(src[i - d + s], bg[i], alpha), "BlendLine and Blend differ");
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// *****************************************************************************
+// ***   Test: MsgBox fade   ***************************************************
+// *****************************************************************************
+// * Fade in is part of MsgBox delay and has several frames.
+static void TestMsgBoxFade(void)
+{
+  static HostDisplay host_display;
+
+  DisplayDrv& display_drv = DisplayDrv::GetInstance();
+  display_drv.SetDisplay(host_display);
+  display_drv.InitTask();
+  display_drv.Setup();
+  HostRtos::AddBackground(DisplayTask, nullptr);
+
+  UiMsgBox msg_box("Message", "Header");
+  uint32_t frame = display_drv.GetFrameCnt();
+  uint32_t start = HostRtos::GetTickCount();
+  msg_box.Run(100U, 40U);
+  uint32_t elapsed = HostRtos::GetTickCount() - start;
+  CHECK(elapsed == 100U, "MsgBox shown %u ms instead of 100 ms", (unsigned)elapsed);
+  CHECK(display_drv.GetFrameCnt() - frame > 2U, "fade in has only %u frames",
+        (unsigned)(display_drv.GetFrameCnt() - frame));
+
+  // Without fade MsgBox shown for delay too
+  start = HostRtos::GetTickCount();
+  msg_box.Run(50U);
+  elapsed = HostRtos::GetTickCount() - start;
+  CHECK(elapsed == 50U, "MsgBox without fade shown %u ms instead of 50 ms", (unsigned)elapsed);
+
+  HostRtos::ClearBackground();
+  display_drv.UpdateDisplay();
+  display_drv.Loop();
+}
+
+// *****************************************************************************
+// ***   Tests list   **********************************************************
+// *****************************************************************************
+typedef struct
+{
+  const char* name;
+  void (*Run)(void);
+} Test;
+
+static const Test tests[] =
+{
+  {"lz_round_trip",           TestLzRoundTrip},
+  {"polygon_spans",           TestPolygonSpans},
+  {"line_spans",              TestLineSpans},
+  {"round_shape_spans",       TestRoundShapeSpans},
+  {"sprite_batch_order",      TestSpriteBatchOrder},
+  {"sprite_batch_invalidate", TestSpriteBatchInvalidate},
+  {"frame_done_wait",         TestFrameDoneWait},
+  {"stream_image_lz_rows",    TestStreamImageLzRows},
+  {"stream_image_load",       TestStreamImageLoad},
+  {"tiled_map_stream",        TestTiledMapStream},
+  {"glyph_cache",             TestGlyphCache},
+  {"blend_line",              TestBlendLine},
+  {"msg_box_fade",            TestMsgBoxFade}
+};
+
+// *****************************************************************************
+// ***   Main   ****************************************************************
+// *****************************************************************************
+// * Runs tests given in command line or all tests. Exit code is count of
+// * failed tests.
+int main(int argc, char* argv[])
+{
+  int failed = 0;
+  for(uint32_t t = 0U; t < NumberOf(tests); t++)
+  {
+    bool is_selected = (argc < 2);
+    for(int i = 1; i < argc; i++)
+    {
+      if(strcmp(argv[i], tests[t].name) == 0) is_selected = true;
+    }
+    if(is_selected)
+    {
+      errors = 0U;
+      tests[t].Run();
+      printf("%s %s\n", (errors == 0U) ? "PASS" : "FAIL", tests[t].name);
+      if(errors != 0U) failed++;
+    }
+  }
+  fflush(stdout);
+  // Singletons never destroyed on target - leave without them
+  _exit(failed);
+}
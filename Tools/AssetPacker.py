@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+#*******************************************************************************
+#  @file AssetPacker.py
+#  @author Nicolai Shlapunov
+#
+#  @details DevCore: Packer of images and raw files to asset pack for SD card
+#
+#  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+#             All rights reserved.
+#
+#  @section SUPPORT
+#
+#   Devtronic invests time and resources providing this open source code,
+#   please support Devtronic and open-source hardware/software by
+#   donations and/or purchasing products from Devtronic.
+#
+#*******************************************************************************
+#
+# Creates pack file read by AssetDrv. Pack starts from "DBPK" signature and
+# count of assets followed by table of assets: 16 bytes zero padded name,
+# offset and size of each asset. Image asset has 12 bytes header(width,
+# height, bits per pixel, reserved byte, palette size and transparent color)
+# followed by palette and image lines in ImageDesc format. All values are
+# little endian.
+#
+# Usage:
+#   AssetPacker.py -o ASSETS.PAK
+#                  -i tiles=Gario.cpp:tiles_0_data:16x16:2:tiles_0_data_palette
+#                  -i logo=Logo.cpp:logo_data:64x32:16::0x1FF8
+#                  -r level1=level1.bin
+# Image spec is name=file:array:WxH:bpp[:palette[@file]][:transparent color].
+# Palette is searched in image file if other file isn't specified. Arrays
+# copied as is, so images must be converted to required format before. If
+# IMAGE_LZ flag(0x20) set in bpp, image is compressed by LzConverter.
+#
+#*******************************************************************************
+
+import argparse
+import re
+import struct
+import sys
+
+from LzConverter import encode_image, MAX_CACHE_ROW
+
+# Max length of asset name
+NAME_SIZE = 16
+# Image with alpha channel flag
+IMAGE_ALPHA = 0x40
+# LZ compressed image flag
+IMAGE_LZ = 0x20
+
+# ******************************************************************************
+# ***   Find array in source   *************************************************
+# ******************************************************************************
+def find_array(file_name, type_name, name):
+  with open(file_name, newline="") as f:
+    src = f.read()
+  pattern = re.compile(r'const\s+' + type_name + r'\s+' + re.escape(name) + r'\s*\[\s*\w*\s*\]\s*=\s*\{(.*?)\};', re.S)
+  match = pattern.search(src)
+  if match is None:
+    sys.exit("Array " + name + " not found in " + file_name)
+  return [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', match.group(1))]
+
+# ******************************************************************************
+# ***   Create image asset   ***************************************************
+# ******************************************************************************
+def image_asset(spec):
+  fields = spec.split(":")
+  if len(fields) < 4:
+    sys.exit("Wrong image spec: " + spec)
+  file_name, array = fields[0], fields[1]
+  width, height = (int(v) for v in fields[2].lower().split("x"))
+  bpp = int(fields[3], 0)
+  palette_name = fields[4] if len(fields) > 4 else ""
+  key = int(fields[5], 0) if (len(fields) > 5) and fields[5] else -1
+  # Image data
+  bits = bpp & ~(IMAGE_ALPHA | IMAGE_LZ)
+  if bits == 16:
+    data = struct.pack("<%dH" % (width * height), *find_array(file_name, "uint16_t", array))
+  else:
+    data = bytes(find_array(file_name, "uint8_t", array))
+  line_size = (width * bits + 7) // 8
+  if len(data) != line_size * height:
+    sys.exit("Array %s size %d doesn't match %dx%d %d bpp" % (array, len(data), width, height, bits))
+  # Palette
+  palette = []
+  if palette_name:
+    palette_file = file_name
+    if "@" in palette_name:
+      palette_name, palette_file = palette_name.split("@", 1)
+    palette = find_array(palette_file, "uint16_t", palette_name)
+  # Compress image
+  if bpp & IMAGE_LZ:
+    # Rows of streamed image read to AssetDrv row cache
+    packed, max_row = encode_image(list(data), width, height, bits, MAX_CACHE_ROW)
+    sys.stderr.write("%s: compressed %d -> %d bytes\n" % (array, len(data), len(packed)))
+    data = bytes(packed)
+  header = struct.pack("<HHBBHi", width, height, bpp, 0, len(palette), key)
+  sys.stderr.write("%s: %dx%d %d bpp, %d colors, %d bytes per line\n" % (array, width, height, bits, len(palette), line_size))
+  return header + struct.pack("<%dH" % len(palette), *palette) + data
+
+# ******************************************************************************
+# ***   Main   *****************************************************************
+# ******************************************************************************
+def main():
+  parser = argparse.ArgumentParser(description="Create asset pack for SD card")
+  parser.add_argument("-o", "--output", required=True, help="output pack file")
+  parser.add_argument("-i", "--image", action="append", default=[], help="image: name=file:array:WxH:bpp[:palette[@file]][:key]")
+  parser.add_argument("-r", "--raw", action="append", default=[], help="raw file: name=path")
+  args = parser.parse_args()
+
+  assets = []
+  for spec in args.image:
+    name, spec = spec.split("=", 1)
+    assets.append((name, image_asset(spec)))
+  for spec in args.raw:
+    name, path = spec.split("=", 1)
+    with open(path, "rb") as f:
+      assets.append((name, f.read()))
+
+  # Header, table of assets and data of assets aligned to 4 bytes
+  offset = 8 + len(assets) * (NAME_SIZE + 8)
+  table = b""
+  data = b""
+  for name, asset in assets:
+    if len(name) > NAME_SIZE:
+      sys.exit("Name " + name + " is too long")
+    table += struct.pack("<%dsII" % NAME_SIZE, name.encode("ascii"), offset + len(data), len(asset))
+    data += asset + b"\0" * (-len(asset) % 4)
+
+  with open(args.output, "wb") as f:
+    f.write(b"DBPK" + struct.pack("<I", len(assets)) + table + data)
+  sys.stderr.write("%s: %d assets, %d bytes\n" % (args.output, len(assets), offset + len(data)))
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+#*******************************************************************************
+#  @file FontConverter.py
+#  @author Nicolai Shlapunov
+#
+#  @details DevCore: Converter of BDF and TrueType fonts to proportional format
+#
+#  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+#             All rights reserved.
+#
+#  @section SUPPORT
+#
+#   Devtronic invests time and resources providing this open source code,
+#   please support Devtronic and open-source hardware/software by
+#   donations and/or purchasing products from Devtronic.
+#
+#*******************************************************************************
+#
+# Converts BDF fonts or glyphs rendered from TrueType fonts to the format used
+# by PropFont class.
+#
+# Format(little endian):
+#   header      - "DBFN", bits per pixel(| 0x20 if LZ compressed), height of
+#                 line, baseline, reserved, count of glyphs and kerning pairs
+#   glyphs      - code(32), offset of bitmap from start of font(32), size of
+#                 stored bitmap(16), width, height, x offset from pen, y offset
+#                 from top of line, advance and reserved byte, sorted by code
+#   kerning     - left glyph index(16), right glyph index(16), adjust(16),
+#                 sorted by glyphs
+#   bitmaps     - rows of 1, 2 or 4-bit coverage, each row starts from new
+#                 byte. With -z each bitmap compressed as one LzConverter row.
+#
+# BDF glyphs are 1-bit. With -s N font drawn N times bigger(for example BDF
+# made from TrueType font at N times size) is downsampled to anti-aliased
+# coverage. TrueType fonts rendered by Pillow with kerning from the font.
+#
+# Usage:
+#   FontConverter.py -b 4 -z -n font_sans16 Sans.bdf -s 4 > FontSans16.cpp
+#   FontConverter.py -b 4 -t 16 -c 32-126,0x410-0x44F -o sans16.fnt Sans.ttf
+# prints C array(aligned for PropFont::Init()) or writes binary file which
+# can be added to asset pack by "AssetPacker.py -r sans16=sans16.fnt" and
+# loaded by PropFont::Load().
+#
+#*******************************************************************************
+
+import argparse
+import struct
+import sys
+
+from LzConverter import encode_row, MAX_CACHE_ROW
+
+# Flag of LZ compressed bitmaps(PropFont::FONT_LZ)
+FONT_LZ = 0x20
+# Max size of decoded glyph(FONT_CACHE_GLYPH_SIZE in DevCfg.h)
+MAX_GLYPH_SIZE = 256
+
+# ******************************************************************************
+# ***   Parse characters range   ***********************************************
+# ******************************************************************************
+def parse_range(text):
+  codes = set()
+  for part in text.split(","):
+    first, _, last = part.partition("-")
+    codes.update(range(int(first, 0), int(last or first, 0) + 1))
+  return codes
+
+# ******************************************************************************
+# ***   Read BDF font   ********************************************************
+# ******************************************************************************
+# * Returns ascent, descent, glyphs and kerning. Glyph is (code, advance,
+# * x offset, y offset from baseline to top, width, height, coverage rows
+# * 0..255).
+def read_bdf(file_name, codes):
+  ascent = descent = 0
+  glyphs = []
+  with open(file_name, encoding="latin-1") as f:
+    lines = iter(f.read().splitlines())
+  for line in lines:
+    words = line.split()
+    if not words:
+      continue
+    if words[0] == "FONT_ASCENT":
+      ascent = int(words[1])
+    elif words[0] == "FONT_DESCENT":
+      descent = int(words[1])
+    elif words[0] == "STARTCHAR":
+      code = advance = -1
+      w = h = xo = yo = 0
+      for line in lines:
+        words = line.split()
+        if words[0] == "ENCODING":
+          code = int(words[1])
+        elif words[0] == "DWIDTH":
+          advance = int(words[1])
+        elif words[0] == "BBX":
+          w, h, xo, yo = [int(v) for v in words[1:5]]
+        elif words[0] == "BITMAP":
+          break
+      rows = []
+      for y in range(h):
+        bits = int(next(lines), 16)
+        nbits = ((w + 7) // 8) * 8
+        rows.append([255 if (bits >> (nbits - 1 - x)) & 1 else 0 for x in range(w)])
+      if (code >= 0) and (code in codes):
+        glyphs.append((code, advance, xo, yo + h, w, h, rows))
+  if ascent + descent == 0:
+    sys.exit("FONT_ASCENT and FONT_DESCENT not found")
+  return ascent, descent, glyphs, []
+
+# ******************************************************************************
+# ***   Downsample font   ******************************************************
+# ******************************************************************************
+def downsample(ascent, descent, glyphs, scale):
+  # Top of line moved up, so it is on pixel border
+  top = -(-ascent // scale) * scale
+  result = []
+  for code, advance, xo, yt, w, h, rows in glyphs:
+    # Bitmap position in pixels of output font
+    x1 = xo // scale
+    x2 = -(-(xo + w) // scale)
+    y1 = (top - yt) // scale
+    y2 = -(-(top - yt + h) // scale)
+    out = [[0] * (x2 - x1) for _ in range(y2 - y1)]
+    for y in range(h):
+      for x in range(w):
+        if rows[y][x]:
+          out[(top - yt + y) // scale - y1][(xo + x) // scale - x1] += rows[y][x]
+    out = [[v // (scale * scale) for v in row] for row in out]
+    result.append((code, round(advance / scale), x1, (top // scale) - y1, x2 - x1, y2 - y1, out))
+  return top // scale, -(-descent // scale), result
+
+# ******************************************************************************
+# ***   Render TrueType font   *************************************************
+# ******************************************************************************
+def read_ttf(file_name, size, codes):
+  try:
+    from PIL import Image, ImageDraw, ImageFont
+  except ImportError:
+    sys.exit("Pillow is required for TrueType fonts")
+  font = ImageFont.truetype(file_name, size)
+  ascent, descent = font.getmetrics()
+  glyphs = []
+  for code in sorted(codes):
+    ch = chr(code)
+    # Skip characters which font doesn't have
+    if (code != 0x20) and (font.getmask(ch).getbbox() is None):
+      continue
+    left, top, right, bottom = font.getbbox(ch)
+    w = max(right - left, 0)
+    h = max(bottom - top, 0)
+    image = Image.new("L", (max(w, 1), max(h, 1)), 0)
+    ImageDraw.Draw(image).text((-left, -top), ch, font=font, fill=255)
+    rows = [[image.getpixel((x, y)) for x in range(w)] for y in range(h)]
+    glyphs.append((code, round(font.getlength(ch)), left, ascent - top, w, h, rows))
+  # Kerning is difference of pair length and length of characters
+  kerning = []
+  for a in glyphs:
+    for b in glyphs:
+      pair = chr(a[0]) + chr(b[0])
+      adjust = round(font.getlength(pair) - font.getlength(pair[0]) - font.getlength(pair[1]))
+      if adjust != 0:
+        kerning.append((a[0], b[0], adjust))
+  return ascent, descent, glyphs, kerning
+
+# ******************************************************************************
+# ***   Pack glyph bitmap   ****************************************************
+# ******************************************************************************
+def pack_glyph(glyph, bpp, height, baseline):
+  code, advance, xo, yt, w, h, rows = glyph
+  y_ofs = baseline - yt
+  # Remove rows out of line and empty rows and columns
+  rows = rows[max(-y_ofs, 0):h - max(y_ofs + h - height, 0)]
+  y_ofs = max(y_ofs, 0)
+  max_val = (1 << bpp) - 1
+  rows = [[(v * max_val + 127) // 255 for v in row] for row in rows]
+  while rows and not any(rows[0]):
+    rows.pop(0)
+    y_ofs += 1
+  while rows and not any(rows[-1]):
+    rows.pop()
+  while rows and rows[0] and not any(row[0] for row in rows):
+    rows = [row[1:] for row in rows]
+    xo += 1
+  while rows and rows[0] and not any(row[-1] for row in rows):
+    rows = [row[:-1] for row in rows]
+  w = len(rows[0]) if rows else 0
+  h = len(rows) if w else 0
+  if not 0 <= advance <= 255 or w > 255 or not -128 <= xo <= 127:
+    sys.exit("Glyph 0x%X doesn't fit in format" % code)
+  # Rows from most significant bits of byte
+  data = []
+  for row in rows[:h]:
+    acc = 0
+    for x in range(0, w):
+      acc = (acc << bpp) | row[x]
+    pad = (-w * bpp) % 8
+    acc <<= pad
+    n = (w * bpp + pad) // 8
+    data += [(acc >> (8 * (n - 1 - i))) & 0xFF for i in range(n)]
+  return (code, advance, xo, y_ofs, w, h), data
+
+# ******************************************************************************
+# ***   Build font   ***********************************************************
+# ******************************************************************************
+# * Glyphs decoded to glyph cache(compressed or read from SD card) must fit in
+# * cache slot. Stored glyphs of font for SD card read to one AssetDrv cache
+# * row, so they must fit in cache row too.
+def build_font(ascent, descent, glyphs, kerning, bpp, compress, cached):
+  height = ascent + descent
+  glyphs = sorted(glyphs, key=lambda g: g[0])
+  packed = [pack_glyph(g, bpp, height, ascent) for g in glyphs]
+  index = {g[0]: i for i, g in enumerate(glyphs)}
+  pairs = sorted((index[l], index[r], a) for l, r, a in kerning if l in index and r in index)
+  # Bitmaps start after header and tables
+  offset = 12 + len(packed) * 16 + len(pairs) * 6
+  offset += -offset % 4
+  table = b""
+  bitmaps = b""
+  for (code, advance, xo, yo, w, h), data in packed:
+    if (compress or cached) and (len(data) > MAX_GLYPH_SIZE):
+      sys.exit("Glyph 0x%X is bigger than %d bytes" % (code, MAX_GLYPH_SIZE))
+    if compress and data:
+      data = encode_row(data)
+    if cached and (len(data) > MAX_CACHE_ROW):
+      sys.exit("Stored glyph 0x%X is bigger than %d bytes" % (code, MAX_CACHE_ROW))
+    table += struct.pack("<IIHBBbbBB", code, offset + len(bitmaps), len(data), w, h, xo, yo, advance, 0)
+    bitmaps += bytes(data)
+  kern = b"".join(struct.pack("<HHh", l, r, a) for l, r, a in pairs)
+  header = b"DBFN" + struct.pack("<BBBBHH", bpp | (FONT_LZ if compress else 0), height, ascent, 0, len(packed), len(pairs))
+  data = header + table + kern
+  data += b"\0" * (-len(data) % 4)
+  sys.stderr.write("%d glyphs, %d kerning pairs, height %d, %d bytes\n" % (len(packed), len(pairs), height, len(data) + len(bitmaps)))
+  return data + bitmaps
+
+# ******************************************************************************
+# ***   Format array   *********************************************************
+# ******************************************************************************
+def format_array(name, data):
+  lines = []
+  for i in range(0, len(data), 16):
+    lines.append(", ".join("0x%02X" % b for b in data[i:i + 16]))
+  # Declaration gives external linkage to const array in C++ file
+  return "extern const uint8_t " + name + "[];\r\n" + \
+         "const uint8_t " + name + "[] __attribute__((aligned(4))) = {\r\n" + ",\r\n".join(lines) + "};\r\n"
+
+# ******************************************************************************
+# ***   Main   *****************************************************************
+# ******************************************************************************
+def main():
+  parser = argparse.ArgumentParser(description="Convert BDF and TrueType fonts to PropFont format")
+  parser.add_argument("-b", "--bpp", type=int, default=4, choices=[1, 2, 4], help="bits per pixel of coverage")
+  parser.add_argument("-c", "--chars", default="32-126", help="characters: ranges of codes, for example 32-126,0x410-0x44F")
+  parser.add_argument("-s", "--scale", type=int, default=1, help="downsample BDF font drawn in N times bigger size")
+  parser.add_argument("-t", "--ttf-size", type=int, help="render TrueType font with size in pixels")
+  parser.add_argument("-z", "--lz", action="store_true", help="LZ compress glyphs")
+  parser.add_argument("-o", "--output", help="output binary file")
+  parser.add_argument("-n", "--name", default="font_data", help="name of C array")
+  parser.add_argument("file", help="BDF or TrueType font file")
+  args = parser.parse_args()
+
+  codes = parse_range(args.chars)
+  if args.ttf_size:
+    ascent, descent, glyphs, kerning = read_ttf(args.file, args.ttf_size, codes)
+  else:
+    ascent, descent, glyphs, kerning = read_bdf(args.file, codes)
+    if args.scale > 1:
+      ascent, descent, glyphs = downsample(ascent, descent, glyphs, args.scale)
+  data = build_font(ascent, descent, glyphs, kerning, args.bpp, args.lz, args.output is not None)
+
+  if args.output:
+    with open(args.output, "wb") as f:
+      f.write(data)
+  else:
+    sys.stdout.write(format_array(args.name, data))
+
+if __name__ == "__main__":
+  main()
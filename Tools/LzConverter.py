@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+#*******************************************************************************
+#  @file LzConverter.py
+#  @author Nicolai Shlapunov
+#
+#  @details DevCore: Converter of images to LZ compressed format
+#
+#  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+#             All rights reserved.
+#
+#  @section SUPPORT
+#
+#   Devtronic invests time and resources providing this open source code,
+#   please support Devtronic and open-source hardware/software by
+#   donations and/or purchasing products from Devtronic.
+#
+#*******************************************************************************
+#
+# Compresses images stored as C arrays to the LZ format drawn by Image and
+# StreamImage classes(ImageDesc with bits_per_pixel = bpp | IMAGE_LZ). Image
+# can be in any format: 16-bit, 8-bit, packed or with alpha channel.
+#
+# Format: table of (height + 1) 32-bit little endian offsets of rows from
+# start of data(last offset is size of data), then rows. Each row compressed
+# separately and is sequence of tokens:
+#   0LLLLLLL                       - L + 1 literal bytes follow
+#   1LLLLLDD DDDDDDDD [EEEEEEEE]   - copy L + 3 bytes from distance D + 1,
+#                                    if L is 31 length is 34 + E
+#
+# Usage:
+#   LzConverter.py -W 320 -H 240 -b 16 Background.cpp background_data
+# prints converted arrays. With -i option arrays are replaced in source file.
+# With -s option image is checked for StreamImage: each compressed row is read
+# to AssetDrv row cache, so it must fit in ASSET_CACHE_ROW_SIZE.
+# ImageDesc of image must be updated by hand: IMAGE_LZ flag should be added
+# to bits per pixel and 16-bit images should use img8 pointer.
+#
+#*******************************************************************************
+
+import argparse
+import re
+import sys
+
+# Max match distance and length
+MAX_DIST = 1024
+MAX_LEN = 34 + 255
+# Max literals in one token
+MAX_LITERALS = 128
+# Max size of decoded row(LzDecoder::MAX_ROW_SIZE)
+MAX_ROW_SIZE = 640
+# Max size of row read by AssetDrv(ASSET_CACHE_ROW_SIZE)
+MAX_CACHE_ROW = 320
+# Max candidates checked for each position
+MAX_CHAIN = 32
+
+# ******************************************************************************
+# ***   Find array in source   *************************************************
+# ******************************************************************************
+def find_array(src, name):
+  pattern = re.compile(r'const\s+(uint8_t|uint16_t)\s+' + re.escape(name) + r'\s*\[\s*\w*\s*\]\s*=\s*\{(.*?)\};', re.S)
+  match = pattern.search(src)
+  if match is None:
+    sys.exit("Array " + name + " not found")
+  return match
+
+# ******************************************************************************
+# ***   Encode one row   *******************************************************
+# ******************************************************************************
+def encode_row(row):
+  out = []
+  literals = []
+  # Positions of 3-byte sequences
+  chains = {}
+  x = 0
+  while x < len(row):
+    # Find longest match
+    best_len = 0
+    best_dist = 0
+    key = bytes(row[x:x + 3])
+    if len(key) == 3:
+      for pos in reversed(chains.get(key, [])[-MAX_CHAIN:]):
+        if x - pos > MAX_DIST:
+          break
+        n = 0
+        while (x + n < len(row)) and (n < MAX_LEN) and (row[pos + n] == row[x + n]):
+          n += 1
+        if n > best_len:
+          best_len = n
+          best_dist = x - pos
+    if best_len >= 3:
+      # Flush literals
+      for i in range(0, len(literals), MAX_LITERALS):
+        chunk = literals[i:i + MAX_LITERALS]
+        out += [len(chunk) - 1] + chunk
+      literals = []
+      d = best_dist - 1
+      if best_len >= 34:
+        out += [0x80 | (31 << 2) | (d >> 8), d & 0xFF, best_len - 34]
+      else:
+        out += [0x80 | ((best_len - 3) << 2) | (d >> 8), d & 0xFF]
+      step = best_len
+    else:
+      literals.append(row[x])
+      step = 1
+    # Add positions to chains
+    for i in range(x, min(x + step, len(row) - 2)):
+      chains.setdefault(bytes(row[i:i + 3]), []).append(i)
+    x += step
+  for i in range(0, len(literals), MAX_LITERALS):
+    chunk = literals[i:i + MAX_LITERALS]
+    out += [len(chunk) - 1] + chunk
+  return out
+
+# ******************************************************************************
+# ***   Encode image   *********************************************************
+# ******************************************************************************
+def encode_image(data, width, height, bpp, max_packed_row=None):
+  line_size = (width * bpp + 7) // 8
+  if len(data) != line_size * height:
+    sys.exit("Data size %d doesn't match %dx%d %d bpp" % (len(data), width, height, bpp))
+  if line_size > MAX_ROW_SIZE:
+    sys.exit("Row size %d is bigger than %d" % (line_size, MAX_ROW_SIZE))
+  rows = [encode_row(data[y * line_size:(y + 1) * line_size]) for y in range(height)]
+  for y, row in enumerate(rows):
+    if (max_packed_row is not None) and (len(row) > max_packed_row):
+      sys.exit("Compressed row %d size %d is bigger than %d" % (y, len(row), max_packed_row))
+  # Offsets table
+  offset = (height + 1) * 4
+  table = []
+  for row in rows:
+    table += [(offset >> s) & 0xFF for s in (0, 8, 16, 24)]
+    offset += len(row)
+  table += [(offset >> s) & 0xFF for s in (0, 8, 16, 24)]
+  return table + [b for row in rows for b in row], max(len(row) for row in rows)
+
+# ******************************************************************************
+# ***   Get image bytes from array values   ************************************
+# ******************************************************************************
+def to_bytes(values, type_name):
+  if type_name == "uint16_t":
+    # Little endian, as in memory
+    return [b for v in values for b in (v & 0xFF, v >> 8)]
+  return values
+
+# ******************************************************************************
+# ***   Format array   *********************************************************
+# ******************************************************************************
+def format_array(name, data, eol):
+  lines = []
+  for i in range(0, len(data), 16):
+    lines.append(", ".join("0x%02X" % b for b in data[i:i + 16]))
+  return "const uint8_t " + name + "[] = {" + eol + (", " + eol).join(lines) + "};"
+
+# ******************************************************************************
+# ***   Main   *****************************************************************
+# ******************************************************************************
+def main():
+  parser = argparse.ArgumentParser(description="Convert image C arrays to LZ compressed format")
+  parser.add_argument("-W", "--width", type=int, required=True, help="image width")
+  parser.add_argument("-H", "--height", type=int, required=True, help="image height")
+  parser.add_argument("-b", "--bpp", type=int, required=True, choices=[1, 2, 4, 8, 16], help="bits per pixel")
+  parser.add_argument("-i", "--in-place", action="store_true", help="replace arrays in source file")
+  parser.add_argument("-s", "--stream", action="store_true", help="check compressed rows fit in AssetDrv row cache")
+  parser.add_argument("file", help="source file with arrays")
+  parser.add_argument("names", nargs="+", help="names of arrays to convert")
+  args = parser.parse_args()
+
+  with open(args.file, newline="") as f:
+    src = f.read()
+  eol = "\r\n" if "\r\n" in src else "\n"
+
+  for name in args.names:
+    match = find_array(src, name)
+    values = [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', match.group(2))]
+    raw = to_bytes(values, match.group(1))
+    data, max_row = encode_image(raw, args.width, args.height, args.bpp, MAX_CACHE_ROW if args.stream else None)
+    text = format_array(name, data, eol)
+    sys.stderr.write("%s: %d -> %d bytes, max row %d bytes\n" % (name, len(raw), len(data), max_row))
+    if args.in_place:
+      src = src[:match.start()] + text + src[match.end():]
+    else:
+      print(text)
+
+  if args.in_place:
+    with open(args.file, "w", newline="") as f:
+      f.write(src)
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#*******************************************************************************
+#  @file PackConverter.py
+#  @author Nicolai Shlapunov
+#
+#  @details DevCore: Converter of 8-bit images to packed 1, 2 and 4-bit format
+#
+#  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+#             All rights reserved.
+#
+#  @section SUPPORT
+#
+#   Devtronic invests time and resources providing this open source code,
+#   please support Devtronic and open-source hardware/software by
+#   donations and/or purchasing products from Devtronic.
+#
+#*******************************************************************************
+#
+# Converts 8-bit palette images stored as C arrays to packed images with own
+# small palette. Smallest possible format(1, 2 or 4 bits per pixel) is chosen
+# for each image. Pixels stored from the most significant bits of byte, each
+# line starts from new byte.
+#
+# Usage:
+#   PackConverter.py -W 16 -H 16 -p ../STM32F415APP/DevCore/Display/Image.cpp
+#                    -P PALETTE_884 Gario.cpp tiles_0_data tiles_1_data
+# prints converted arrays and palettes. With -i option arrays are replaced in
+# source file and palettes are inserted after them. ImageDesc of image must be
+# updated by hand: bits per pixel printed to stderr, palette name is array
+# name with "_palette" suffix.
+#
+#*******************************************************************************
+
+import argparse
+import re
+import sys
+
+# ******************************************************************************
+# ***   Find array in source   *************************************************
+# ******************************************************************************
+def find_array(src, type_name, name):
+  pattern = re.compile(r'const\s+' + type_name + r'\s+' + re.escape(name) + r'\s*\[\s*\w*\s*\]\s*=\s*\{(.*?)\};', re.S)
+  match = pattern.search(src)
+  if match is None:
+    sys.exit("Array " + name + " not found")
+  return match
+
+# ******************************************************************************
+# ***   Parse values of array   ************************************************
+# ******************************************************************************
+def parse_values(text):
+  return [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', text)]
+
+# ******************************************************************************
+# ***   Pack image   ***********************************************************
+# ******************************************************************************
+def pack_image(pixels, width, height):
+  if len(pixels) != width * height:
+    sys.exit("Array size %d doesn't match %dx%d" % (len(pixels), width, height))
+  # Palette indexes used by image in order of appearance
+  colors = []
+  for p in pixels:
+    if p not in colors:
+      colors.append(p)
+  bpp = next((b for b in (1, 2, 4) if len(colors) <= (1 << b)), None)
+  if bpp is None:
+    sys.exit("Image has %d colors and can't be packed" % len(colors))
+  # Pack lines
+  ppb = 8 // bpp
+  data = []
+  for y in range(height):
+    line = [colors.index(p) for p in pixels[y * width:(y + 1) * width]]
+    for x in range(0, width, ppb):
+      byte = 0
+      for i, v in enumerate(line[x:x + ppb]):
+        byte |= v << (8 - bpp * (i + 1))
+      data.append(byte)
+  return bpp, colors, data
+
+# ******************************************************************************
+# ***   Format array   *********************************************************
+# ******************************************************************************
+def format_array(type_name, name, values, fmt, eol):
+  lines = []
+  for i in range(0, len(values), 16):
+    lines.append(", ".join(fmt % v for v in values[i:i + 16]))
+  return "const " + type_name + " " + name + "[] = {" + eol + (", " + eol).join(lines) + "};"
+
+# ******************************************************************************
+# ***   Main   *****************************************************************
+# ******************************************************************************
+def main():
+  parser = argparse.ArgumentParser(description="Convert 8-bit image C arrays to packed 1, 2 or 4-bit format")
+  parser.add_argument("-W", "--width", type=int, required=True, help="image width")
+  parser.add_argument("-H", "--height", type=int, required=True, help="image height")
+  parser.add_argument("-p", "--palette-file", required=True, help="source file with palette")
+  parser.add_argument("-P", "--palette", required=True, help="name of palette used by images")
+  parser.add_argument("-i", "--in-place", action="store_true", help="replace arrays in source file")
+  parser.add_argument("file", help="source file with arrays")
+  parser.add_argument("names", nargs="+", help="names of arrays to convert")
+  args = parser.parse_args()
+
+  with open(args.palette_file, newline="") as f:
+    palette = parse_values(find_array(f.read(), "uint16_t", args.palette).group(1))
+  with open(args.file, newline="") as f:
+    src = f.read()
+  eol = "\r\n" if "\r\n" in src else "\n"
+
+  for name in args.names:
+    match = find_array(src, "uint8_t", name)
+    pixels = parse_values(match.group(1))
+    bpp, colors, data = pack_image(pixels, args.width, args.height)
+    text = format_array("uint8_t", name, data, "0x%02X", eol) + eol + eol + \
+           format_array("uint16_t", name + "_palette", [palette[c] for c in colors], "0x%04X", eol)
+    sys.stderr.write("%s: %d bpp, %d -> %d bytes\n" % (name, bpp, len(pixels), len(data) + 2 * len(colors)))
+    if args.in_place:
+      src = src[:match.start()] + text + src[match.end():]
+    else:
+      print(text)
+
+  if args.in_place:
+    with open(args.file, "w", newline="") as f:
+      f.write(src)
+
+if __name__ == "__main__":
+  main()
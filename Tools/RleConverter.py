@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#*******************************************************************************
+#  @file RleConverter.py
+#  @author Nicolai Shlapunov
+#
+#  @details DevCore: Converter of 8-bit images to run-length encoded format
+#
+#  @copyright Copyright (c) 2018, Devtronic & Nicolai Shlapunov
+#             All rights reserved.
+#
+#  @section SUPPORT
+#
+#   Devtronic invests time and resources providing this open source code,
+#   please support Devtronic and open-source hardware/software by
+#   donations and/or purchasing products from Devtronic.
+#
+#*******************************************************************************
+#
+# Converts 8-bit palette images stored as C arrays to the run-length encoded
+# format drawn by Image class(ImageDesc with bits_per_pixel = 8 | IMAGE_RLE).
+#
+# Format: table of (height + 1) 16-bit little endian offsets of rows from
+# start of data(last offset is size of data), then rows. Each row is sequence
+# of runs: count of transparent pixels to skip, count of pixels to copy and
+# pixels to copy. Runs longer than 255 pixels are split. Transparent pixels at
+# the end of row are not stored.
+#
+# Usage:
+#   RleConverter.py -W 16 -H 16 -k 0xC7 Gario.cpp gario_0_data gario_1_data
+# prints converted arrays. With -i option arrays are replaced in source file.
+#
+#*******************************************************************************
+
+import argparse
+import re
+import sys
+
+# ******************************************************************************
+# ***   Find array in source   *************************************************
+# ******************************************************************************
+def find_array(src, name):
+  pattern = re.compile(r'const\s+uint8_t\s+' + re.escape(name) + r'\s*\[\s*\]\s*=\s*\{(.*?)\};', re.S)
+  match = pattern.search(src)
+  if match is None:
+    sys.exit("Array " + name + " not found")
+  return match
+
+# ******************************************************************************
+# ***   Encode one row   *******************************************************
+# ******************************************************************************
+def encode_row(row, key):
+  out = []
+  x = 0
+  while x < len(row):
+    # Count transparent pixels
+    skip = 0
+    while (x + skip < len(row)) and (row[x + skip] == key):
+      skip += 1
+    # Transparent pixels at the end of row are not stored
+    if x + skip == len(row):
+      break
+    while skip > 255:
+      out += [255, 0]
+      skip -= 255
+    x += skip
+    # Count opaque pixels
+    cnt = 0
+    while (x + cnt < len(row)) and (row[x + cnt] != key) and (cnt < 255):
+      cnt += 1
+    out += [skip, cnt] + row[x:x + cnt]
+    x += cnt
+  return out
+
+# ******************************************************************************
+# ***   Encode image   *********************************************************
+# ******************************************************************************
+def encode_image(pixels, width, height, key):
+  if len(pixels) != width * height:
+    sys.exit("Array size %d doesn't match %dx%d" % (len(pixels), width, height))
+  rows = [encode_row(pixels[y * width:(y + 1) * width], key) for y in range(height)]
+  # Offsets table
+  offset = (height + 1) * 2
+  table = []
+  for row in rows:
+    table += [offset & 0xFF, offset >> 8]
+    offset += len(row)
+  table += [offset & 0xFF, offset >> 8]
+  if offset > 0xFFFF:
+    sys.exit("Encoded image is too big")
+  return table + [b for row in rows for b in row]
+
+# ******************************************************************************
+# ***   Format array   *********************************************************
+# ******************************************************************************
+def format_array(name, data, eol):
+  lines = []
+  for i in range(0, len(data), 16):
+    lines.append(", ".join("0x%02X" % b for b in data[i:i + 16]))
+  return "const uint8_t " + name + "[] = {" + eol + (", " + eol).join(lines) + "};"
+
+# ******************************************************************************
+# ***   Main   *****************************************************************
+# ******************************************************************************
+def main():
+  parser = argparse.ArgumentParser(description="Convert 8-bit image C arrays to RLE format")
+  parser.add_argument("-W", "--width", type=int, required=True, help="image width")
+  parser.add_argument("-H", "--height", type=int, required=True, help="image height")
+  parser.add_argument("-k", "--key", type=lambda s: int(s, 0), required=True, help="transparent palette index")
+  parser.add_argument("-i", "--in-place", action="store_true", help="replace arrays in source file")
+  parser.add_argument("file", help="source file with arrays")
+  parser.add_argument("names", nargs="+", help="names of arrays to convert")
+  args = parser.parse_args()
+
+  with open(args.file, newline="") as f:
+    src = f.read()
+  eol = "\r\n" if "\r\n" in src else "\n"
+
+  for name in args.names:
+    match = find_array(src, name)
+    pixels = [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', match.group(1))]
+    data = encode_image(pixels, args.width, args.height, args.key)
+    text = format_array(name, data, eol)
+    sys.stderr.write("%s: %d -> %d bytes\n" % (name, len(pixels), len(data)))
+    if args.in_place:
+      src = src[:match.start()] + text + src[match.end():]
+    else:
+      print(text)
+
+  if args.in_place:
+    with open(args.file, "w", newline="") as f:
+      f.write(src)
+
+if __name__ == "__main__":
+  main()